@@ -0,0 +1,381 @@
+/**----------------------------------------------------------------
+ * File:LLDense.cpp
+ *
+ * Author: Gregory Gannon
+ *
+ * PURPOSE
+ *
+ *  Dense link storage used by the Linked list manager for lists
+ *    registered with LL_OPTION_DENSE.  Links, records and validation
+ *    numbers are kept apart and addressed by the element index.
+ *
+ * UPDATES:
+ *
+ * GMG   10-17-2026    Created for the hot/cold split layout.
+ * GMG   10-17-2026    DenseAttach() and DenseCheck() for the persistent lists.  The list
+ *                      state is reached through pState and the words an operation changes
+ *                      are stored through Put() so a file logs them.
+ *-------------------------------------------------------------
+*/
+
+#include <stdlib.h>
+#include "LLDense.h"
+#include "LLPersist.h"
+
+//--------------------------------------------------------------------
+// Constructor - nothing is allocated until the first add
+//--------------------------------------------------------------------
+
+LLDense::LLDense()
+{
+    pLinks       = NULL;
+    pRandom      = NULL;
+    RecordStride = 0;
+    Capacity     = 0;
+    Own.Used     = 0;
+    Own.FreeHead = LL_DENSE_NONE;
+    Own.Head     = LL_DENSE_NONE;
+    Own.Tail     = LL_DENSE_NONE;
+    Own.Count    = 0;
+    pState       = &Own;
+    pStore       = NULL;
+}
+
+LLDense::~LLDense()
+{
+    if (pStore == NULL)                             // A file keeps its list, the mapping goes with the file
+    {
+        DenseClear();
+    }
+}
+
+bool LLDense::DenseInit(size_t Length)
+{
+    DenseClear();
+    RecordStride = (Length + 7) & ~(size_t) 7;
+    return RecordStride > 0;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Run the list on an open file.  The arrays and the record
+ *    chunks point into the mapping, which the file made a whole number
+ *    of chunks long, and the state is the one in its header.  Called
+ *    on a list with nothing in it yet.
+ *------------------------------------------------------------------
+*/
+void LLDense::DenseAttach(LLPersist *pFile)
+{
+    PersistHeader_t  *pHeader = pFile->PersistHeader();
+    char             *pBase   = pFile->PersistBase();
+
+    DenseClear();
+    pLinks   = (DenseLink_t *)(pBase + pHeader->LinkOffset);
+    pRandom  = (uint32_t *)(pBase + pHeader->RandomOffset);
+    Capacity = pHeader->Capacity;
+
+    for (uint32_t i = 0; i < (Capacity >> LL_DENSE_CHUNKBITS); ++i)
+    {
+        Chunks.push_back(pBase + pHeader->RecordOffset + ((size_t) i << LL_DENSE_CHUNKBITS) * RecordStride);
+    }
+    pState = &pHeader->State;
+    pStore = pFile;
+}
+
+inline void LLDense::Put(uint32_t *pWord, uint32_t Value)
+{
+    if (pStore != NULL)
+    {
+        pStore->PersistPut(pWord, Value);
+    }
+    else
+    {
+        *pWord = Value;
+    }
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Make indexes below Needed usable.  The link and validation
+ *    arrays double until they are big enough and the record chunks
+ *    that hold those indexes are allocated.  A failure leaves what was
+ *    there in place.
+ *------------------------------------------------------------------
+*/
+bool LLDense::Grow(uint32_t Needed)
+{
+    uint32_t     NewCapacity = (Capacity == 0) ? LL_DENSE_FIRSTSIZE : Capacity;
+    DenseLink_t *pNewLinks;
+    uint32_t    *pNewRandom;
+    char        *pChunk;
+
+    if (pStore != NULL)                             // A file has all the room it will ever have
+    {
+        return Needed <= Capacity;
+    }
+    if (Needed > LL_DENSE_MAXELEMENTS)
+    {
+        return false;
+    }
+
+    while (NewCapacity < Needed)
+    {
+        NewCapacity *= 2;
+    }
+
+    if (NewCapacity > Capacity)
+    {
+        if ((pNewLinks = (DenseLink_t *) realloc(pLinks, NewCapacity * sizeof(DenseLink_t))) == NULL)
+        {
+            return false;
+        }
+        pLinks = pNewLinks;
+
+        if ((pNewRandom = (uint32_t *) realloc(pRandom, NewCapacity * sizeof(uint32_t))) == NULL)
+        {
+            return false;                           // The bigger link array is kept, Capacity says what is usable
+        }
+        pRandom  = pNewRandom;
+        Capacity = NewCapacity;
+    }
+
+    while ((Chunks.size() << LL_DENSE_CHUNKBITS) < Needed)
+    {
+        if ((pChunk = (char *) malloc(RecordStride << LL_DENSE_CHUNKBITS)) == NULL)
+        {
+            return false;
+        }
+        Chunks.push_back(pChunk);
+    }
+    return true;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: An index for a new element, off the free list or the next
+ *    one never used.  Random is its validation number and must not be
+ *    0.  The element is not linked yet.
+ *------------------------------------------------------------------
+*/
+uint32_t LLDense::DenseAlloc(uint32_t Random)
+{
+    DenseState_t  *pList = pState;
+    uint32_t       Index;
+
+    if (pList->FreeHead != LL_DENSE_NONE)
+    {
+        Index = pList->FreeHead;
+        Put(&pList->FreeHead, pLinks[Index].Next);
+    }
+    else
+    {
+        if (pList->Used == Capacity || (pList->Used >> LL_DENSE_CHUNKBITS) == Chunks.size())
+        {
+            if (Grow(pList->Used + 1) == false)
+            {
+                return LL_DENSE_NONE;
+            }
+        }
+        Index = pList->Used;
+        Put(&pList->Used, Index + 1);
+    }
+
+    Put(&pRandom[Index], Random);
+    return Index;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Link Index into the list after Prev, or before Next.  The
+ *    list end (LL_DENSE_NONE) means the front for an add after and
+ *    the back for an add before, so both work on an empty list.
+ *------------------------------------------------------------------
+*/
+void LLDense::DenseLinkAfter(uint32_t Prev, uint32_t Index)
+{
+    DenseState_t  *pList = pState;
+    uint32_t       Next  = (Prev == LL_DENSE_NONE) ? pList->Head : pLinks[Prev].Next;
+
+    Put(&pLinks[Index].Prev, Prev);
+    Put(&pLinks[Index].Next, Next);
+
+    if (Prev == LL_DENSE_NONE)
+    {
+        Put(&pList->Head, Index);
+    }
+    else
+    {
+        Put(&pLinks[Prev].Next, Index);
+    }
+
+    if (Next == LL_DENSE_NONE)
+    {
+        Put(&pList->Tail, Index);
+    }
+    else
+    {
+        Put(&pLinks[Next].Prev, Index);
+    }
+    Put(&pList->Count, pList->Count + 1);
+
+    if (pStore != NULL)                             // The add is in, DenseAlloc() to here is one operation
+    {
+        pStore->PersistCommit();
+    }
+}
+
+void LLDense::DenseLinkBefore(uint32_t Next, uint32_t Index)
+{
+    DenseLinkAfter((Next == LL_DENSE_NONE) ? pState->Tail : pLinks[Next].Prev, Index);
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Unlink Index and put it on the free list.  The validation
+ *    number is cleared so a token for it is turned down.
+ *------------------------------------------------------------------
+*/
+void LLDense::DenseErase(uint32_t Index)
+{
+    DenseState_t  *pList = pState;
+    uint32_t       Prev  = pLinks[Index].Prev;
+    uint32_t       Next  = pLinks[Index].Next;
+
+    if (Prev == LL_DENSE_NONE)
+    {
+        Put(&pList->Head, Next);
+    }
+    else
+    {
+        Put(&pLinks[Prev].Next, Next);
+    }
+
+    if (Next == LL_DENSE_NONE)
+    {
+        Put(&pList->Tail, Prev);
+    }
+    else
+    {
+        Put(&pLinks[Next].Prev, Prev);
+    }
+
+    Put(&pRandom[Index], 0);
+    Put(&pLinks[Index].Next, pList->FreeHead);
+    Put(&pList->FreeHead, Index);
+    Put(&pList->Count, pList->Count - 1);
+
+    if (pStore != NULL)
+    {
+        pStore->PersistCommit();
+    }
+}
+
+bool LLDense::DenseValid(uint32_t Index, uint32_t Random)
+{
+    return Index < pState->Used && Random != 0 && pRandom[Index] == Random;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Check a list that was not closed clean before it is used.
+ *    The walk from Head must reach Tail in Count steps through live
+ *    indexes whose Prev links point back, and the free list must hold
+ *    every other index below Used, each with its validation number
+ *    cleared.  A loop in either runs past its count.  O(n), the links
+ *    and validation numbers only.
+ *------------------------------------------------------------------
+*/
+bool LLDense::DenseCheck(void)
+{
+    DenseState_t  *pList = pState;
+    uint32_t       Index;
+    uint32_t       Prev  = LL_DENSE_NONE;
+    uint32_t       Steps = 0;
+
+    if (pList->Used > Capacity || pList->Count > pList->Used)
+    {
+        return false;
+    }
+
+    for (Index = pList->Head; Index != LL_DENSE_NONE; Prev = Index, Index = pLinks[Index].Next)
+    {
+        if (Index >= pList->Used || pRandom[Index] == 0 || pLinks[Index].Prev != Prev || ++Steps > pList->Count)
+        {
+            return false;
+        }
+    }
+    if (Prev != pList->Tail || Steps != pList->Count)
+    {
+        return false;
+    }
+
+    Steps = 0;
+    for (Index = pList->FreeHead; Index != LL_DENSE_NONE; Index = pLinks[Index].Next)
+    {
+        if (Index >= pList->Used || pRandom[Index] != 0 || ++Steps > pList->Used - pList->Count)
+        {
+            return false;
+        }
+    }
+    return Steps == pList->Used - pList->Count;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Room for Elements more elements.  Free indexes are used
+ *    first, so only the ones past Used need arrays and chunks.
+ *------------------------------------------------------------------
+*/
+bool LLDense::DenseReserve(size_t Elements)
+{
+    size_t  Free = pState->Used - pState->Count;
+
+    if (Elements <= Free)
+    {
+        return true;
+    }
+    if (pState->Used + (Elements - Free) > LL_DENSE_MAXELEMENTS)
+    {
+        return false;
+    }
+    return Grow((uint32_t)(pState->Used + (Elements - Free)));
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Empty the list.  In memory every array and chunk goes back
+ *    to the heap.  A file keeps its arrays and the state is reset as
+ *    one logged operation - the validation numbers left behind are
+ *    at Used and past it, where no token is looked at.
+ *------------------------------------------------------------------
+*/
+void LLDense::DenseClear(void)
+{
+    if (pStore != NULL)
+    {
+        Put(&pState->Used, 0);
+        Put(&pState->FreeHead, LL_DENSE_NONE);
+        Put(&pState->Head, LL_DENSE_NONE);
+        Put(&pState->Tail, LL_DENSE_NONE);
+        Put(&pState->Count, 0);
+        pStore->PersistCommit();
+        return;
+    }
+
+    for (char *pChunk : Chunks)
+    {
+        free(pChunk);
+    }
+    Chunks.clear();
+    free(pLinks);
+    free(pRandom);
+
+    pLinks       = NULL;
+    pRandom      = NULL;
+    Capacity     = 0;
+    Own.Used     = 0;
+    Own.FreeHead = LL_DENSE_NONE;
+    Own.Head     = LL_DENSE_NONE;
+    Own.Tail     = LL_DENSE_NONE;
+    Own.Count    = 0;
+}
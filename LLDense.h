@@ -0,0 +1,113 @@
+/**--------------------------------------------------------------
+ * File: LLDense.h
+ *
+ *  Author: Gregory Gannon
+ * Created: 10/17/2026
+ *---------------------------------------------------------------------
+ * HISTORY
+ *
+ *	 Date       Author      Change Description
+ *   ----		------		------------------
+ * 10/17/2026    GMG        Developed the dense link storage for LL_OPTION_DENSE
+ * 10/17/2026    GMG        DenseUsed() and DenseLive() so ParallelForEach() can split the indexes
+ * 10/17/2026    GMG        DenseAttach() runs the list on the arrays of a mapped file (LLPersist.h),
+ *                           the ends and count moved to a DenseState_t the file can hold
+ *
+ * PURPOSE
+ *    Hot/cold split storage used by the Linked list manager.  An element
+ *    is an index.  The links are two 32 bit indexes in one dense array,
+ *    the user records are in chunks of their own and the validation
+ *    numbers for the tokens are in a third array.  Walking the list
+ *    reads 8 bytes of link per element and the record of the element
+ *    it stops on, nothing else.
+ *
+ *    Record chunks are never moved, so a record keeps its address while
+ *    it is in the list.  The link and validation arrays are internal and
+ *    are moved when they grow.  A deleted index goes on a free list
+ *    threaded through Next and is handed out again by the next add.
+ *
+ *    A list attached to a file (DenseAttach()) has its arrays, records
+ *    and state in the mapping and never grows past the file capacity.
+ *    Every word an add, delete or clear changes goes through the file's
+ *    undo log and the operation is committed when its last link is in.
+ *----------------------------------------------------------------------
+*/
+#ifndef LLDENSE_H
+#define LLDENSE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#define  LL_DENSE_NONE          0xFFFFFFFF      // No element - the end of the list
+#define  LL_DENSE_CHUNKBITS     10              // 1024 records in a record chunk
+#define  LL_DENSE_MAXELEMENTS   0x7FFFFFFF      // Indexes handed out at most
+#define  LL_DENSE_FIRSTSIZE     1024            // Link array size on the first add, doubles after
+
+class  LLPersist;
+
+/*
+ *----------------------------------------------------------------------
+ * Links of one element - indexes of the elements before and after it
+ *--------------------------------------------------------------------
+*/
+typedef struct {
+    uint32_t    Next;
+    uint32_t    Prev;
+}  DenseLink_t;
+
+/*
+ *----------------------------------------------------------------------
+ * Ends, count and free list - in the list or in the header of its file
+ *--------------------------------------------------------------------
+*/
+typedef struct {
+    uint32_t    Used;                           /// Indexes handed out so far
+    uint32_t    FreeHead;                       /// First free index below Used
+    uint32_t    Head;
+    uint32_t    Tail;
+    uint32_t    Count;                          /// Elements in the list
+}  DenseState_t;
+
+class  LLDense
+{
+  protected:
+
+    DenseLink_t  *pLinks;                       /// Hot - what a walk reads
+    uint32_t     *pRandom;                      /// Cold - token validation, 0 for a free index
+    std::vector<char *> Chunks;                 /// Record chunks, index >> LL_DENSE_CHUNKBITS
+    size_t        RecordStride;                 /// Record length rounded to 8
+    uint32_t      Capacity;                     /// Entries in pLinks and pRandom
+    DenseState_t  Own;                          /// State of a list in memory
+    DenseState_t *pState;                       /// Own, or the header of the file
+    LLPersist    *pStore;                       /// File the arrays are mapped from - NULL in memory
+
+    bool          Grow(uint32_t);               /// Arrays and chunks for indexes below n
+    void          Put(uint32_t *, uint32_t);    /// Store a word, through the undo log of a file
+
+  public:
+    bool          DenseInit(size_t);            /// Record length
+    void          DenseAttach(LLPersist *);     /// Use the arrays and state of an open file from now on
+    bool          DenseCheck(void);             /// Links, free list and count agree - for a file not closed clean
+    uint32_t      DenseAlloc(uint32_t);         /// Free index with its validation number or LL_DENSE_NONE
+    void          DenseLinkAfter(uint32_t, uint32_t);    /// Link after an element - LL_DENSE_NONE links it first
+    void          DenseLinkBefore(uint32_t, uint32_t);   /// Link before an element - LL_DENSE_NONE links it last
+    void          DenseErase(uint32_t);                  /// Unlink and free
+    bool          DenseValid(uint32_t, uint32_t);        /// Index in the list with that validation number
+    bool          DenseReserve(size_t);                  /// Room for n elements in the list without an allocation
+    void          DenseClear(void);                      /// Every array and chunk back to the heap - a file is emptied
+    uint32_t      DenseFirst(void) { return pState->Head; }
+    uint32_t      DenseLast(void)  { return pState->Tail; }
+    uint32_t      DenseCount(void) { return pState->Count; }
+    uint32_t      DenseNext(uint32_t Index) { return pLinks[Index].Next; }
+    uint32_t      DensePrev(uint32_t Index) { return pLinks[Index].Prev; }
+    uint32_t      DenseRandom(uint32_t Index) { return pRandom[Index]; }
+    uint32_t      DenseUsed(void) { return pState->Used; }                       /// Indexes 0 to n - 1 have been handed out
+    bool          DenseLive(uint32_t Index) { return pRandom[Index] != 0; }   /// Index is in the list
+    void         *DenseRecord(uint32_t Index)
+                  { return Chunks[Index >> LL_DENSE_CHUNKBITS] + (Index & ((1 << LL_DENSE_CHUNKBITS) - 1)) * RecordStride; }
+                  LLDense();
+                  ~LLDense();
+};
+
+#endif
@@ -0,0 +1,138 @@
+/**----------------------------------------------------------------
+ * File:LLHandle.cpp
+ *
+ * Author: Gregory Gannon
+ *
+ * PURPOSE
+ *
+ *  Handle table used by the Linked list manager to check the
+ *    direct tokens of a classic list by slot and generation.
+ *
+ * UPDATES:
+ *
+ * GMG   10-17-2026    Created for the generation checked tokens.
+ *-------------------------------------------------------------
+*/
+
+#include <stdlib.h>
+#include "LLHandle.h"
+
+//--------------------------------------------------------------------
+// Constructor - nothing is allocated until the first slot
+//--------------------------------------------------------------------
+
+LLHandle::LLHandle()
+{
+    pSlots    = NULL;
+    Capacity  = 0;
+    Used      = 0;
+    FreeHead  = LL_HANDLE_NONE;
+    FreeCount = 0;
+    Epoch     = 0;
+    RefCount  = 1;                               // The list that made it
+}
+
+LLHandle::~LLHandle()
+{
+    free(pSlots);
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Make slots below Needed usable.  The slot array doubles
+ *    until it is big enough.  A failure leaves the table as it was.
+ *------------------------------------------------------------------
+*/
+bool LLHandle::Grow(uint32_t Needed)
+{
+    uint32_t      NewCapacity = (Capacity == 0) ? LL_HANDLE_FIRSTSIZE : Capacity;
+    HandleSlot_t *pNewSlots;
+
+    if (Needed > LL_HANDLE_MAXSLOTS)
+    {
+        return false;
+    }
+
+    while (NewCapacity < Needed)
+    {
+        NewCapacity *= 2;
+    }
+
+    if (NewCapacity > Capacity)
+    {
+        if ((pNewSlots = (HandleSlot_t *) realloc(pSlots, NewCapacity * sizeof(HandleSlot_t))) == NULL)
+        {
+            return false;
+        }
+        pSlots   = pNewSlots;
+        Capacity = NewCapacity;
+    }
+    return true;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: A slot for pElement in the list of the owner record, off
+ *    the free list or the next one never used.  A new slot starts at generation 1 so a zeroed token
+ *    never matches.
+ *------------------------------------------------------------------
+*/
+uint32_t LLHandle::HandleAlloc(void *pElement, HandleOwner_t *pOwner)
+{
+    uint32_t  Slot;
+
+    if (FreeHead != LL_HANDLE_NONE)
+    {
+        Slot     = FreeHead;
+        FreeHead = pSlots[Slot].NextFree;
+        --FreeCount;
+    }
+    else
+    {
+        if (Used == Capacity && Grow(Used + 1) == false)
+        {
+            return LL_HANDLE_NONE;
+        }
+        Slot = Used++;
+        pSlots[Slot].Generation = 1;
+    }
+
+    pSlots[Slot].pElement = pElement;
+    pSlots[Slot].pOwner   = pOwner;
+    return Slot;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Room for Slots more slots.  Free slots are used first, so
+ *    only the ones past Used need room in the array.
+ *------------------------------------------------------------------
+*/
+bool LLHandle::HandleReserve(size_t Slots)
+{
+    size_t    Free = FreeCount;
+
+    if (Slots <= Free)
+    {
+        return true;
+    }
+    if (Used + (Slots - Free) > LL_HANDLE_MAXSLOTS)
+    {
+        return false;
+    }
+    return Grow((uint32_t)(Used + (Slots - Free)));
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Free every slot at once.  Only for a table no other list
+ *    holds - the list takes a new epoch with it, which is what turns
+ *    down the tokens from before, so the generations can start over.
+ *------------------------------------------------------------------
+*/
+void LLHandle::HandleClear(void)
+{
+    Used      = 0;
+    FreeHead  = LL_HANDLE_NONE;
+    FreeCount = 0;
+}
@@ -0,0 +1,129 @@
+/**--------------------------------------------------------------
+ * File: LLHandle.h
+ *
+ *  Author: Gregory Gannon
+ * Created: 10/17/2026
+ *---------------------------------------------------------------------
+ * HISTORY
+ *
+ *	 Date       Author      Change Description
+ *   ----		------		------------------
+ * 10/17/2026    GMG        Developed the handle table for the direct tokens
+ * 10/17/2026    GMG        HandlePrefetch() for ResolveTokens()
+ * 10/17/2026    GMG        HandleUsed() and HandleElement() so ParallelForEach() can split the table
+ * 10/17/2026    GMG        Slots record the list of the element, a splice hands them to the target
+ * 10/17/2026    GMG        Slots point to an owner record (HandleOwner_t) so a whole list splice
+ *                           re-points the records instead of every slot
+ *
+ * PURPOSE
+ *    Slot map used by the Linked list manager to check a DirectToken_t
+ *    without reading the element it names.  Every element in a classic
+ *    list has a slot.  The slot holds the element address and a
+ *    generation that goes up when the slot is freed, so a token is a
+ *    slot number and a generation and a stale one fails the compare in
+ *    the table.  Freed slots are handed out again first so the table
+ *    stays as big as the most elements the list has held.
+ *
+ *    A table belongs to one list epoch.  A list that takes in elements
+ *    by a splice holds the tables of their epochs (reference counted like
+ *    the slabs) so their tokens keep working on the new list.
+ *    The lists that share a table this way each look up their own
+ *    elements only.  Every slot points to an owner record that names the
+ *    list its element is in.  A splice of part of a list points the
+ *    slots it moves at the target's record, a splice of a whole list
+ *    points the records of the list at the target and leaves the slots.
+ *----------------------------------------------------------------------
+*/
+#ifndef LLHANDLE_H
+#define LLHANDLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define  LL_HANDLE_NONE         0xFFFFFFFF      // No slot - end of the free list or a failed allocation
+#define  LL_HANDLE_MAXSLOTS     0x7FFFFFFF      // Slots handed out at most
+#define  LL_HANDLE_FIRSTSIZE    1024            // Slots on the first allocation, doubles after
+
+#if defined(__GNUC__)
+#define  LL_PREFETCH(p)         __builtin_prefetch(p)       // Start the cache miss now - never faults
+#else
+#define  LL_PREFETCH(p)         ((void) 0)
+#endif
+
+/*
+ *----------------------------------------------------------------------
+ * Owner record - the list the elements of the slots pointing to it are
+ *      in.  The lists make and free them, a table only points to them.
+ *--------------------------------------------------------------------
+*/
+typedef struct {
+    void       *pList;                          /// The LLMgr the elements are in
+}  HandleOwner_t;
+
+/*
+ *----------------------------------------------------------------------
+ * One slot - pElement and pOwner are NULL while the slot is free
+ *--------------------------------------------------------------------
+*/
+typedef struct {
+    void       *pElement;                       /// Element using the slot
+    HandleOwner_t *pOwner;                      /// Record of the list the element is in
+    uint32_t    Generation;                     /// Goes up every time the slot is freed
+    uint32_t    NextFree;                       /// Free list link while the slot is free
+}  HandleSlot_t;
+
+class  LLHandle
+{
+  protected:
+
+    HandleSlot_t *pSlots;
+    uint32_t      Capacity;                     /// Entries in pSlots
+    uint32_t      Used;                         /// Slots handed out so far
+    uint32_t      FreeHead;                     /// First free slot below Used
+    uint32_t      FreeCount;                    /// Slots on the free list
+
+    bool          Grow(uint32_t);               /// Room for slots below n
+
+  public:
+    uint32_t      Epoch;                        /// List epoch of the elements with slots here
+    long          RefCount;                     /// The owning list plus every list holding elements from this table
+
+    uint32_t      HandleAlloc(void *, HandleOwner_t *);  /// Slot for an element of a list or LL_HANDLE_NONE
+    bool          HandleReserve(size_t);        /// Room for n more slots without an allocation
+    void          HandleClear(void);            /// Every slot free - the storage is kept
+    void          HandleHold(void) { ++RefCount; }
+    bool          HandleDrop(void) { return --RefCount == 0; }        /// True when the caller should delete the table
+
+/*
+ *----------------------------------------------------------------------
+ * Free and the token check are on the delete and SetDirectPointer()
+ *      paths so they are inline.  HandleLookup() returns the element
+ *      or NULL for a slot that is out of range, free or reused, or an
+ *      element another list owns.
+ *--------------------------------------------------------------------
+*/
+    void          HandleFree(uint32_t Slot)
+                  {
+                      pSlots[Slot].pElement = NULL;
+                      pSlots[Slot].pOwner   = NULL;
+                      ++pSlots[Slot].Generation;
+                      pSlots[Slot].NextFree = FreeHead;
+                      FreeHead              = Slot;
+                      ++FreeCount;
+                  }
+    void          HandleOwn(uint32_t Slot, HandleOwner_t *pOwner) { pSlots[Slot].pOwner = pOwner; }  /// The element was spliced
+    uint32_t      HandleGeneration(uint32_t Slot) { return pSlots[Slot].Generation; }
+    void          HandlePrefetch(uintptr_t Slot)  { if (Slot < Used) LL_PREFETCH(&pSlots[Slot]); }
+    uint32_t      HandleUsed(void) { return Used; }                   /// Slots 0 to n - 1 have been handed out
+    void         *HandleElement(uint32_t Slot) { return pSlots[Slot].pElement; }     /// NULL for a free slot
+    void         *HandleLookup(uintptr_t Slot, uint32_t Generation, const void *pList)
+                  {
+                      return (Slot < Used && pSlots[Slot].Generation == Generation && pSlots[Slot].pOwner != NULL
+                              && pSlots[Slot].pOwner->pList == pList)
+                             ? pSlots[Slot].pElement : NULL;
+                  }
+                  LLHandle();
+                  ~LLHandle();
+};
+
+#endif
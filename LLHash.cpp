@@ -0,0 +1,428 @@
+/**----------------------------------------------------------------
+ * File:LLHash.cpp
+ *
+ * Author: Gregory Gannon
+ *
+ * PURPOSE
+ *
+ *  Hash index used by the Linked list manager for ListFind().  Linear
+ *    probing over a power of 2 table of (hash, element) pairs.  A growth
+ *    is spread over the inserts that follow it: the bigger table is
+ *    cleared a piece at a time, then the old table is emptied into it
+ *    a few slots at a time.
+ *
+ * UPDATES:
+ *
+ * GMG   10-17-2026    Created for the list hash index.
+ *-------------------------------------------------------------
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "LLHash.h"
+
+//--------------------------------------------------------------------
+// Constructor - no table until the first insert or reserve
+//--------------------------------------------------------------------
+
+LLHash::LLHash()
+{
+    pTable      = NULL;
+    Mask        = 0;
+    Count       = 0;
+    pOldTable   = NULL;
+    OldMask     = 0;
+    OldCount    = 0;
+    MigrateSlot = 0;
+    pNextTable  = NULL;
+    NextSlots   = 0;
+    ClearedSlots = 0;
+}
+
+LLHash::~LLHash()
+{
+    HashClear();
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: True when Entries would put a table of Slots over the
+ *    load limit.
+ *------------------------------------------------------------------
+*/
+bool LLHash::TableFull(size_t Entries, size_t Slots)
+{
+    return Entries * 100 > Slots * LL_HASH_LOADPCT;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Put an entry in the first free slot from its home slot.
+ *    There is always a free slot, the load limit sees to that.
+ *------------------------------------------------------------------
+*/
+void LLHash::TablePut(HashEntry_t *pSlots, size_t SlotMask, uint64_t Hash, void *pElement)
+{
+    size_t  i = (size_t) Hash & SlotMask;
+
+    while (pSlots[i].pElement != NULL)
+    {
+        i = (i + 1) & SlotMask;
+    }
+    pSlots[i].Hash     = Hash;
+    pSlots[i].pElement = pElement;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Empty a slot and shift back the entries after it that
+ *    would no longer be found past the hole.  An entry can fill the
+ *    hole when its home slot is not between the hole and where it
+ *    sits now.  Stops at the first empty slot.
+ *------------------------------------------------------------------
+*/
+void LLHash::TableErase(HashEntry_t *pSlots, size_t SlotMask, size_t Slot)
+{
+    size_t  Hole = Slot;
+    size_t  j    = Slot;
+    size_t  Home;
+
+    pSlots[Hole].pElement = NULL;
+
+    for (;;)
+    {
+        j = (j + 1) & SlotMask;
+
+        if (pSlots[j].pElement == NULL)
+        {
+            return;
+        }
+
+        Home = (size_t) pSlots[j].Hash & SlotMask;
+
+        if (((j - Home) & SlotMask) >= ((j - Hole) & SlotMask))     // Home is at or before the hole
+        {
+            pSlots[Hole]          = pSlots[j];
+            pSlots[j].pElement    = NULL;
+            Hole                  = j;
+        }
+    }
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Allocate a cleared table of Slots and switch to it now.
+ *    Used for the first table and by HashReserve().
+ *------------------------------------------------------------------
+*/
+bool LLHash::HashResize(size_t Slots)
+{
+    HashEntry_t *pNew;
+
+    if ((pNew = (HashEntry_t *) calloc(Slots, sizeof(HashEntry_t))) == NULL)
+    {
+        return false;
+    }
+
+    HashSwitch(pNew, Slots);
+    return true;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Make the cleared table pNew current.  The current table
+ *    becomes the old table and is emptied by HashMigrate().  Any old
+ *    table still around is finished first.  The migration starts just
+ *    after an empty slot so it never begins in the middle of a run of
+ *    full slots.
+ *------------------------------------------------------------------
+*/
+void LLHash::HashSwitch(HashEntry_t *pNew, size_t Slots)
+{
+    HashMigrate(OldMask + 1);                                   // No more than two tables at a time
+
+    if (Count == 0)
+    {
+        free(pTable);
+    }
+    else
+    {
+        pOldTable   = pTable;
+        OldMask     = Mask;
+        OldCount    = Count;
+        MigrateSlot = 0;
+
+        while (pOldTable[MigrateSlot].pElement != NULL)         // There is always an empty slot
+        {
+            ++MigrateSlot;
+        }
+        MigrateSlot = (MigrateSlot + 1) & OldMask;
+    }
+
+    pTable = pNew;
+    Mask   = Slots - 1;
+    Count  = 0;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Clear up to Slots more slots of the next table.  A table
+ *    from calloc() can cost a long memset() in one call, so the next
+ *    table comes from malloc() and is cleared here a piece per insert.
+ *    When it is all clear it becomes the current table.
+ *------------------------------------------------------------------
+*/
+void LLHash::HashGrow(size_t Slots)
+{
+    if (pNextTable == NULL)
+    {
+        return;
+    }
+
+    if (Slots > NextSlots - ClearedSlots)
+    {
+        Slots = NextSlots - ClearedSlots;
+    }
+    memset(pNextTable + ClearedSlots, 0, Slots * sizeof(HashEntry_t));
+    ClearedSlots += Slots;
+
+    if (ClearedSlots == NextSlots)
+    {
+        HashSwitch(pNextTable, NextSlots);
+        pNextTable = NULL;
+    }
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Move the entries of about Slots old table slots into the
+ *    current table.  A run of full slots is always moved as a whole:
+ *    a lookup never probes past an empty slot, so taking out a whole
+ *    run leaves every other entry of the old table where it can be
+ *    found, and nothing has to be shifted.  The old table is freed
+ *    when its last entry has moved.
+ *------------------------------------------------------------------
+*/
+void LLHash::HashMigrate(size_t Slots)
+{
+    HashEntry_t *pEntry;
+
+    while (pOldTable != NULL && Slots > 0)
+    {
+        pEntry = &pOldTable[MigrateSlot];
+
+        if (pEntry->pElement == NULL)
+        {
+            --Slots;
+        }
+
+        while (pEntry->pElement != NULL)                        // The whole run
+        {
+            TablePut(pTable, Mask, pEntry->Hash, pEntry->pElement);
+            pEntry->pElement = NULL;
+            ++Count;
+            --OldCount;
+            Slots       = (Slots > 0) ? Slots - 1 : 0;
+            MigrateSlot = (MigrateSlot + 1) & OldMask;
+            pEntry      = &pOldTable[MigrateSlot];
+        }
+        MigrateSlot = (MigrateSlot + 1) & OldMask;
+
+        if (OldCount == 0)
+        {
+            free(pOldTable);
+            pOldTable = NULL;
+            OldMask   = 0;
+        }
+    }
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Add an element.  When the table passes the load limit a
+ *    table twice the size is allocated and HashGrow() clears it over
+ *    the next inserts.  The current table takes the inserts until then
+ *    and the clear is finished at once if it gets to LL_HASH_FULLPCT.
+ *    If the bigger table can't be had the element still goes in as
+ *    long as a slot would be left empty.
+ *------------------------------------------------------------------
+*/
+bool LLHash::HashInsert(uint64_t Hash, void *pElement)
+{
+    size_t  Entries = Count + OldCount + 1;
+
+    if (pTable == NULL)
+    {
+        if (HashResize(LL_HASH_MINSLOTS) == false)
+        {
+            return false;
+        }
+    }
+    else if (TableFull(Entries, Mask + 1) == true)
+    {
+        if (pNextTable == NULL)
+        {
+            NextSlots    = (Mask + 1) * 2;
+            ClearedSlots = 0;
+            pNextTable   = (HashEntry_t *) malloc(NextSlots * sizeof(HashEntry_t));
+        }
+
+        if (pNextTable == NULL && Entries + 1 > Mask + 1)
+        {
+            return false;
+        }
+
+        if (Entries * 100 > (Mask + 1) * LL_HASH_FULLPCT)
+        {
+            HashGrow(NextSlots);
+        }
+    }
+
+    TablePut(pTable, Mask, Hash, pElement);
+    ++Count;
+
+    HashMigrate(LL_HASH_MIGRATE);
+    HashGrow(LL_HASH_CLEARSLOTS);
+    return true;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Remove the entry for pElement.  Looks in the current
+ *    table then the old one.
+ *------------------------------------------------------------------
+*/
+bool LLHash::HashErase(uint64_t Hash, void *pElement)
+{
+    size_t  i;
+
+    if (pTable == NULL)
+    {
+        return false;
+    }
+
+    for (i = (size_t) Hash & Mask; pTable[i].pElement != NULL; i = (i + 1) & Mask)
+    {
+        if (pTable[i].pElement == pElement)
+        {
+            TableErase(pTable, Mask, i);
+            --Count;
+            HashMigrate(LL_HASH_MIGRATE);
+            return true;
+        }
+    }
+
+    if (pOldTable != NULL)
+    {
+        for (i = (size_t) Hash & OldMask; pOldTable[i].pElement != NULL; i = (i + 1) & OldMask)
+        {
+            if (pOldTable[i].pElement == pElement)
+            {
+                TableErase(pOldTable, OldMask, i);
+                --OldCount;
+                HashMigrate(LL_HASH_MIGRATE);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Make room for Entries without any growth later.  This is
+ *    asked for up front so the table is resized and filled in one go.
+ *------------------------------------------------------------------
+*/
+bool LLHash::HashReserve(size_t Entries)
+{
+    size_t  Slots = LL_HASH_MINSLOTS;
+
+    while (TableFull(Entries, Slots) == true)
+    {
+        Slots *= 2;
+    }
+
+    if (pTable != NULL && Slots <= Mask + 1)
+    {
+        return true;
+    }
+
+    free(pNextTable);                                           // Going straight to the bigger table
+    pNextTable = NULL;
+
+    if (HashResize(Slots) == false)
+    {
+        return false;
+    }
+    HashMigrate(OldMask + 1);
+    return true;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Find the elements with a hash.  HashFirst() starts at the
+ *    home slot in the current table, HashNext() carries on from the
+ *    last one found.  The old table is searched after the current one.
+ *    Nothing may be inserted or erased between the calls.
+ *------------------------------------------------------------------
+*/
+void *LLHash::HashFirst(uint64_t Hash, HashProbe_t *pProbe)
+{
+    if (pTable == NULL)
+    {
+        return NULL;
+    }
+
+    pProbe->Table = 0;
+    pProbe->Slot  = ((size_t) Hash & Mask) - 1;                 // HashNext() steps on to the home slot
+
+    return HashNext(Hash, pProbe);
+}
+
+void *LLHash::HashNext(uint64_t Hash, HashProbe_t *pProbe)
+{
+    HashEntry_t *pSlots   = (pProbe->Table == 0) ? pTable : pOldTable;
+    size_t       SlotMask = (pProbe->Table == 0) ? Mask : OldMask;
+
+    for (;;)
+    {
+        pProbe->Slot = (pProbe->Slot + 1) & SlotMask;
+
+        if (pSlots[pProbe->Slot].pElement == NULL)
+        {
+            if (pProbe->Table != 0 || pOldTable == NULL)
+            {
+                return NULL;
+            }
+            pProbe->Table = 1;                                  // On to the old table
+            pSlots        = pOldTable;
+            SlotMask      = OldMask;
+            pProbe->Slot  = ((size_t) Hash & OldMask) - 1;
+        }
+        else if (pSlots[pProbe->Slot].Hash == Hash)
+        {
+            return pSlots[pProbe->Slot].pElement;
+        }
+    }
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Free both tables.  The next insert starts a small table.
+ *------------------------------------------------------------------
+*/
+void LLHash::HashClear(void)
+{
+    free(pTable);
+    free(pOldTable);
+    free(pNextTable);
+
+    pTable     = NULL;
+    pOldTable  = NULL;
+    pNextTable = NULL;
+    Mask      = 0;
+    OldMask   = 0;
+    Count     = 0;
+    OldCount  = 0;
+}
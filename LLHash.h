@@ -0,0 +1,99 @@
+/**--------------------------------------------------------------
+ * File: LLHash.h
+ *
+ *  Author: Gregory Gannon
+ * Created: 10/17/2026
+ *---------------------------------------------------------------------
+ * HISTORY
+ *
+ *	 Date       Author      Change Description
+ *   ----		------		------------------
+ * 10/17/2026    GMG        Developed the hash index for ListFind()
+ *
+ * PURPOSE
+ *    Open addressing hash table of element pointers used by the Linked
+ *    list manager to find an element by key.  The table does not know
+ *    about keys, it keeps the 64 bit hash next to each element pointer
+ *    and hands back the elements with a matching hash.  The caller
+ *    compares the keys.
+ *
+ *    Probing is linear so a lookup reads neighbouring entries from the
+ *    same cache lines.  Deletes shift the entries behind the hole back
+ *    instead of leaving tombstones.
+ *
+ *    Growth is incremental.  When the table gets too full a table twice
+ *    the size is allocated and cleared a piece per insert, then new
+ *    entries go there.  Every insert and erase after that moves a few
+ *    entries from the old table until it is empty, so no single add pays
+ *    for clearing or rehashing the whole index.
+ *----------------------------------------------------------------------
+*/
+#ifndef LLHASH_H
+#define LLHASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define  LL_HASH_MINSLOTS     16                // Smallest table
+#define  LL_HASH_LOADPCT      70                // Grow when the entries pass this percent of the slots
+#define  LL_HASH_FULLPCT      90                // Stop clearing a piece at a time - the next table is needed now
+#define  LL_HASH_MIGRATE      16                // Old table slots moved on each insert or erase
+#define  LL_HASH_CLEARSLOTS   256               // Next table slots cleared on each insert
+
+/*
+ *----------------------------------------------------------------------
+ * One slot of the table.  A NULL element is an empty slot.
+ *--------------------------------------------------------------------
+*/
+typedef struct {
+    uint64_t  Hash;                             /// Hash of the element key
+    void     *pElement;                         /// List element - the ListPointers_t address
+}  HashEntry_t;
+
+/*
+ *----------------------------------------------------------------------
+ * Where HashFirst() / HashNext() are in the search.  Table 0 is the
+ *      current table, table 1 the old one while it is being emptied.
+ *--------------------------------------------------------------------
+*/
+typedef struct {
+    int       Table;
+    size_t    Slot;
+}  HashProbe_t;
+
+class  LLHash
+{
+  protected:
+
+    HashEntry_t *pTable;                        /// Current table - inserts go here
+    size_t       Mask;                          /// Slots in pTable - 1, slots are a power of 2
+    size_t       Count;                         /// Entries in pTable
+    HashEntry_t *pOldTable;                     /// Table being emptied into pTable, NULL when not growing
+    size_t       OldMask;
+    size_t       OldCount;                      /// Entries still in pOldTable
+    size_t       MigrateSlot;                   /// Next old table slot to move
+    HashEntry_t *pNextTable;                    /// Bigger table being cleared, NULL when not growing
+    size_t       NextSlots;
+    size_t       ClearedSlots;                  /// Slots of pNextTable cleared so far
+
+    bool         HashResize(size_t);            /// Start using a new table of n slots
+    void         HashSwitch(HashEntry_t *, size_t); /// Make a cleared table current
+    void         HashGrow(size_t);              /// Clear more of the next table
+    void         HashMigrate(size_t);           /// Move entries out of the old table
+    static void  TablePut(HashEntry_t *, size_t, uint64_t, void *);
+    static void  TableErase(HashEntry_t *, size_t, size_t);
+    static bool  TableFull(size_t, size_t);
+
+  public:
+    bool         HashInsert(uint64_t, void *);      /// Add an element - false only when no slot can be had
+    bool         HashErase(uint64_t, void *);       /// Remove this element - false when it is not in the table
+    bool         HashReserve(size_t);               /// Size the table for n entries now
+    void        *HashFirst(uint64_t, HashProbe_t *);/// First element with the hash or NULL
+    void        *HashNext(uint64_t, HashProbe_t *); /// Next element with the hash or NULL
+    void         HashClear(void);                   /// Drop every entry and the tables
+    size_t       HashCount(void) { return Count + OldCount; }
+                 LLHash();
+                 ~LLHash();
+};
+
+#endif
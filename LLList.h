@@ -0,0 +1,179 @@
+/**--------------------------------------------------------------
+ * File: LLList.h
+ *
+ *  Author: Gregory Gannon
+ * Created: 10/17/2026
+ *---------------------------------------------------------------------
+ * HISTORY
+ *
+ *	 Date       Author      Change Description
+ *   ----		------		------------------
+ * 10/17/2026    GMG        Developed the typed front end LLList<T>
+ * 10/17/2026    GMG        Typed iterators on LLCursor, begin()/end() and ListPointCursor()
+ * 10/17/2026    GMG        ListDeleteAll() skips the destructor walk on an empty or unregistered list
+ *
+ * PURPOSE
+ *    Typed list on top of the Linked list manager.  The element length is
+ *    sizeof(T) at compile time and an element is a T built where it
+ *    lives, so nothing is copied in through pUserAddBuffer or out of
+ *    pUserCurrentElement and types with constructors and destructors
+ *    (std::string members and the like) are handled properly.
+ *
+ *    On a classic list an add links the add buffer itself into the list,
+ *    so emplace_back() builds the T in the add buffer and that storage
+ *    becomes the element.  The unrolled and dense layouts copy a record
+ *    in on an add and move records with memcpy(), so they are only
+ *    allowed for trivially copyable types.
+ *
+ *    ListDelete() and ListDeleteAll() run the destructor of the elements
+ *    they take out and the list is emptied when it goes away.  The
+ *    LLMgr underneath is Mgr - status, tokens, splices and ListSort()
+ *    are used from there.  An element must not be deleted through Mgr,
+ *    its destructor would not run.
+ *----------------------------------------------------------------------
+*/
+#ifndef LLLIST_H
+#define LLLIST_H
+
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "LLMgr.h"
+
+template <class T, int Options = LL_OPTION_NONE> class  LLList
+{
+    static_assert(sizeof(T) <= 8192, "LLList element is bigger than a list element can be");
+    static_assert(std::is_trivially_copyable<T>::value || (Options & (LL_OPTION_UNROLLED | LL_OPTION_DENSE)) == 0,
+                  "The unrolled and dense layouts copy records - the element type must be trivially copyable");
+    static_assert(alignof(T) <= ((Options & (LL_OPTION_UNROLLED | LL_OPTION_DENSE)) ? 8 : LL_SLAB_ALIGN),
+                  "LLList element needs more alignment than the layout gives");
+
+  protected:
+
+/*
+ *--------------------------------------------------------------------
+ * Build a T in the add buffer and add it with one of the LLMgr adds.
+ *    If the add fails the T is destroyed again and the add buffer is
+ *    left as it was.  An exception from the constructor leaves the
+ *    list as it was.
+ *------------------------------------------------------------------
+*/
+    template <class... Args> bool Emplace(bool (LLMgr::*pAdd)(void), Args&&... Arguments)
+    {
+        T   *pNew;
+
+        if (Mgr.pUserAddBuffer == NULL)
+        {
+            return (Mgr.*pAdd)();                       // Not registered - LLMgr sets the status
+        }
+
+        pNew = ::new (Mgr.pUserAddBuffer) T(std::forward<Args>(Arguments)...);
+
+        if ((Mgr.*pAdd)() == false)
+        {
+            pNew->~T();
+            return false;
+        }
+        return true;
+    }
+
+  public:
+    LLMgr       Mgr;                                /// The list underneath
+
+/*
+ *--------------------------------------------------------------------
+ * Iterator - an LLCursor that gives a T.  Range-for and <algorithm>
+ *    walk the list with it and leave the current element alone.
+ *------------------------------------------------------------------
+*/
+    class iterator : public LLCursor
+    {
+      public:
+        typedef T    value_type;
+        typedef T   *pointer;
+        typedef T   &reference;
+
+        T          &operator*() const { return *std::launder(static_cast<T *>(Element())); }
+        T          *operator->() const { return std::launder(static_cast<T *>(Element())); }
+        iterator   &operator++() { LLCursor::operator++(); return *this; }
+        iterator   &operator--() { LLCursor::operator--(); return *this; }
+        iterator    operator++(int) { iterator Was = *this; LLCursor::operator++(); return Was; }
+        iterator    operator--(int) { iterator Was = *this; LLCursor::operator--(); return Was; }
+
+                    iterator() {}
+                    iterator(const LLCursor &Cursor) : LLCursor(Cursor) {}
+    };
+
+    iterator    begin(void) { return iterator(Mgr.begin()); }
+    iterator    end(void)   { return iterator(Mgr.end()); }
+    bool        ListPointCursor(const LLCursor &Cursor) { return Mgr.ListPointCursor(Cursor); }
+
+    bool        ListRegister(std::string Name)      /// Element length is sizeof(T)
+                { return Mgr.ListRegister((long) sizeof(T), Name, Options); }
+    bool        ListDeregister(void) { return Mgr.ListDeregister(); }
+
+    template <class... Args> bool emplace_back(Args&&... Arguments)     /// Build a T at the end of the list
+                { return Emplace(&LLMgr::ListAddEnd, std::forward<Args>(Arguments)...); }
+    template <class... Args> bool emplace_after(Args&&... Arguments)    /// Build a T after the current element
+                { return Emplace(&LLMgr::ListAddAfter, std::forward<Args>(Arguments)...); }
+    template <class... Args> bool emplace_before(Args&&... Arguments)   /// Build a T before the current element
+                { return Emplace(&LLMgr::ListAddBefore, std::forward<Args>(Arguments)...); }
+    bool        push_back(const T &Value) { return emplace_back(Value); }
+    bool        push_back(T &&Value)      { return emplace_back(std::move(Value)); }
+
+    T          &Current(void)                       /// The current element - the list must not be empty
+                { return *std::launder(static_cast<T *>(Mgr.pUserCurrentElement)); }
+    long        size(void) { return Mgr.ElementCount; }
+    bool        empty(void) { return Mgr.ElementCount == 0; }
+
+    bool        ListPointTop(void)    { return Mgr.ListPointTop(); }
+    bool        ListPointBottom(void) { return Mgr.ListPointBottom(); }
+    bool        ListPointNext(void)   { return Mgr.ListPointNext(); }
+    bool        ListPointLast(void)   { return Mgr.ListPointLast(); }
+    bool        ListReserve(long Count) { return Mgr.ListReserve(Count); }
+
+/*
+ *--------------------------------------------------------------------
+ * Delete the current element.  It is destroyed first, an empty list
+ *    goes straight to LLMgr for the status.
+ *------------------------------------------------------------------
+*/
+    bool        ListDelete(void)
+    {
+        if (Mgr.ElementCount > 0 && Mgr.pUserCurrentElement != NULL)
+        {
+            Current().~T();
+        }
+        return Mgr.ListDelete();
+    }
+
+/*
+ *--------------------------------------------------------------------
+ * Destroy every element then let LLMgr drop the storage in one step.
+ *    Types with a trivial destructor skip the walk, and so does an
+ *    empty or unregistered list - ListPointTop() is true on those too.
+ *------------------------------------------------------------------
+*/
+    bool        ListDeleteAll(void)
+    {
+        if constexpr (std::is_trivially_destructible<T>::value == false)
+        {
+            if (Mgr.ElementCount > 0 && Mgr.ListPointTop() == true)
+            {
+                do
+                {
+                    Current().~T();
+                } while (Mgr.ListPointNext() == true);
+            }
+        }
+        return Mgr.ListDeleteAll();
+    }
+
+                LLList() {}
+                ~LLList() { ListDeleteAll(); }
+                LLList(const LLList &) = delete;
+                LLList &operator=(const LLList &) = delete;
+};
+
+#endif
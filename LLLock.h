@@ -0,0 +1,181 @@
+/**--------------------------------------------------------------
+ * File: LLLock.h
+ *
+ *  Author: Gregory Gannon
+ * Created: 10/17/2026
+ *---------------------------------------------------------------------
+ * HISTORY
+ *
+ *	 Date       Author      Change Description
+ *   ----		------		------------------
+ * 10/17/2026    GMG        Developed the list lock for LL_OPTION_THREADSAFE
+ * 10/17/2026    GMG        LockShare() - a process-shared mutex taken with the lock for a list in
+ *                           shared memory
+ *
+ * PURPOSE
+ *    Reader/writer lock used by the Linked list manager for a list that is
+ *    shared between threads.  Any number of threads can hold it shared to
+ *    walk the list with cursors, one thread holds it exclusive to change it.
+ *
+ *    A thread can take it again while it holds it, so a caller can hold
+ *    ListWriteLock() or ListReadLock() across a run of list calls that
+ *    each lock on their own.  The writer is known by its thread id, the
+ *    shared holds of a thread are counted in a short thread_local list.
+ *    A thread holding it shared must not ask for it exclusive - that
+ *    waits on itself.
+ *
+ *    It has lock(), unlock(), lock_shared() and unlock_shared(), so
+ *    std::unique_lock and std::shared_lock work with it.
+ *
+ *    A list in shared memory gives the lock its process-shared robust
+ *    mutex with LockShare().  The first hold of the thread that gets
+ *    the lock takes that mutex too and the last one lets it go, and
+ *    every hold is exclusive - a robust mutex has no shared mode.  The
+ *    hook is called each time the mutex is taken, told whether the
+ *    process that had it died holding it, so the list can undo what
+ *    that process left part done and catch up with what the others
+ *    changed.
+ *----------------------------------------------------------------------
+*/
+#ifndef LLLOCK_H
+#define LLLOCK_H
+
+#include <atomic>
+#include <errno.h>
+#include <pthread.h>
+#include <shared_mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+typedef void (*LockHook_t)(void *, bool);      /// Called holding the process mutex - true when its owner died with it
+
+class  LLLock
+{
+  protected:
+
+    std::shared_mutex             Mutex;
+    std::atomic<std::thread::id>  Writer;       /// Thread holding it exclusive - only that thread can see itself here
+    long                          Depth;        /// Times the writer has it - only the writer touches this
+    pthread_mutex_t              *pProcess;     /// Mutex of a list in shared memory - NULL in one process
+    LockHook_t                    pHook;
+    void                         *pHookArg;
+
+    void          ProcessLock(void)
+                  {
+                      if (pthread_mutex_lock(pProcess) == EOWNERDEAD)
+                      {
+                          pHook(pHookArg, true);
+                          pthread_mutex_consistent(pProcess);
+                      }
+                      else
+                      {
+                          pHook(pHookArg, false);
+                      }
+                  }
+
+    bool          Mine(void) { return Writer.load(std::memory_order_relaxed) == std::this_thread::get_id(); }
+
+    static std::vector<std::pair<LLLock *, long>> &Readers(void)      /// Shared holds of this thread - lock and count
+                  {
+                      static thread_local std::vector<std::pair<LLLock *, long>>  Held;
+                      return Held;
+                  }
+    long         *ReadCount(void)              /// Count of this thread's shared holds, NULL if none
+                  {
+                      for (std::pair<LLLock *, long> &Entry : Readers())
+                      {
+                          if (Entry.first == this)
+                          {
+                              return &Entry.second;
+                          }
+                      }
+                      return NULL;
+                  }
+
+  public:
+
+    void          lock(void)
+                  {
+                      if (Mine() == true)
+                      {
+                          ++Depth;
+                          return;
+                      }
+                      Mutex.lock();
+                      if (pProcess != NULL)
+                      {
+                          ProcessLock();
+                      }
+                      Writer.store(std::this_thread::get_id(), std::memory_order_relaxed);
+                      Depth = 1;
+                  }
+    void          unlock(void)
+                  {
+                      if (--Depth == 0)
+                      {
+                          Writer.store(std::thread::id(), std::memory_order_relaxed);
+                          if (pProcess != NULL)
+                          {
+                              pthread_mutex_unlock(pProcess);
+                          }
+                          Mutex.unlock();
+                      }
+                  }
+    void          lock_shared(void)             /// The writer counts it as one more exclusive hold
+                  {
+                      long  *pCount;
+
+                      if (Mine() == true)
+                      {
+                          ++Depth;
+                          return;
+                      }
+                      if (pProcess != NULL)                   // Shared memory - exclusive, unlock_shared() finds it Mine()
+                      {
+                          lock();
+                          return;
+                      }
+                      if ((pCount = ReadCount()) != NULL)
+                      {
+                          ++*pCount;
+                          return;
+                      }
+                      Mutex.lock_shared();
+                      Readers().push_back(std::make_pair(this, 1L));
+                  }
+    void          unlock_shared(void)
+                  {
+                      std::vector<std::pair<LLLock *, long>>  &Held = Readers();
+
+                      if (Mine() == true)
+                      {
+                          unlock();
+                          return;
+                      }
+                      for (size_t i = 0; i < Held.size(); ++i)
+                      {
+                          if (Held[i].first == this)
+                          {
+                              if (--Held[i].second == 0)          // Last hold of this thread
+                              {
+                                  Held[i] = Held.back();
+                                  Held.pop_back();
+                                  Mutex.unlock_shared();
+                              }
+                              return;
+                          }
+                      }
+                  }
+    void          LockShare(pthread_mutex_t *pMutex, LockHook_t Hook, void *pArg)   /// Set while nothing holds the lock
+                  {
+                      pProcess = pMutex;
+                      pHook    = Hook;
+                      pHookArg = pArg;
+                  }
+                  LLLock() : Writer(std::thread::id()), Depth(0), pProcess(NULL), pHook(NULL), pHookArg(NULL) {}
+                  LLLock(const LLLock &) = delete;
+                  LLLock &operator=(const LLLock &) = delete;
+};
+
+#endif
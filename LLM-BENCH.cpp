@@ -0,0 +1,2050 @@
+// LLM-BENCH.cpp : This file contains the 'main' function. Program execution FOR TIMINGS
+//      Run with no arguments for every benchmark or pass the names of the ones wanted.
+//      Each benchmark prints nano seconds per operation.  The program returns 0 unless
+//      a benchmark with a pass/fail check fails.
+//
+
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <string.h>
+#include <stdlib.h>
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <shared_mutex>
+#include <atomic>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include "LLMgr.h"
+#include "LLList.h"
+#include "LLShard.h"
+
+using namespace std;
+
+#define  BENCH_PAYLOAD   64                     // User data area used by the benchmarks
+
+static double ElapsedNs(std::chrono::steady_clock::time_point);    // Nano seconds since the start time
+
+/*
+*   Socket style churn - a window of live elements where the oldest is freed and a new one
+*       allocated.  The slab and the heap are given exactly the same pattern.
+*/
+static bool BenchSlab(void)
+{
+    const long  Window = 1024;
+    const long  Ops    = 10000000;
+    size_t      Length = BENCH_PAYLOAD + sizeof(ListPointers_t);
+    void*       Live[1024];
+    LLSlab      Slab;
+
+    std::cout << "\n\n***************************  BEGIN SLAB BENCHMARK *****************************\n";
+
+    for (long i = 0; i < Window; ++i)
+    {
+        Live[i] = malloc(Length);
+    }
+    auto Start = std::chrono::steady_clock::now();
+    for (long i = 0; i < Ops; ++i)
+    {
+        free(Live[i % Window]);
+        Live[i % Window] = malloc(Length);
+        *(long*)Live[i % Window] = i;
+    }
+    double MallocNs = ElapsedNs(Start) / Ops;
+    for (long i = 0; i < Window; ++i)
+    {
+        free(Live[i]);
+    }
+
+    Slab.SlabInit(Length);
+    Slab.SlabReserve(Window);
+    for (long i = 0; i < Window; ++i)
+    {
+        Live[i] = Slab.SlabAlloc();
+    }
+    Start = std::chrono::steady_clock::now();
+    for (long i = 0; i < Ops; ++i)
+    {
+        Slab.SlabFree(Live[i % Window]);
+        Live[i % Window] = Slab.SlabAlloc();
+        *(long*)Live[i % Window] = i;
+    }
+    double SlabNs = ElapsedNs(Start) / Ops;
+
+    std::cout << "\n   malloc()/free() pair   ns/op: " << MallocNs
+              << "\n   SlabAlloc()/SlabFree() ns/op: " << SlabNs;
+
+    //
+    //  Same churn through the list - delete the top element and add one at the end
+    //
+    LLMgr  List;
+    List.ListRegister(BENCH_PAYLOAD, "Slab churn");
+    List.ListReserve(Window);
+    for (long i = 0; i < Window; ++i)
+    {
+        List.ListAddEnd();
+    }
+    Start = std::chrono::steady_clock::now();
+    for (long i = 0; i < Ops; ++i)
+    {
+        List.ListPointTop();
+        List.ListDelete();
+        *(long*)List.pUserAddBuffer = i;
+        List.ListAddEnd();
+    }
+    std::cout << "\n   ListDelete()/ListAddEnd() ns/op: " << ElapsedNs(Start) / Ops << "\n";
+    List.ListDeleteAll();
+    List.ListDeregister();
+
+    return true;
+}
+
+/*
+*   Tear down a large list - ListDeleteAll() against calling ListDelete() for every element.
+*       Both lists are built with ListAddAfter() at the bottom.
+*/
+static bool BenchDeleteAll(void)
+{
+    const long  Count = 1000000;
+    LLMgr       List;
+
+    std::cout << "\n\n***************************  BEGIN DELETE ALL BENCHMARK *****************************\n";
+
+    List.ListRegister(BENCH_PAYLOAD, "Delete all");
+
+    for (int Pass = 0; Pass < 2; ++Pass)
+    {
+        List.ListReserve(Count);
+        for (long i = 0; i < Count; ++i)
+        {
+            *(long*)List.pUserAddBuffer = i;
+            List.ListAddAfter();
+        }
+
+        auto Start = std::chrono::steady_clock::now();
+        if (Pass == 0)
+        {
+            List.ListPointTop();
+            while (List.ListDelete() == true);
+            std::cout << "\n   ListDelete() loop  " << Count << " elements ms: " << ElapsedNs(Start) / 1e6;
+        }
+        else
+        {
+            List.ListDeleteAll();
+            std::cout << "\n   ListDeleteAll()    " << Count << " elements ms: " << ElapsedNs(Start) / 1e6 << "\n";
+        }
+    }
+    List.ListDeregister();
+
+    return true;
+}
+
+/*
+*   Per call cost of the navigation methods.  Every call sets the status block so this
+*       is mostly the cost of the status reporting.  GetStatus() is timed as well.
+*/
+static bool BenchStatus(void)
+{
+    const long  Count = 1000;
+    const long  Ops   = 10000000;
+    LLMgr       List;
+    long        Moves = 0;
+
+    std::cout << "\n\n***************************  BEGIN STATUS BENCHMARK *****************************\n";
+
+    List.ListRegister(BENCH_PAYLOAD, "Status");
+    for (long i = 0; i < Count; ++i)
+    {
+        List.ListAddAfter();
+    }
+
+    List.ListPointTop();
+    auto Start = std::chrono::steady_clock::now();
+    for (long i = 0; i < Ops; ++i)
+    {
+        if (List.ListPointNext() == false)                  // Failure at the bottom sets the fail status
+        {
+            List.ListPointTop();
+        }
+        ++Moves;
+    }
+    std::cout << "\n   ListPointNext()      ns/call: " << ElapsedNs(Start) / Moves;
+
+    Start = std::chrono::steady_clock::now();
+    size_t Length = 0;
+    for (long i = 0; i < Ops / 10; ++i)
+    {
+        List.ListPointTop();
+        Length += List.GetStatus().Scommand.length();
+    }
+    std::cout << "\n   ListPointTop() + GetStatus() ns/call: " << ElapsedNs(Start) / (Ops / 10)
+              << "  (" << Length / (Ops / 10) << " byte command name)\n";
+
+    List.ListDeleteAll();
+    List.ListDeregister();
+
+    return true;
+}
+
+/*
+*   Complexity check - append, insert in the middle and delete at 1e3, 1e5 and 1e7 elements.
+*       Every add and delete is constant time, so the cost per operation must not grow with the
+*       list.  Cache misses and page faults on the large list are allowed for by the
+*       LL_SCALE_LIMIT factor, a linear walk would be thousands of times slower.
+*/
+#define  LL_SCALE_LIMIT   10.0                  // Largest/smallest per operation time that still passes
+
+static bool BenchScaling(void)
+{
+    const long  Sizes[3] = { 1000, 100000, 10000000 };
+    const long  Ops      = 100000;              // Inserts and deletes timed at each size
+    double      PerOp[3][3];                    // [size][append, insert, delete]
+    bool        Pass     = true;
+
+    std::cout << "\n\n***************************  BEGIN SCALING BENCHMARK *****************************\n";
+
+    for (int z = 0; z < 3; ++z)
+    {
+        LLMgr  List;
+        long   Repeat = (Sizes[z] < 1000000) ? 1000000 / Sizes[z] : 1;      // At least 1e6 appends timed
+
+        List.ListRegister(BENCH_PAYLOAD, "Scaling");
+
+        double AppendNs = 0;
+        for (long r = 0; r < Repeat; ++r)
+        {
+            List.ListDeleteAll();
+            List.ListReserve(Sizes[z] + Ops);
+
+            auto Start = std::chrono::steady_clock::now();
+            for (long i = 0; i < Sizes[z]; ++i)
+            {
+                *(long*)List.pUserAddBuffer = i;
+                List.ListAddEnd();
+            }
+            AppendNs += ElapsedNs(Start);
+        }
+        PerOp[z][0] = AppendNs / (Sizes[z] * Repeat);
+
+        List.ListPointTop();
+        for (long i = 0; i < Sizes[z] / 2; ++i)                          // Middle of the list
+        {
+            List.ListPointNext();
+        }
+
+        auto Start = std::chrono::steady_clock::now();
+        for (long i = 0; i < Ops; ++i)
+        {
+            *(long*)List.pUserAddBuffer = i;
+            List.ListAddAfter();
+        }
+        PerOp[z][1] = ElapsedNs(Start) / Ops;
+
+        Start = std::chrono::steady_clock::now();
+        for (long i = 0; i < Ops; ++i)
+        {
+            List.ListDelete();
+        }
+        PerOp[z][2] = ElapsedNs(Start) / Ops;
+
+        std::cout << "\n   " << Sizes[z] << " elements  ns/op  append: " << PerOp[z][0]
+                  << "  insert: " << PerOp[z][1] << "  delete: " << PerOp[z][2];
+
+        List.ListDeleteAll();
+        List.ListDeregister();
+    }
+
+    const char* OpName[3] = { "append", "insert", "delete" };
+    for (int o = 0; o < 3; ++o)
+    {
+        if (PerOp[2][o] > PerOp[0][o] * LL_SCALE_LIMIT)
+        {
+            std::cout << "\n   FAILED - " << OpName[o] << " grows with the list size";
+            Pass = false;
+        }
+    }
+    std::cout << "\n";
+
+    return Pass;
+}
+
+/*
+*   Ingest - 1e4 records copied one at a time through the add buffer against one
+*       ListAddEndBatch() call on the same array.  Repeated so the chunks are warm.
+*/
+static bool BenchBatch(void)
+{
+    const long  Count    = 10000;
+    const long  Repeat   = 200;
+    char*       pRecords = (char*) malloc(Count * BENCH_PAYLOAD);
+    LLMgr       List;
+    double      LoopNs   = 0;
+    double      BatchNs  = 0;
+
+    std::cout << "\n\n***************************  BEGIN BATCH ADD BENCHMARK *****************************\n";
+
+    for (long i = 0; i < Count; ++i)
+    {
+        memset(pRecords + i * BENCH_PAYLOAD, (int) i, BENCH_PAYLOAD);
+    }
+    List.ListRegister(BENCH_PAYLOAD, "Batch");
+
+    for (long r = 0; r < Repeat; ++r)
+    {
+        List.ListReserve(Count);                        // Both ways start with the chunk in place
+        auto Start = std::chrono::steady_clock::now();
+        for (long i = 0; i < Count; ++i)
+        {
+            memcpy(List.pUserAddBuffer, pRecords + i * BENCH_PAYLOAD, BENCH_PAYLOAD);
+            List.ListAddEnd();
+        }
+        LoopNs += ElapsedNs(Start);
+        List.ListDeleteAll();
+
+        List.ListReserve(Count);
+        Start = std::chrono::steady_clock::now();
+        List.ListAddEndBatch(pRecords, Count);
+        BatchNs += ElapsedNs(Start);
+        List.ListDeleteAll();
+    }
+    std::cout << "\n   memcpy() + ListAddEnd()  ns/record: " << LoopNs / (Count * Repeat)
+              << "\n   ListAddEndBatch()        ns/record: " << BatchNs / (Count * Repeat) << "\n";
+
+    List.ListDeregister();
+    free(pRecords);
+
+    return true;
+}
+
+/*
+*   Sort - ListSort() against the old way of copying the records out to a vector, sorting
+*       that and building the list again.  Run at a small and at a large record size.  The
+*       key is a long at the front of each record.
+*/
+template <size_t Length> struct BenchRecord_t {
+    long  Key;
+    char  Fill[Length - sizeof(long)];
+};
+
+static int BenchCompare(const void* pLeft, const void* pRight)
+{
+    long  Left  = *(const long*) pLeft;
+    long  Right = *(const long*) pRight;
+
+    return (Left < Right) ? -1 : (Left > Right) ? 1 : 0;
+}
+
+static void BenchSortLoad(LLMgr& List, long Count)
+{
+    unsigned long  Seed = 12345;
+
+    List.ListDeleteAll();
+    List.ListReserve(Count);
+    for (long i = 0; i < Count; ++i)
+    {
+        Seed = Seed * 6364136223846793005UL + 1442695040888963407UL;
+        *(long*)List.pUserAddBuffer = (long)(Seed >> 33);
+        List.ListAddEnd();
+    }
+}
+
+template <size_t Length> static void BenchSortSize(long Count)
+{
+    LLMgr  List;
+    List.ListRegister(Length, "Sort");
+
+    BenchSortLoad(List, Count);
+    auto Start = std::chrono::steady_clock::now();
+    {
+        std::vector<BenchRecord_t<Length>>  Copy;
+        Copy.reserve(Count);
+
+        List.ListPointTop();
+        do
+        {
+            Copy.push_back(*(BenchRecord_t<Length>*) List.pUserCurrentElement);
+        } while (List.ListPointNext() == true);
+
+        std::stable_sort(Copy.begin(), Copy.end(),
+                         [](const BenchRecord_t<Length>& a, const BenchRecord_t<Length>& b) { return a.Key < b.Key; });
+
+        List.ListDeleteAll();
+        for (long i = 0; i < Count; ++i)
+        {
+            memcpy(List.pUserAddBuffer, &Copy[i], Length);
+            List.ListAddEnd();
+        }
+    }
+    double CopyMs = ElapsedNs(Start) / 1e6;
+
+    BenchSortLoad(List, Count);
+    Start = std::chrono::steady_clock::now();
+    List.ListSort(BenchCompare);
+    double SortMs = ElapsedNs(Start) / 1e6;
+
+    std::cout << "\n   " << Count << " x " << Length << " bytes  copy to vector ms: " << CopyMs
+              << " (extra " << (Count * Length) / (1024 * 1024) << " MB)  ListSort() ms: " << SortMs;
+
+    List.ListDeleteAll();
+    List.ListDeregister();
+}
+
+static bool BenchSort(void)
+{
+    std::cout << "\n\n***************************  BEGIN SORT BENCHMARK *****************************\n";
+
+    BenchSortSize<64>(1000000);
+    BenchSortSize<1024>(100000);
+    BenchSortSize<8192>(10000);
+    std::cout << "\n";
+
+    return true;
+}
+
+/*
+*   Find - 1e5 sessions looked up by a long SessionId.  The old way is ListPointTop() and
+*       ListPointNext() until memcmp() matches, the new way ListFind() on the key index.
+*       The 99.99th percentile and slowest single add show the index grows without rehashing
+*       everything in one add.  The slowest is mostly page faults and the heap.
+*/
+static bool BenchFind(void)
+{
+    const long  Count   = 100000;
+    const long  Lookups = 2000;
+    LLMgr       Scan;
+    LLMgr       Indexed;
+    long        Found   = 0;
+
+    std::cout << "\n\n***************************  BEGIN FIND BENCHMARK *****************************\n";
+
+    Scan.ListRegister(BENCH_PAYLOAD, "Find scan");
+    Indexed.ListRegister(BENCH_PAYLOAD, "Find index", 0, sizeof(long));
+//
+//  Each list is loaded four times and the last load timed so both start with warm memory.
+//      ListDeleteAll() empties the index so it has to grow again on the second load.
+//
+    double  PlainNs   = 0;
+    double  IndexedNs = 0;
+
+    for (int Pass = 0; Pass < 4; ++Pass)
+    {
+        Scan.ListDeleteAll();
+        Indexed.ListDeleteAll();
+
+        auto Start = std::chrono::steady_clock::now();
+        for (long i = 0; i < Count; ++i)
+        {
+            *(long*)Scan.pUserAddBuffer = i;
+            Scan.ListAddEnd();
+        }
+        PlainNs = ElapsedNs(Start) / Count;
+
+        Start = std::chrono::steady_clock::now();
+        for (long i = 0; i < Count; ++i)
+        {
+            *(long*)Indexed.pUserAddBuffer = i;
+            Indexed.ListAddEnd();
+        }
+        IndexedNs = ElapsedNs(Start) / Count;
+    }
+
+    std::vector<double>  AddNs(Count);
+
+    Indexed.ListDeleteAll();                            // Once more to time each add
+    for (long i = 0; i < Count; ++i)
+    {
+        auto AddStart = std::chrono::steady_clock::now();
+        *(long*)Indexed.pUserAddBuffer = i;
+        Indexed.ListAddEnd();
+        AddNs[i] = ElapsedNs(AddStart);
+    }
+    std::sort(AddNs.begin(), AddNs.end());
+
+    auto Start = std::chrono::steady_clock::now();
+    for (long k = 0; k < Lookups; ++k)
+    {
+        long Key = (k * 7919) % Count;
+
+        Scan.ListPointTop();
+        do
+        {
+            if (memcmp(Scan.pUserCurrentElement, &Key, sizeof(long)) == 0)
+            {
+                ++Found;
+                break;
+            }
+        } while (Scan.ListPointNext() == true);
+    }
+    double ScanNs = ElapsedNs(Start) / Lookups;
+
+    Start = std::chrono::steady_clock::now();
+    for (long k = 0; k < Count * 10; ++k)
+    {
+        long Key = (k * 7919) % Count;
+        Found += Indexed.ListFind(&Key);
+    }
+    double FindNs = ElapsedNs(Start) / (Count * 10);
+
+    std::cout << "\n   " << Count << " elements  ListAddEnd() ns: " << PlainNs << "  with index ns: " << IndexedNs
+              << "\n   indexed add 99.99% ns: " << AddNs[Count - Count / 10000 - 1] << "  slowest ns: " << AddNs[Count - 1]
+              << "\n   ListPointNext() + memcmp() scan  ns/lookup: " << ScanNs
+              << "\n   ListFind()                       ns/lookup: " << FindNs << "\n";
+
+    Scan.ListDeleteAll();
+    Scan.ListDeregister();
+    Indexed.ListDeleteAll();
+    Indexed.ListDeregister();
+
+    return Found == Lookups + Count * 10;
+}
+
+/*
+*   Seek - 1e5 timers with random deadlines, then ranges of 100 deadlines asked for.  The
+*       old way is a walk of the whole list testing each deadline, the new way ListSeek()
+*       to the start of the range and ListSeekNext() until the deadline is past the end.
+*/
+static int BenchDeadline(const void* pLeft, const void* pRight)
+{
+    long  Left  = *(const long*) pLeft;
+    long  Right = *(const long*) pRight;
+
+    return (Left < Right) ? -1 : (Left > Right) ? 1 : 0;
+}
+
+static bool BenchSeek(void)
+{
+    const long  Count   = 100000;
+    const long  Queries = 200;
+    const long  Width   = 100;
+    LLMgr       Scan;
+    LLMgr       Ordered;
+    long        ScanHits = 0;
+    long        SeekHits = 0;
+    unsigned long Seed  = 1;
+
+    std::cout << "\n\n***************************  BEGIN SEEK BENCHMARK *****************************\n";
+
+    Scan.ListRegister(BENCH_PAYLOAD, "Seek scan");
+    Ordered.ListRegister(BENCH_PAYLOAD, "Seek index");
+    Ordered.ListOrderIndex(0, sizeof(long), BenchDeadline);
+
+    auto Start = std::chrono::steady_clock::now();
+    for (long i = 0; i < Count; ++i)
+    {
+        Seed = Seed * 6364136223846793005UL + 1442695040888963407UL;
+        *(long*)Scan.pUserAddBuffer = (long) ((Seed >> 33) % Count);
+        Scan.ListAddEnd();
+    }
+    double PlainNs = ElapsedNs(Start) / Count;
+
+    Seed  = 1;
+    Start = std::chrono::steady_clock::now();
+    for (long i = 0; i < Count; ++i)
+    {
+        Seed = Seed * 6364136223846793005UL + 1442695040888963407UL;
+        *(long*)Ordered.pUserAddBuffer = (long) ((Seed >> 33) % Count);
+        Ordered.ListAddEnd();
+    }
+    double OrderedNs = ElapsedNs(Start) / Count;
+
+    Start = std::chrono::steady_clock::now();
+    for (long q = 0; q < Queries; ++q)
+    {
+        long Low = (q * 7919) % (Count - Width);
+
+        Scan.ListPointTop();
+        do
+        {
+            long Deadline = *(long*)Scan.pUserCurrentElement;
+            ScanHits += (Deadline >= Low && Deadline < Low + Width);
+        } while (Scan.ListPointNext() == true);
+    }
+    double ScanNs = ElapsedNs(Start) / Queries;
+
+    Start = std::chrono::steady_clock::now();
+    for (long q = 0; q < Queries; ++q)
+    {
+        long Low = (q * 7919) % (Count - Width);
+
+        for (bool More = Ordered.ListSeek(&Low); More == true && *(long*)Ordered.pUserCurrentElement < Low + Width;
+             More = Ordered.ListSeekNext())
+        {
+            ++SeekHits;
+        }
+    }
+    double SeekNs = ElapsedNs(Start) / Queries;
+
+    std::cout << "\n   " << Count << " elements  ListAddEnd() ns: " << PlainNs << "  with order index ns: " << OrderedNs
+              << "\n   ranges of " << Width << " deadlines, elements in range: " << SeekHits / Queries
+              << "\n   ListPointNext() scan           ns/range: " << ScanNs
+              << "\n   ListSeek() + ListSeekNext()    ns/range: " << SeekNs << "\n";
+
+    Scan.ListDeleteAll();
+    Scan.ListDeregister();
+    Ordered.ListDeleteAll();
+    Ordered.ListDeregister();
+
+    return ScanHits == SeekHits;
+}
+
+/*
+*   Position - the element at a random position in a list of 1e5.  The old way is ListPointTop()
+*       and n ListPointNext() calls, the new way ListPointIndex() on a list registered with
+*       LL_OPTION_POSITION.  The adds show what the option costs a list.
+*/
+static bool BenchPosition(void)
+{
+    const long  Count   = 100000;
+    const long  Lookups = 200;
+    LLMgr       Plain;
+    LLMgr       Ranked;
+    long        Missed  = 0;
+
+    std::cout << "\n\n***************************  BEGIN POSITION BENCHMARK *****************************\n";
+
+    Plain.ListRegister(BENCH_PAYLOAD, "Position walk");
+    Ranked.ListRegister(BENCH_PAYLOAD, "Position index", LL_OPTION_POSITION);
+
+    auto Start = std::chrono::steady_clock::now();
+    for (long i = 0; i < Count; ++i)
+    {
+        *(long*)Plain.pUserAddBuffer = i;
+        Plain.ListAddEnd();
+    }
+    double PlainNs = ElapsedNs(Start) / Count;
+
+    Start = std::chrono::steady_clock::now();
+    for (long i = 0; i < Count; ++i)
+    {
+        *(long*)Ranked.pUserAddBuffer = i;
+        Ranked.ListAddEnd();
+    }
+    double RankedNs = ElapsedNs(Start) / Count;
+
+    Start = std::chrono::steady_clock::now();
+    for (long k = 0; k < Lookups; ++k)
+    {
+        long Position = (k * 7919) % Count;
+
+        Plain.ListPointTop();
+        for (long n = 0; n < Position; ++n)
+        {
+            Plain.ListPointNext();
+        }
+        Missed += (*(long*)Plain.pUserCurrentElement != Position);
+    }
+    double WalkNs = ElapsedNs(Start) / Lookups;
+
+    Start = std::chrono::steady_clock::now();
+    for (long k = 0; k < Count * 10; ++k)
+    {
+        long Position = (k * 7919) % Count;
+
+        Ranked.ListPointIndex(Position);
+        Missed += (*(long*)Ranked.pUserCurrentElement != Position);
+    }
+    double IndexNs = ElapsedNs(Start) / (Count * 10);
+
+    Start = std::chrono::steady_clock::now();
+    for (long k = 0; k < Count * 10; ++k)
+    {
+        Ranked.ListPointIndex((k * 7919) % Count);
+        Missed += (Ranked.ListCurrentIndex() != (k * 7919) % Count);
+    }
+    double BothNs = ElapsedNs(Start) / (Count * 10) - IndexNs;
+
+    std::cout << "\n   " << Count << " elements  ListAddEnd() ns: " << PlainNs << "  with LL_OPTION_POSITION ns: " << RankedNs
+              << "\n   ListPointTop() + ListPointNext() walk  ns/lookup: " << WalkNs
+              << "\n   ListPointIndex()                       ns/lookup: " << IndexNs
+              << "\n   ListCurrentIndex()                     ns/call:   " << BothNs << "\n";
+
+    Plain.ListDeleteAll();
+    Plain.ListDeregister();
+    Ranked.ListDeleteAll();
+    Ranked.ListDeregister();
+
+    return Missed == 0;
+}
+
+/*
+*   Layouts - the same list in the classic layout and with LL_OPTION_UNROLLED or LL_OPTION_DENSE.
+*       The list is loaded with ListAddEnd(), walked and scanned.  Then it is churned the way a
+*       long lived queue is: passes that delete about a third of the elements along the way and
+*       add as many at the end, so a classic list's freed elements come back in another order.
+*       Then it is scanned again, added to after one spot in the middle and deleted from the top.
+*       A walk only moves the current pointer, a scan reads a long from every record too.
+*/
+#define  BENCH_LAYOUTROWS   7
+
+static double BenchLayoutScan(LLMgr& List, long& Sum, bool Read)
+{
+    const int   Scans = 10;
+
+    auto Start = std::chrono::steady_clock::now();
+    for (int k = 0; k < Scans; ++k)
+    {
+        List.ListPointTop();
+        do
+        {
+            Sum += (Read == true) ? *(long*)List.pUserCurrentElement : 1;
+        } while (List.ListPointNext() == true);
+    }
+    return ElapsedNs(Start) / ((double) List.ElementCount * Scans);
+}
+
+static bool BenchLayoutRun(int Options, long Payload, const char* pName, double Ns[BENCH_LAYOUTROWS], long& Sum)
+{
+    const long  Count   = 1000000;
+    const long  Inserts = 200000;
+    long        Churned = 0;
+    LLMgr       List;
+
+    if (List.ListRegister(Payload, pName, Options) == false)
+    {
+        return false;
+    }
+
+    auto Start = std::chrono::steady_clock::now();
+    for (long i = 0; i < Count; ++i)
+    {
+        *(long*)List.pUserAddBuffer = i;
+        List.ListAddEnd();
+    }
+    Ns[0] = ElapsedNs(Start) / Count;
+    Ns[1] = BenchLayoutScan(List, Sum, false);
+    Ns[2] = BenchLayoutScan(List, Sum, true);
+
+    Start = std::chrono::steady_clock::now();
+    for (int Pass = 0; Pass < 4; ++Pass)
+    {
+        long  Deleted = 0;
+
+        List.ListPointTop();
+        for (long i = 0; i < Count; ++i)
+        {
+            if ((i * 7919 + Pass) % 3 == 0)
+            {
+                List.ListDelete();
+                ++Deleted;
+            }
+            else
+            {
+                List.ListPointNext();
+            }
+        }
+        for (long i = 0; i < Deleted; ++i)
+        {
+            *(long*)List.pUserAddBuffer = Count + Churned + i;
+            List.ListAddEnd();
+        }
+        Churned += Deleted;
+    }
+    Ns[3] = ElapsedNs(Start) / (Churned * 2);
+    Ns[4] = BenchLayoutScan(List, Sum, true);
+
+    List.ListPointTop();
+    for (long n = 0; n < Count / 2; ++n)
+    {
+        List.ListPointNext();
+    }
+    Start = std::chrono::steady_clock::now();
+    for (long i = 0; i < Inserts; ++i)
+    {
+        *(long*)List.pUserAddBuffer = i;
+        List.ListAddAfter();
+    }
+    Ns[5] = ElapsedNs(Start) / Inserts;
+
+    List.ListPointTop();
+    Start = std::chrono::steady_clock::now();
+    while (List.ElementCount > 0)
+    {
+        List.ListDelete();
+    }
+    Ns[6] = ElapsedNs(Start) / (Count + Inserts);
+
+    List.ListDeregister();
+    return true;
+}
+
+static bool BenchLayout(int Options, long Payload, const char* pName)
+{
+    double  Classic[BENCH_LAYOUTROWS];
+    double  Layout[BENCH_LAYOUTROWS];
+    long    ClassicSum = 0;
+    long    LayoutSum  = 0;
+
+    if (BenchLayoutRun(LL_OPTION_NONE, Payload, "Classic", Classic, ClassicSum) == false
+        || BenchLayoutRun(Options, Payload, pName, Layout, LayoutSum) == false)
+    {
+        return false;
+    }
+
+    std::cout << "\n   " << Payload << " byte records               classic      " << pName
+              << "\n   ListAddEnd() ns/add:              " << Classic[0] << "       " << Layout[0]
+              << "\n   walk ns/element:                  " << Classic[1] << "       " << Layout[1]
+              << "\n   scan ns/element:                  " << Classic[2] << "       " << Layout[2]
+              << "\n   churn ns/delete or add:           " << Classic[3] << "       " << Layout[3]
+              << "\n   scan after the churn ns/element:  " << Classic[4] << "       " << Layout[4]
+              << "\n   insert middle ns/add:             " << Classic[5] << "       " << Layout[5]
+              << "\n   delete from top ns/delete:        " << Classic[6] << "       " << Layout[6] << "\n";
+
+    return ClassicSum == LayoutSum;
+}
+
+static bool BenchUnrolled(void)
+{
+    std::cout << "\n\n***************************  BEGIN UNROLLED BENCHMARK *****************************\n";
+
+    return BenchLayout(LL_OPTION_UNROLLED, BENCH_PAYLOAD, "unrolled");
+}
+
+/*
+*   Dense - small records, where the ListPointers_t is most of a classic element.  The bytes an
+*       element takes are worked out from the layouts: the slab stride for classic, the link,
+*       the validation number and the record for dense.
+*/
+static bool BenchDense(void)
+{
+    const long  Payload = sizeof(long);
+
+    std::cout << "\n\n***************************  BEGIN DENSE BENCHMARK *****************************\n";
+
+    std::cout << "\n   bytes/element  classic: " << ((sizeof(ListPointers_t) + Payload + LL_SLAB_ALIGN - 1) & ~(size_t)(LL_SLAB_ALIGN - 1))
+              << "  dense: " << sizeof(DenseLink_t) + sizeof(uint32_t) + ((Payload + 7) & ~7L)
+              << "  of which a walk reads: " << sizeof(DenseLink_t) << "\n";
+
+    return BenchLayout(LL_OPTION_DENSE, Payload, "dense");
+}
+
+/*
+*   Typed - the same 64 byte record added and read back the void* way, built in a local and
+*       copied into pUserAddBuffer then copied out of pUserCurrentElement, and with LLList<T>
+*       where it is built in the element and read through a reference.
+*/
+struct BenchTyped_t {
+    long  Values[BENCH_PAYLOAD / sizeof(long)];
+
+    BenchTyped_t() {}
+    BenchTyped_t(long Base) { for (size_t w = 0; w < BENCH_PAYLOAD / sizeof(long); ++w) Values[w] = Base + w; }
+};
+
+static bool BenchTyped(void)
+{
+    const long      Count = 1000000;
+    const int       Rounds = 5;
+    const long      Words = BENCH_PAYLOAD / sizeof(long);
+    double          CopyAddNs = 0, CopyReadNs = 0, TypedAddNs = 0, TypedReadNs = 0;
+    long            CopySum = 0, TypedSum = 0;
+
+    std::cout << "\n\n***************************  BEGIN TYPED BENCHMARK *****************************\n";
+
+    for (int Round = 0; Round < Rounds; ++Round)
+    {
+        LLMgr                   List;
+        LLList<BenchTyped_t>    Typed;
+        BenchTyped_t            Record;
+
+        List.ListRegister(sizeof(BenchTyped_t), "Copy");
+        Typed.ListRegister("Typed");
+        List.ListReserve(Count);
+        Typed.ListReserve(Count);
+
+        auto Start = std::chrono::steady_clock::now();
+        for (long i = 0; i < Count; ++i)
+        {
+            Record = BenchTyped_t(i);
+            memcpy(List.pUserAddBuffer, &Record, sizeof(BenchTyped_t));
+            List.ListAddEnd();
+        }
+        CopyAddNs += ElapsedNs(Start) / Count;
+
+        Start = std::chrono::steady_clock::now();
+        List.ListPointTop();
+        do
+        {
+            memcpy(&Record, List.pUserCurrentElement, sizeof(BenchTyped_t));
+            CopySum += Record.Values[0] + Record.Values[Words - 1];
+        } while (List.ListPointNext() == true);
+        CopyReadNs += ElapsedNs(Start) / Count;
+
+        Start = std::chrono::steady_clock::now();
+        for (long i = 0; i < Count; ++i)
+        {
+            Typed.emplace_back(i);
+        }
+        TypedAddNs += ElapsedNs(Start) / Count;
+
+        Start = std::chrono::steady_clock::now();
+        Typed.ListPointTop();
+        do
+        {
+            const BenchTyped_t& Current = Typed.Current();
+            TypedSum += Current.Values[0] + Current.Values[Words - 1];
+        } while (Typed.ListPointNext() == true);
+        TypedReadNs += ElapsedNs(Start) / Count;
+
+        List.ListDeleteAll();
+        List.ListDeregister();
+    }
+
+    std::cout << "\n   " << BENCH_PAYLOAD << " byte records      memcpy      LLList<T>"
+              << "\n   add ns/element:        " << CopyAddNs / Rounds << "       " << TypedAddNs / Rounds
+              << "\n   read ns/element:       " << CopyReadNs / Rounds << "       " << TypedReadNs / Rounds << "\n";
+
+    return CopySum == TypedSum;
+}
+
+/*
+*   Cursor - a read-only walk of each layout with ListPointNext(), which keeps the current element
+*       and the status block up to date on every step, and with a range-for over LLCursor.
+*/
+static bool BenchCursor(void)
+{
+    const long   Count  = 1000000;
+    const int    Rounds = 10;
+    int          Layouts[3] = { LL_OPTION_NONE, LL_OPTION_UNROLLED, LL_OPTION_DENSE };
+    const char*  Names[3]   = { "classic ", "unrolled", "dense   " };
+    long         PointSum   = 0;
+    long         CursorSum  = 0;
+
+    std::cout << "\n\n***************************  BEGIN CURSOR BENCHMARK *****************************\n";
+    std::cout << "\n   " << BENCH_PAYLOAD << " byte records  ListPointNext() ns/element   cursor ns/element";
+
+    for (int l = 0; l < 3; ++l)
+    {
+        LLMgr   List;
+        double  PointNs  = 0;
+        double  CursorNs = 0;
+
+        List.ListRegister(BENCH_PAYLOAD, "Cursor", Layouts[l]);
+        for (long i = 0; i < Count; ++i)
+        {
+            *(long*) List.pUserAddBuffer = i;
+            List.ListAddEnd();
+        }
+
+        for (int Round = 0; Round < Rounds; ++Round)
+        {
+            auto Start = std::chrono::steady_clock::now();
+            List.ListPointTop();
+            do
+            {
+                PointSum += *(long*) List.pUserCurrentElement;
+            } while (List.ListPointNext() == true);
+            PointNs += ElapsedNs(Start) / Count;
+
+            Start = std::chrono::steady_clock::now();
+            for (void* pRecord : List)
+            {
+                CursorSum += *(long*) pRecord;
+            }
+            CursorNs += ElapsedNs(Start) / Count;
+        }
+
+        std::cout << "\n   " << Names[l] << "        " << PointNs / Rounds << "                     " << CursorNs / Rounds;
+
+        List.ListDeleteAll();
+        List.ListDeregister();
+    }
+    std::cout << "\n";
+
+    return PointSum == CursorSum;
+}
+
+/*
+*   Handle - socket style tokens.  A window of live connections is churned, every add takes a
+*       token and every delete leaves one behind.  Then live and stale tokens are resolved.
+*/
+static bool BenchHandle(void)
+{
+    const long    Window = 1024;
+    const long    Ops    = 2000000;
+    LLMgr         List;
+    DirectToken_t Live[1024];
+    DirectToken_t Stale[1024];
+    long          Found  = 0;
+    long          Turned = 0;
+
+    std::cout << "\n\n***************************  BEGIN HANDLE BENCHMARK *****************************\n";
+
+    List.ListRegister(BENCH_PAYLOAD, "Handle");
+    for (long i = 0; i < Window; ++i)
+    {
+        *(long*) List.pUserAddBuffer = i;
+        List.ListAddEnd();
+        Live[i] = List.GetDirectToken();
+    }
+
+    auto Start = std::chrono::steady_clock::now();
+    for (long i = 0; i < Ops; ++i)
+    {
+        long  w = i % Window;
+
+        List.SetDirectPointer(Live[w]);
+        List.ListDelete();
+        Stale[w] = Live[w];
+        *(long*) List.pUserAddBuffer = i;
+        List.ListAddEnd();
+        Live[w] = List.GetDirectToken();
+    }
+    double ChurnNs = ElapsedNs(Start) / Ops;
+
+    Start = std::chrono::steady_clock::now();
+    for (long i = 0; i < Ops; ++i)
+    {
+        Found += List.SetDirectPointer(Live[(i * 7) % Window]) ? 1 : 0;
+    }
+    double LiveNs = ElapsedNs(Start) / Ops;
+
+    Start = std::chrono::steady_clock::now();
+    for (long i = 0; i < Ops; ++i)
+    {
+        Turned += List.SetDirectPointer(Stale[(i * 7) % Window]) ? 0 : 1;
+    }
+    double StaleNs = ElapsedNs(Start) / Ops;
+
+    std::cout << "\n   point, delete, add and token ns/connection: " << ChurnNs
+              << "\n   SetDirectPointer() live token ns:           " << LiveNs
+              << "\n   SetDirectPointer() stale token ns:          " << StaleNs << "\n";
+
+    List.ListDeleteAll();
+    List.ListDeregister();
+
+    return Found == Ops && Turned == Ops;
+}
+
+/*
+*   Wire - a burst of 64 tokens in random order into a list too big for the cache, the way a
+*       batch of messages names its elements.  SetDirectPointer() one at a time against one
+*       ResolveTokens() call for the burst, both read the first long of every element.
+*/
+static bool BenchWire(void)
+{
+    const long    Elements = 1000000;
+    const long    Burst    = 64;
+    const long    Bursts   = 20000;
+    LLMgr         List;
+    std::vector<DirectToken_t>  Direct;
+    std::vector<uint64_t>       Wire;
+    std::vector<long>           Order;
+    uint64_t      Batch[64];
+    DirectToken_t Single[64];
+    void*         Records[64];
+    long          DirectSum = 0;
+    long          WireSum   = 0;
+
+    std::cout << "\n\n***************************  BEGIN WIRE TOKEN BENCHMARK *****************************\n";
+
+    List.ListRegister(BENCH_PAYLOAD, "Wire");
+    for (long i = 0; i < Elements; ++i)
+    {
+        *(long*) List.pUserAddBuffer = i;
+        List.ListAddEnd();
+        Direct.push_back(List.GetDirectToken());
+        Wire.push_back(List.GetWireToken());
+    }
+
+    srand(18);
+    for (long i = 0; i < Bursts * Burst; ++i)
+    {
+        Order.push_back(((long) rand() * RAND_MAX + rand()) % Elements);
+    }
+
+    auto Start = std::chrono::steady_clock::now();
+    for (long b = 0; b < Bursts; ++b)
+    {
+        for (long i = 0; i < Burst; ++i)
+        {
+            Single[i] = Direct[Order[b * Burst + i]];
+        }
+        for (long i = 0; i < Burst; ++i)
+        {
+            List.SetDirectPointer(Single[i]);
+            DirectSum += *(long*) List.pUserCurrentElement;
+        }
+    }
+    double DirectNs = ElapsedNs(Start) / (Bursts * Burst);
+
+    Start = std::chrono::steady_clock::now();
+    for (long b = 0; b < Bursts; ++b)
+    {
+        for (long i = 0; i < Burst; ++i)
+        {
+            Batch[i] = Wire[Order[b * Burst + i]];
+        }
+        List.ResolveTokens(Batch, Burst, Records);
+        for (long i = 0; i < Burst; ++i)
+        {
+            WireSum += *(long*) Records[i];
+        }
+    }
+    double WireNs = ElapsedNs(Start) / (Bursts * Burst);
+
+    std::cout << "\n   Token size bytes - DirectToken_t: " << sizeof(DirectToken_t) << "  wire: " << sizeof(uint64_t)
+              << "\n   SetDirectPointer() ns/token:      " << DirectNs
+              << "\n   ResolveTokens() ns/token:         " << WireNs << "\n";
+
+    List.ListDeleteAll();
+    List.ListDeregister();
+
+    return DirectSum == WireSum;
+}
+
+/*
+*   Threads - every thread adds to a dense list of its own.  Lists share nothing, so the adds per
+*       second should go up with the threads until the cores run out.  The rand() column is the
+*       same number of bare rand() calls, what every add paid for the glibc lock before.
+*/
+static void ThreadAdds(long Count, long* pSum)
+{
+    LLMgr   List;
+    long    Sum = 0;
+
+    List.ListRegister(BENCH_PAYLOAD, "Thread", LL_OPTION_DENSE);
+    for (long i = 0; i < Count; ++i)
+    {
+        *(long*) List.pUserAddBuffer = i;
+        List.ListAddEnd();
+    }
+    List.ListPointTop();
+    do
+    {
+        Sum += *(long*) List.pUserCurrentElement;
+    } while (List.ListPointNext() == true);
+    List.ListDeleteAll();
+    List.ListDeregister();
+
+    *pSum = Sum;
+}
+
+static void ThreadRand(long Count, long* pSum)
+{
+    long    Sum = 0;
+
+    for (long i = 0; i < Count; ++i)
+    {
+        Sum += rand() & 1;
+    }
+    *pSum = Sum;
+}
+
+static bool BenchThreads(void)
+{
+    const long    Count = 2000000;
+    const int     Threads[] = { 1, 2, 4, 8 };
+    bool          Match = true;
+
+    std::cout << "\n\n***************************  BEGIN THREADED ADD BENCHMARK *****************************\n";
+    std::cout << "\n   hardware threads: " << std::thread::hardware_concurrency()
+              << "\n   threads    M adds/sec (list each)    M rand()/sec (shared)";
+
+    for (int t = 0; t < 4; ++t)
+    {
+        std::vector<std::thread>  Workers;
+        std::vector<long>         Sums(Threads[t]);
+
+        auto Start = std::chrono::steady_clock::now();
+        for (int w = 0; w < Threads[t]; ++w)
+        {
+            Workers.emplace_back(ThreadAdds, Count, &Sums[w]);
+        }
+        for (std::thread& Worker : Workers)
+        {
+            Worker.join();
+        }
+        double AddNs = ElapsedNs(Start);
+
+        for (int w = 0; w < Threads[t]; ++w)
+        {
+            Match = Match && Sums[w] == (Count - 1) * Count / 2;
+        }
+
+        Workers.clear();
+        Start = std::chrono::steady_clock::now();
+        for (int w = 0; w < Threads[t]; ++w)
+        {
+            Workers.emplace_back(ThreadRand, Count, &Sums[w]);
+        }
+        for (std::thread& Worker : Workers)
+        {
+            Worker.join();
+        }
+        double RandNs = ElapsedNs(Start);
+
+        std::cout << "\n   " << Threads[t] << "          " << Count * Threads[t] * 1000.0 / AddNs
+                  << "                  " << Count * Threads[t] * 1000.0 / RandNs;
+    }
+    std::cout << "\n";
+
+    return Match;
+}
+
+/*
+*   Contention - one session list shared by 1, 4, 16 and 64 threads, 95% lookups and 5% session
+*       replaces.  LL_OPTION_THREADSAFE with the lookups on cursors under the shared lock, against
+*       a plain list with one mutex around every call the way callers had to do it.
+*/
+typedef struct {
+    long  SessionId;
+    char  User[56];
+} BenchSession_t;
+
+static void ContentionWork(LLMgr* pList, std::mutex* pGlobal, long Ops, long Seed, long* pFound)
+{
+    const long  Sessions = 100000;
+    uint64_t    State    = (uint64_t) Seed * 0x9E3779B97F4A7C15ULL + 1;
+    long        Found    = 0;
+
+    for (long i = 0; i < Ops; ++i)
+    {
+        State ^= State << 13;                           // xorshift - rand() would serialize the threads itself
+        State ^= State >> 7;
+        State ^= State << 17;
+
+        long  Key = (long)(State % Sessions);
+
+        if (State % 100 < 95)                           // Lookup
+        {
+            if (pGlobal != NULL)
+            {
+                std::lock_guard<std::mutex>  Hold(*pGlobal);
+
+                Found += (pList->ListFind(&Key) == true && ((BenchSession_t*) pList->pUserCurrentElement)->SessionId == Key);
+            }
+            else
+            {
+                std::shared_lock<LLLock>  Hold   = pList->ListReadLock();
+                LLCursor                  Cursor = pList->ListFindCursor(&Key);
+
+                Found += (Cursor != pList->end() && ((BenchSession_t*) *Cursor)->SessionId == Key);
+            }
+        }
+        else                                            // Replace the session
+        {
+            std::unique_lock<std::mutex>  HoldGlobal;
+            std::unique_lock<LLLock>      Hold = pList->ListWriteLock();
+
+            if (pGlobal != NULL)
+            {
+                HoldGlobal = std::unique_lock<std::mutex>(*pGlobal);
+            }
+            if (pList->ListFind(&Key) == true)
+            {
+                pList->ListDelete();
+            }
+            ((BenchSession_t*) pList->pUserAddBuffer)->SessionId = Key;
+            pList->ListAddEnd();
+            ++Found;
+        }
+    }
+    *pFound = Found;
+}
+
+static bool BenchContention(void)
+{
+    const long  Sessions  = 100000;
+    const long  Ops       = 1600000;
+    const int   Threads[] = { 1, 4, 16, 64 };
+    bool        AllFound  = true;
+
+    std::cout << "\n\n***************************  BEGIN CONTENTION BENCHMARK *****************************\n";
+    std::cout << "\n   hardware threads: " << std::thread::hardware_concurrency()
+              << "\n   threads    M ops/sec LL_OPTION_THREADSAFE    M ops/sec one mutex";
+
+    for (int t = 0; t < 4; ++t)
+    {
+        double  Rate[2];
+
+        for (int Mode = 0; Mode < 2; ++Mode)
+        {
+            LLMgr                     List;
+            std::mutex                Global;
+            std::vector<std::thread>  Workers;
+            std::vector<long>         Found(Threads[t]);
+            long                      Total = 0;
+
+            List.ListRegister(sizeof(BenchSession_t), "Contention", 0, sizeof(long),
+                              (Mode == 0) ? LL_OPTION_THREADSAFE : LL_OPTION_NONE);
+            for (long i = 0; i < Sessions; ++i)
+            {
+                ((BenchSession_t*) List.pUserAddBuffer)->SessionId = i;
+                List.ListAddEnd();
+            }
+
+            auto Start = std::chrono::steady_clock::now();
+            for (int w = 0; w < Threads[t]; ++w)
+            {
+                Workers.emplace_back(ContentionWork, &List, (Mode == 0) ? (std::mutex*) NULL : &Global,
+                                     Ops / Threads[t], (long) w + 1, &Found[w]);
+            }
+            for (std::thread& Worker : Workers)
+            {
+                Worker.join();
+            }
+            Rate[Mode] = (Ops / Threads[t]) * Threads[t] * 1000.0 / ElapsedNs(Start);
+
+            for (int w = 0; w < Threads[t]; ++w)
+            {
+                Total += Found[w];
+            }
+            AllFound = AllFound && Total == (Ops / Threads[t]) * Threads[t] && List.ElementCount == Sessions;
+
+            List.ListDeleteAll();
+            List.ListDeregister();
+        }
+        std::cout << "\n   " << Threads[t] << "          " << Rate[0] << "                      " << Rate[1];
+    }
+    std::cout << "\n";
+
+    return AllFound;
+}
+
+/*
+*   MPSC - producer threads send time stamped records to one consumer that takes them oldest
+*       first.  LL_OPTION_MPSC ListPost() / ListTake() against a classic list with a mutex around
+*       ListAddEnd() and the ListPointTop() / ListDelete() of the consumer.  Throughput and the
+*       post to take latency percentiles.
+*/
+typedef struct {
+    long  Stamp;                                    // Nano seconds at the post
+    long  Producer;
+} BenchPost_t;
+
+static long BenchNow(void)
+{
+    return (long) std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void MpscProducer(LLMgr* pList, std::mutex* pGlobal, long Count, long Producer)
+{
+    BenchPost_t  Record;
+
+    for (long i = 0; i < Count; ++i)
+    {
+        Record.Producer = Producer;
+        if (pGlobal == NULL)
+        {
+            Record.Stamp = BenchNow();
+            while (pList->ListPost(&Record) == false)
+            {
+                std::this_thread::yield();
+            }
+        }
+        else
+        {
+            std::lock_guard<std::mutex>  Hold(*pGlobal);
+
+            Record.Stamp = BenchNow();
+            memcpy(pList->pUserAddBuffer, &Record, sizeof(Record));
+            pList->ListAddEnd();
+        }
+    }
+}
+
+static bool BenchMpsc(void)
+{
+    const long  Total     = 2000000;
+    const int   Producers[] = { 1, 4 };
+    bool        AllTaken  = true;
+
+    std::cout << "\n\n***************************  BEGIN MPSC BENCHMARK *****************************\n";
+    std::cout << "\n   hardware threads: " << std::thread::hardware_concurrency()
+              << "\n   producers  mode          M records/sec   p50 ns     p99 ns     p99.9 ns";
+
+    for (int p = 0; p < 2; ++p)
+    {
+        for (int Mode = 0; Mode < 2; ++Mode)
+        {
+            LLMgr                     List;
+            std::mutex                Global;
+            std::vector<std::thread>  Workers;
+            std::vector<long>         Latency;
+            BenchPost_t               Record;
+            long                      PerProducer = Total / Producers[p];
+            long                      Expected    = PerProducer * Producers[p];
+
+            Latency.reserve(Expected);
+            List.ListRegister(sizeof(BenchPost_t), "Mpsc", (Mode == 0) ? LL_OPTION_MPSC : LL_OPTION_NONE);
+
+            auto Start = std::chrono::steady_clock::now();
+            for (int w = 0; w < Producers[p]; ++w)
+            {
+                Workers.emplace_back(MpscProducer, &List, (Mode == 0) ? (std::mutex*) NULL : &Global, PerProducer, (long) w);
+            }
+            while ((long) Latency.size() < Expected)
+            {
+                bool  Got;
+
+                if (Mode == 0)
+                {
+                    Got = List.ListTake(&Record);
+                }
+                else
+                {
+                    std::lock_guard<std::mutex>  Hold(Global);
+
+                    if ((Got = List.ElementCount > 0) == true)
+                    {
+                        List.ListPointTop();
+                        memcpy(&Record, List.pUserCurrentElement, sizeof(Record));
+                        List.ListDelete();
+                    }
+                }
+                if (Got == true)
+                {
+                    Latency.push_back(BenchNow() - Record.Stamp);
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+            double Ns = ElapsedNs(Start);
+            for (std::thread& Worker : Workers)
+            {
+                Worker.join();
+            }
+
+            std::sort(Latency.begin(), Latency.end());
+            std::cout << "\n   " << Producers[p] << "          " << ((Mode == 0) ? "LL_OPTION_MPSC" : "mutex list    ")
+                      << "  " << Expected * 1000.0 / Ns
+                      << "         " << Latency[Expected / 2]
+                      << "     " << Latency[Expected * 99 / 100]
+                      << "     " << Latency[Expected * 999 / 1000];
+
+            AllTaken = AllTaken && List.ListTake(&Record) == false && List.ElementCount == 0;
+            List.ListDeleteAll();
+            List.ListDeregister();
+        }
+    }
+    std::cout << "\n";
+
+    return AllTaken;
+}
+
+/*
+*   Reclaim - reader threads walk a 10000 element list end to end while a writer deletes the top
+*       and adds at the end as fast as it can.  LL_OPTION_THREADSAFE walks under ListReadLock()
+*       against LL_OPTION_RECLAIM walks in a ListReadSection() with no lock.  Walks and writer
+*       operations per second.
+*/
+static void ReclaimWalk(LLMgr* pList, bool Section, long Walks, long* pSum)
+{
+    long  Sum = 0;
+
+    for (long w = 0; w < Walks; ++w)
+    {
+        std::shared_lock<LLLock>  Hold;
+        LLReadSection             Reading;
+
+        if (Section == true)
+        {
+            Reading = pList->ListReadSection();
+        }
+        else
+        {
+            Hold = pList->ListReadLock();
+        }
+        for (void* pRecord : *pList)
+        {
+            Sum += *(long*) pRecord;
+        }
+    }
+    *pSum = Sum;
+}
+
+static void ReclaimChurn(LLMgr* pList, std::atomic<bool>* pStop, long* pOps)
+{
+    long  Ops = 0;
+
+    while (pStop->load(std::memory_order_relaxed) == false)
+    {
+        std::unique_lock<LLLock>  Hold = pList->ListWriteLock();
+
+        pList->ListPointTop();
+        *(long*) pList->pUserAddBuffer = *(long*) pList->pUserCurrentElement;
+        pList->ListDelete();
+        pList->ListAddEnd();
+        ++Ops;
+    }
+    *pOps = Ops;
+}
+
+static bool BenchReclaim(void)
+{
+    const long  Count     = 10000;
+    const long  Walks     = 400;
+    const int   Threads[] = { 1, 4 };
+    bool        Match     = true;
+
+    std::cout << "\n\n***************************  BEGIN RECLAIM BENCHMARK *****************************\n";
+    std::cout << "\n   hardware threads: " << std::thread::hardware_concurrency()
+              << "\n   readers    walks/sec read lock   writer ops/sec    walks/sec section   writer ops/sec";
+
+    for (int t = 0; t < 2; ++t)
+    {
+        double  WalkRate[2];
+        double  WriteRate[2];
+        long    Sums[2] = { 0, 0 };
+
+        for (int Mode = 0; Mode < 2; ++Mode)
+        {
+            LLMgr                     List;
+            std::vector<std::thread>  Workers;
+            std::vector<long>         Sum(Threads[t]);
+            std::atomic<bool>         Stop(false);
+            long                      Ops = 0;
+
+            List.ListRegister(sizeof(long), "Reclaim", (Mode == 0) ? LL_OPTION_THREADSAFE : LL_OPTION_RECLAIM);
+            for (long i = 0; i < Count; ++i)
+            {
+                *(long*) List.pUserAddBuffer = 1;
+                List.ListAddEnd();
+            }
+
+            auto Start = std::chrono::steady_clock::now();
+            std::thread  Writer(ReclaimChurn, &List, &Stop, &Ops);
+            for (int w = 0; w < Threads[t]; ++w)
+            {
+                Workers.emplace_back(ReclaimWalk, &List, Mode == 1, Walks, &Sum[w]);
+            }
+            for (std::thread& Worker : Workers)
+            {
+                Worker.join();
+            }
+            double WalkNs = ElapsedNs(Start);
+            Stop = true;
+            Writer.join();
+
+            WalkRate[Mode]  = Walks * Threads[t] * 1.0e9 / WalkNs;
+            WriteRate[Mode] = Ops * 1.0e9 / WalkNs;
+            for (int w = 0; w < Threads[t]; ++w)
+            {
+                Sums[Mode] += Sum[w];
+            }
+            Match = Match && List.ElementCount == Count;
+
+            List.ListDeleteAll();
+            List.ListDeregister();
+        }
+        Match = Match && Sums[0] == Walks * Threads[t] * Count  // A locked walk sees Count ones, a section walk
+                      && Sums[1] >= Sums[0];                     // also follows the ones added while it goes
+        std::cout << "\n   " << Threads[t] << "          " << WalkRate[0] << "                " << WriteRate[0]
+                  << "           " << WalkRate[1] << "               " << WriteRate[1];
+    }
+    std::cout << "\n";
+
+    return Match;
+}
+
+/*
+*   Shards - 1, 2, 4 and 8 threads each add their own sessions, then find each of them 4 times by
+*       key.  One shard (every thread on one lock) against 16 shards by key.  Adds and finds per
+*       second.  On a machine with fewer cores than threads the rates can not go up with threads.
+*/
+static void ShardWork(LLShard* pShards, bool Find, long First, long Count, long* pFound)
+{
+    BenchSession_t  Record;
+    long            Found = 0;
+
+    memset(&Record, 0, sizeof(Record));
+    for (long Pass = 0; Pass < (Find ? 4 : 1); ++Pass)
+    {
+        for (long i = 0; i < Count; ++i)
+        {
+            long  Key = First + (i * 7919 + Pass) % Count;          // Not in add order
+
+            if (Find == false)
+            {
+                Record.SessionId = First + i;
+                Found += (pShards->ShardAdd(&Record).Magic == 1955);
+            }
+            else
+            {
+                Found += (pShards->ShardFind(&Key, &Record) == true && Record.SessionId == Key);
+            }
+        }
+    }
+    *pFound = Found;
+}
+
+static bool BenchShards(void)
+{
+    const long  Total     = 400000;
+    const int   Threads[] = { 1, 2, 4, 8 };
+    const int   Counts[]  = { 1, 16 };
+    bool        AllFound  = true;
+
+    std::cout << "\n\n***************************  BEGIN SHARD BENCHMARK *****************************\n";
+    std::cout << "\n   hardware threads: " << std::thread::hardware_concurrency()
+              << "\n   threads    M adds/sec 1 shard   M finds/sec 1 shard   M adds/sec 16 shards   M finds/sec 16 shards";
+
+    for (int t = 0; t < 4; ++t)
+    {
+        double  Rate[2][2];
+        long    Each = Total / Threads[t];
+
+        for (int c = 0; c < 2; ++c)
+        {
+            LLShard  Sessions;
+
+            Sessions.ShardRegister(Counts[c], sizeof(BenchSession_t), "Shards", 0, sizeof(long));
+            for (int Find = 0; Find < 2; ++Find)                    // Every thread adds, then every thread finds
+            {
+                std::vector<std::thread>  Workers;
+                std::vector<long>         Found(Threads[t]);
+
+                auto Start = std::chrono::steady_clock::now();
+                for (int w = 0; w < Threads[t]; ++w)
+                {
+                    Workers.emplace_back(ShardWork, &Sessions, Find == 1, w * Each, Each, &Found[w]);
+                }
+                for (std::thread& Worker : Workers)
+                {
+                    Worker.join();
+                }
+                Rate[c][Find] = Each * Threads[t] * (Find ? 4 : 1) * 1000.0 / ElapsedNs(Start);
+
+                for (int w = 0; w < Threads[t]; ++w)
+                {
+                    AllFound = AllFound && Found[w] == Each * (Find ? 4 : 1);
+                }
+            }
+            AllFound = AllFound && Sessions.ElementCount() == Each * Threads[t];
+        }
+        std::cout << "\n   " << Threads[t] << "          " << Rate[0][0] << "             " << Rate[0][1]
+                  << "               " << Rate[1][0] << "                " << Rate[1][1];
+    }
+    std::cout << "\n";
+
+    return AllFound;
+}
+
+/*
+*   Parallel - the timeout sweep over 1,000,000 sessions: count the ones not seen since a cutoff.
+*       ListPointNext() on one thread against ParallelReduce() on pools of 1, 2, 4 and 8 threads.
+*       The own list is cut up by its handle table, the spliced one took half its sessions from
+*       another list and is cut by one walk of its links.  Milliseconds a sweep and the speed up
+*       over ListPointNext().  On a machine with fewer cores than threads it can not speed up.
+*/
+typedef struct {
+    long  SessionId;
+    long  LastSeen;
+    char  User[48];
+} BenchTimeout_t;
+
+static bool BenchParallel(void)
+{
+    const long  Count     = 1000000;
+    const long  Cutoff    = 900;
+    const int   Sweeps    = 10;
+    const int   Threads[] = { 1, 2, 4, 8 };
+    bool        Match     = true;
+    LLMgr       Own;
+    LLMgr       Spliced;
+    LLMgr       Donor;
+    LLMgr*      pLists[2] = { &Own, &Spliced };
+
+    std::cout << "\n\n***************************  BEGIN PARALLEL BENCHMARK *****************************\n";
+
+    Own.ListRegister(sizeof(BenchTimeout_t), "Own");
+    Spliced.ListRegister(sizeof(BenchTimeout_t), "Spliced");
+    Donor.ListRegister(sizeof(BenchTimeout_t), "Donor");
+    for (long i = 0; i < Count; ++i)
+    {
+        BenchTimeout_t  Session;
+
+        memset(&Session, 0, sizeof(Session));
+        Session.SessionId = i;
+        Session.LastSeen  = (i * 7919) % 1000;
+        memcpy(Own.pUserAddBuffer, &Session, sizeof(Session));
+        Own.ListAddEnd();
+        memcpy(((i < Count / 2) ? Donor : Spliced).pUserAddBuffer, &Session, sizeof(Session));
+        ((i < Count / 2) ? Donor : Spliced).ListAddEnd();
+        if (i == Count / 2 - 1)
+        {
+            Donor.ListSpliceAll(Spliced);
+        }
+    }
+
+    std::cout << "\n   hardware threads: " << std::thread::hardware_concurrency()
+              << "\n   list       ListPointNext ms   threads   ParallelReduce ms   speed up";
+
+    for (int l = 0; l < 2; ++l)
+    {
+        long  Expired = 0;
+
+        auto Start = std::chrono::steady_clock::now();
+        for (int Sweep = 0; Sweep < Sweeps; ++Sweep)
+        {
+            Expired = 0;
+            for (bool More = pLists[l]->ListPointTop(); More == true; More = pLists[l]->ListPointNext())
+            {
+                Expired += ((BenchTimeout_t*) pLists[l]->pUserCurrentElement)->LastSeen < Cutoff;
+            }
+        }
+        double SerialMs = ElapsedNs(Start) / Sweeps / 1.0e6;
+
+        for (int t = 0; t < 4; ++t)
+        {
+            LLPool  Pool(Threads[t] - 1);
+            long    Found = 0;
+
+            auto Begin = std::chrono::steady_clock::now();
+            for (int Sweep = 0; Sweep < Sweeps; ++Sweep)
+            {
+                Found = pLists[l]->ParallelReduce(0L,
+                            [Cutoff](void* pRecord) { return (long)(((BenchTimeout_t*) pRecord)->LastSeen < Cutoff); },
+                            [](long a, long b) { return a + b; }, &Pool);
+            }
+            double ParallelMs = ElapsedNs(Begin) / Sweeps / 1.0e6;
+
+            Match = Match && Found == Expired && Expired == Count * Cutoff / 1000;
+            std::cout << "\n   " << ((l == 0) ? "own    " : "spliced") << "    " << SerialMs << "            "
+                      << Threads[t] << "         " << ParallelMs << "             " << SerialMs / ParallelMs;
+        }
+    }
+    std::cout << "\n";
+
+    Own.ListDeleteAll();
+    Spliced.ListDeleteAll();
+    return Match;
+}
+
+/*
+*   Persist - a restart against a rebuild.  1,000,000 sessions are loaded into a dense list in
+*       memory, the rebuild, with the records already in an array - a rebuild from a database pays
+*       its queries on top.  The same load into a persistent list shows what the undo log costs an
+*       add.  Then the file is closed and opened again, clean and after a process that died with
+*       it open, which has the links checked.  The pages are still in the page cache, a cold start
+*       reads in the pages the first walk touches.  Milliseconds.
+*/
+static bool BenchPersist(void)
+{
+    const long   Count = 1000000;
+    std::string  Path  = "/tmp/llm-bench-persist-" + std::to_string((long) getpid()) + ".dat";
+    std::vector<BenchTimeout_t>  Rows(Count);
+    LLMgr        Rebuilt;
+    LLMgr        Stored;
+    long         Walked = 0;
+    bool         Match;
+    pid_t        Child;
+
+    std::cout << "\n\n***************************  BEGIN PERSIST BENCHMARK *****************************\n";
+
+    for (long i = 0; i < Count; ++i)
+    {
+        memset(&Rows[i], 0, sizeof(BenchTimeout_t));
+        Rows[i].SessionId = i;
+        Rows[i].LastSeen  = (i * 7919) % 1000;
+    }
+    unlink(Path.c_str());
+
+    auto Start = std::chrono::steady_clock::now();
+    Rebuilt.ListRegister(sizeof(BenchTimeout_t), "Rebuilt", LL_OPTION_DENSE);
+    for (long i = 0; i < Count; ++i)
+    {
+        memcpy(Rebuilt.pUserAddBuffer, &Rows[i], sizeof(BenchTimeout_t));
+        Rebuilt.ListAddEnd();
+    }
+    double RebuildMs = ElapsedNs(Start) / 1.0e6;
+
+    Start = std::chrono::steady_clock::now();
+    Stored.ListRegister(sizeof(BenchTimeout_t), "Stored", Path, Count);
+    for (long i = 0; i < Count; ++i)
+    {
+        memcpy(Stored.pUserAddBuffer, &Rows[i], sizeof(BenchTimeout_t));
+        Stored.ListAddEnd();
+    }
+    double LoadMs = ElapsedNs(Start) / 1.0e6;
+
+    Start = std::chrono::steady_clock::now();
+    Stored.ListSync();
+    double SyncMs = ElapsedNs(Start) / 1.0e6;
+    Stored.ListDeregister();
+
+    Start = std::chrono::steady_clock::now();
+    Stored.ListRegister(sizeof(BenchTimeout_t), "Stored", Path, Count);
+    double OpenMs = ElapsedNs(Start) / 1.0e6;
+    for (LLCursor Cursor = Stored.begin(); Cursor != Stored.end(); ++Cursor)
+    {
+        Walked += ((BenchTimeout_t*) *Cursor)->SessionId == Walked;
+    }
+    double WalkMs = ElapsedNs(Start) / 1.0e6;
+    Match = Stored.ElementCount == Count && Walked == Count;
+    Stored.ListDeregister();
+
+    if ((Child = fork()) == 0)                                      // Dies with the file open, not marked clean
+    {
+        LLMgr  Crashed;
+
+        Crashed.ListRegister(sizeof(BenchTimeout_t), "Crashed", Path, Count);
+        Crashed.ListPointTop();
+        Crashed.ListDelete();
+        _exit(0);
+    }
+    waitpid(Child, NULL, 0);
+
+    Start = std::chrono::steady_clock::now();
+    Match = Stored.ListRegister(sizeof(BenchTimeout_t), "Stored", Path, Count) == true && Match;
+    double CheckMs = ElapsedNs(Start) / 1.0e6;
+    Match = Match && Stored.ElementCount == Count - 1;
+
+    std::cout << "\n   rebuild in memory, 1M adds           " << RebuildMs << " ms"
+              << "\n   load of the persistent list          " << LoadMs << " ms"
+              << "\n   ListSync()                           " << SyncMs << " ms"
+              << "\n   restart, clean file                  " << OpenMs << " ms"
+              << "\n   restart and first walk               " << WalkMs << " ms"
+              << "\n   restart after a crash, links checked " << CheckMs << " ms"
+              << "\n   rebuild / clean restart              " << RebuildMs / OpenMs << "\n";
+
+    Stored.ListDeregister();
+    Rebuilt.ListDeleteAll();
+    unlink(Path.c_str());
+    return Match;
+}
+
+/*
+*   Shared - a session looked up by its token from another process.  The owner loads 100,000
+*       sessions into a shared list and hands the wire tokens to a reader process, which registers
+*       the segment by name and resolves them itself.  Against it the same lookups sent over a pipe
+*       to a process that keeps the sessions in its own dense list and writes the record back, and
+*       the two lookups in this process.  Nanoseconds a lookup.  On a machine with one core each
+*       round trip is two context switches, with more the server is woken on another core.
+*/
+static bool BenchShared(void)
+{
+    const long   Count   = 100000;
+    const long   Trips   = 20000;
+    std::string  Name    = "/llm-bench-shared-" + std::to_string((long) getpid());
+    std::vector<uint64_t>  SharedWires(Count);
+    std::vector<uint64_t>  OwnWires(Count);
+    LLMgr        Owner;
+    LLMgr        Own;
+    BenchTimeout_t  Session;
+    int          Request[2];
+    int          Reply[2];
+    int          Result[2];
+    double       ReaderNs = 0;
+    long         Found    = 0;
+    bool         Match;
+    pid_t        Child;
+
+    std::cout << "\n\n***************************  BEGIN SHARED BENCHMARK *****************************\n";
+
+    shm_unlink(Name.c_str());
+    Match = Owner.ListRegister(sizeof(BenchTimeout_t), "Owner", Name, Count, LL_OPTION_SHARED)
+         && Own.ListRegister(sizeof(BenchTimeout_t), "Own", LL_OPTION_DENSE);
+    for (long i = 0; i < Count && Match == true; ++i)
+    {
+        memset(&Session, 0, sizeof(Session));
+        Session.SessionId = i;
+        Session.LastSeen  = (i * 7919) % 1000;
+        memcpy(Owner.pUserAddBuffer, &Session, sizeof(Session));
+        memcpy(Own.pUserAddBuffer, &Session, sizeof(Session));
+        Match = Owner.ListAddEnd() && Own.ListAddEnd();
+        SharedWires[i] = Owner.GetWireToken();
+        OwnWires[i]    = Own.GetWireToken();
+    }
+    if (Match == false || pipe(Result) != 0)
+    {
+        Owner.ListDeregister();
+        shm_unlink(Name.c_str());
+        return false;
+    }
+
+    if ((Child = fork()) == 0)                                      // Reader - the segment by name
+    {
+        LLMgr   Reader;
+        long    Hits = 0;
+        double  Ns[2];
+
+        Reader.ListRegister(sizeof(BenchTimeout_t), "Reader", Name, 1, LL_OPTION_SHARED);
+        auto Start = std::chrono::steady_clock::now();
+        for (long i = 0; i < Count; ++i)
+        {
+            if (Reader.SetWirePointer(SharedWires[(i * 7919) % Count]) == true)
+            {
+                memcpy(&Session, Reader.pUserCurrentElement, sizeof(Session));
+                Hits += Session.SessionId == (i * 7919) % Count;
+            }
+        }
+        Ns[0] = ElapsedNs(Start) / Count;
+        Ns[1] = (double) Hits;
+        Reader.ListDeregister();
+        _exit(write(Result[1], Ns, sizeof(Ns)) == (ssize_t) sizeof(Ns) ? 0 : 1);
+    }
+    if (Child > 0)
+    {
+        double  Ns[2] = { 0, 0 };
+
+        if (read(Result[0], Ns, sizeof(Ns)) == (ssize_t) sizeof(Ns))
+        {
+            ReaderNs = Ns[0];
+            Match    = Ns[1] == Count;
+        }
+        waitpid(Child, NULL, 0);
+    }
+    close(Result[0]);
+    close(Result[1]);
+
+    if (pipe(Request) != 0 || pipe(Reply) != 0)
+    {
+        Owner.ListDeregister();
+        shm_unlink(Name.c_str());
+        return false;
+    }
+    if ((Child = fork()) == 0)                                      // Server - the sessions in its own list
+    {
+        uint64_t  Wire;
+
+        close(Request[1]);
+        close(Reply[0]);
+        while (read(Request[0], &Wire, sizeof(Wire)) == (ssize_t) sizeof(Wire))
+        {
+            if (Own.SetWirePointer(Wire) == true)
+            {
+                memcpy(&Session, Own.pUserCurrentElement, sizeof(Session));
+            }
+            else
+            {
+                memset(&Session, 0xff, sizeof(Session));
+            }
+            if (write(Reply[1], &Session, sizeof(Session)) != (ssize_t) sizeof(Session))
+            {
+                break;
+            }
+        }
+        _exit(0);
+    }
+    close(Request[0]);
+    close(Reply[1]);
+
+    auto Start = std::chrono::steady_clock::now();
+    for (long i = 0; i < Trips && Child > 0; ++i)
+    {
+        long  Id = (i * 7919) % Count;
+
+        if (write(Request[1], &OwnWires[Id], sizeof(uint64_t)) != (ssize_t) sizeof(uint64_t)
+         || read(Reply[0], &Session, sizeof(Session)) != (ssize_t) sizeof(Session))
+        {
+            break;
+        }
+        Found += Session.SessionId == Id;
+    }
+    double PipeNs = ElapsedNs(Start) / Trips;
+    close(Request[1]);
+    close(Reply[0]);
+    if (Child > 0)
+    {
+        waitpid(Child, NULL, 0);
+    }
+    Match = Match && Found == Trips;
+
+    Found = 0;
+    Start = std::chrono::steady_clock::now();
+    for (long i = 0; i < Count; ++i)
+    {
+        if (Owner.SetWirePointer(SharedWires[(i * 7919) % Count]) == true)
+        {
+            Found += ((BenchTimeout_t*) Owner.pUserCurrentElement)->SessionId == (i * 7919) % Count;
+        }
+    }
+    double LocalSharedNs = ElapsedNs(Start) / Count;
+
+    Start = std::chrono::steady_clock::now();
+    for (long i = 0; i < Count; ++i)
+    {
+        if (Own.SetWirePointer(OwnWires[(i * 7919) % Count]) == true)
+        {
+            Found += ((BenchTimeout_t*) Own.pUserCurrentElement)->SessionId == (i * 7919) % Count;
+        }
+    }
+    double LocalOwnNs = ElapsedNs(Start) / Count;
+    Match = Match && Found == 2 * Count;
+
+    std::cout << "\n   other process, shared list           " << ReaderNs << " ns"
+              << "\n   other process, pipe round trip       " << PipeNs << " ns"
+              << "\n   this process, shared list            " << LocalSharedNs << " ns"
+              << "\n   this process, own dense list         " << LocalOwnNs << " ns"
+              << "\n   pipe / shared list                   " << PipeNs / ReaderNs << "\n";
+
+    Owner.ListDeleteAll();
+    Owner.ListDeregister();
+    Own.ListDeleteAll();
+    shm_unlink(Name.c_str());
+    return Match;
+}
+
+/*
+*   Table of the benchmarks that can be selected on the command line
+*/
+typedef struct {
+    const char* Name;
+    bool        (*Function)(void);
+} BenchTable_t;
+
+static BenchTable_t BenchArray[] =
+{
+    { "slab", BenchSlab },
+    { "deleteall", BenchDeleteAll },
+    { "status", BenchStatus },
+    { "scaling", BenchScaling },
+    { "batch", BenchBatch },
+    { "sort", BenchSort },
+    { "find", BenchFind },
+    { "seek", BenchSeek },
+    { "position", BenchPosition },
+    { "unrolled", BenchUnrolled },
+    { "dense", BenchDense },
+    { "typed", BenchTyped },
+    { "cursor", BenchCursor },
+    { "handle", BenchHandle },
+    { "wire", BenchWire },
+    { "threads", BenchThreads },
+    { "contention", BenchContention },
+    { "mpsc", BenchMpsc },
+    { "reclaim", BenchReclaim },
+    { "shards", BenchShards },
+    { "parallel", BenchParallel },
+    { "persist", BenchPersist },
+    { "shared", BenchShared },
+};
+
+int main(int argc, char* argv[])
+{
+    int  Failed = 0;
+    int  Rows   = sizeof(BenchArray) / sizeof(BenchArray[0]);
+
+    for (int i = 0; i < Rows; ++i)
+    {
+        bool Selected = (argc < 2);
+
+        for (int a = 1; a < argc; ++a)
+        {
+            if (strcmp(argv[a], BenchArray[i].Name) == 0)
+            {
+                Selected = true;
+            }
+        }
+
+        if (Selected == true && BenchArray[i].Function() == false)
+        {
+            std::cout << "\n *** BENCHMARK FAILED *** " << BenchArray[i].Name << "\n";
+            ++Failed;
+        }
+    }
+
+    std::cout << "\n  END OF BENCHMARKS\n" << endl;
+
+    return Failed ? 1 : 0;
+}
+
+static double ElapsedNs(std::chrono::steady_clock::time_point Start)
+{
+    return (double) std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - Start).count();
+}
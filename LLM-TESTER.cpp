@@ -4,11 +4,95 @@
 
 #include <iostream>
 #include "LLMgr.h"
+#include "LLList.h"
+#include "LLShard.h"
 #include <string>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
 
 using namespace std;
 
 void PrintStatusBlock(LLMgr*,std::string, int, std::string);                // Prototype for print routine at the bottom
+bool MultiListTest(int);                                                    // Prototype for the multiple list thread at the bottom
+int  SortCompare(const void*, const void*);                                 // Prototype for the sort test compare at the bottom
+uint64_t UserHash(const void*);                                             // Prototypes for the find test callbacks at the bottom
+int  UserCompare(const void*, const void*);
+int  DeadlineCompare(const void*, const void*);                             // Prototype for the ordered index test compare at the bottom
+bool PositionCheck(LLMgr*);                                                 // Prototypes for the position test at the bottom
+int  DescendingCompare(const void*, const void*);
+bool LayoutMatch(LLMgr*, LLMgr*);                                           // Prototype for the unrolled and dense tests at the bottom
+long CursorSum(LLMgr*);                                                     // Prototype for the cursor reader threads at the bottom
+long SessionReader(LLMgr*);                                                 // Prototypes for the thread-safe test threads at the bottom
+long SessionWriter(LLMgr*);
+long SpliceChurn(LLMgr*, LLMgr*);
+long InboxProducer(LLMgr*, long);                                           // Prototype for the MPSC test producers at the bottom
+long ReclaimReader(LLMgr*);                                                 // Prototypes for the reclaim test threads at the bottom
+long ReclaimWriter(LLMgr*);
+long ShardLoader(LLShard*, long, DirectToken_t*);                           // Prototypes for the shard test threads at the bottom
+long ShardChecker(LLShard*, long, DirectToken_t*);
+bool ParallelCheck(LLMgr*, LLPool*, long, long);                           // Prototype for the parallel walk test at the bottom
+long StoredWalk(LLMgr*);                                                    // Prototypes for the persistent list test at the bottom
+void StoredChurn(const char*, int);
+long SharedWalk(LLMgr*);                                                    // Prototypes for the shared list test at the bottom
+void SharedChurn(LLMgr*, bool, int);
+
+typedef struct {                                                            // Element of the sort test
+    long  Key;
+    long  Sequence;
+} SortRecord_t;
+
+typedef struct {                                                            // Element of the find test
+    long  SessionId;
+    char  User[24];
+} Session_t;
+
+typedef struct {                                                            // Record of the MPSC test
+    long  Producer;
+    long  Sequence;
+} Posted_t;
+
+typedef struct {                                                            // Element of the reclaim test - Check is ~Value
+    long  Value;
+    long  Check;
+} Tick_t;
+
+typedef struct {                                                            // Element of the persistent list test - Check is Id * 7 + 1
+    long  Id;
+    long  Check;
+    char  Name[48];
+} Stored_t;
+
+typedef struct {                                                            // Element of the shared list test - Check is Worker * 1000003 + Sequence
+    long  Worker;
+    long  Sequence;
+    long  Check;
+    char  Peer[40];
+} Connection_t;
+
+typedef struct {                                                            // Element of the ordered index test
+    long  TimerId;
+    long  Deadline;
+} Timer_t;
+
+struct TypedRecord_t {                                                      // Element of the typed list test - counts the live ones
+    CommandTable_t  Command;
+    static long     Live;
+
+    TypedRecord_t(long Value, const std::string& Name) : Command{ Value, Name } { ++Live; }
+    TypedRecord_t(const TypedRecord_t& Other) : Command(Other.Command) { ++Live; }
+    ~TypedRecord_t() { --Live; }
+};
+long TypedRecord_t::Live = 0;
 
 int main()
 {
@@ -347,41 +431,3066 @@ int main()
 
   std::cout << "\n\n*************************** END OF INSERTION TESTS BEFORE AND AFTER *****************************\n";
 
+  std::cout << "\n\n*************************** BEGIN RESERVE AND REUSE TEST *****************************\n";
+//
+//  Pre-fill the slab, then delete the bottom element and add it back.
+//      The storage of the deleted element becomes the next add buffer.
+//
+    if (pTestLLM->ListReserve(-1) == false)
+    {
+        PrintStatusBlock(pTestLLM, __FILE__, __LINE__, "TEST SUCCESS - Reserve fails TEST - negative count");
+    }
+
+    if (pTestLLM->ListReserve(1000) == true)
+    {
+        std::cout << "\nTEST SUCCESS - Reserved 1000 elements";
+    }
+    else
+    {
+        PrintStatusBlock(pTestLLM, __FILE__, __LINE__, "TEST FAILED - Reserve of 1000 elements");
+    }
+
+    pTestLLM->ListPointBottom();
+    void* pDeleted = pTestLLM->pUserCurrentElement;
+    char  SaveArea[sizeof(CommandTable_t)];
+    memcpy(SaveArea, pTestLLM->pUserCurrentElement, sizeof(CommandTable_t));  // Save the raw element to put it back
+
+    pTestLLM->ListDelete();
+    memcpy(pTestLLM->pUserAddBuffer, SaveArea, sizeof(CommandTable_t));
+    pTestLLM->ListAddEnd();
+
+    if (pTestLLM->pUserAddBuffer == pDeleted)
+    {
+        std::cout << "\nTEST SUCCESS - Deleted element storage reused for the next add\n";
+    }
+    else
+    {
+        PrintStatusBlock(pTestLLM, __FILE__, __LINE__, "TEST FAILED - Deleted element storage not reused");
+    }
+
+  std::cout << "\n\n*************************** END RESERVE AND REUSE TEST *****************************\n";
+
   std::cout << "\n\n*************************** EMPTY LIST and DEREGISTER TEST *****************************\n";
 
-    if (pTestLLM->ListDeleteAll() == false)
+    if (pTestLLM->ListDeleteAll() == false)
+        {
+             PrintStatusBlock(pTestLLM, __FILE__, __LINE__, "TEST Failed  - Not able to delete all the elements");
+        }
+    else 
+        {
+            PrintStatusBlock(pTestLLM, __FILE__, __LINE__, "TEST SUCCESS  - All elements free\n");
+       }
+
+//
+//  Reload a few elements and try the token taken in the DIRECT POINTING TEST.
+//      The element it named was removed by ListDeleteAll() so it must be rejected.
+//
+    for (int i = 0; i < 3; ++i)
+    {
+        memset(pTestLLM->pUserAddBuffer, 0, sizeof(CommandTable_t));
+        pTestLLM->ListAddEnd();
+    }
+
+    if (pTestLLM->SetDirectPointer(testtoken) == false)
+    {
+        PrintStatusBlock(pTestLLM, __FILE__, __LINE__, "TEST SUCCESS  - Token from before ListDeleteAll() rejected");
+    }
+    else
+    {
+        PrintStatusBlock(pTestLLM, __FILE__, __LINE__, "TEST FAILED  - Token from before ListDeleteAll() accepted");
+    }
+
+    if (pTestLLM->ListDeleteAll() == false || pTestLLM->ElementCount != 0)
+    {
+        PrintStatusBlock(pTestLLM, __FILE__, __LINE__, "TEST Failed  - Second delete all");
+    }
+
+    if (pTestLLM->ListDeregister() == true)                             //  No more tests, so look at the status block
+
+     { std::cout << "\nTEST SUCCESS - Deregister Successful \n";
+     }
+     else
+        { 
+            PrintStatusBlock(pTestLLM, __FILE__, __LINE__, "\nTEST FAILED  - LAST STATUS BLOCK\n");
+           std::cout  << " \nELEMENT COUNT = "  << pTestLLM->ElementCount;
+       
+        }
+
+//((CommandTable_p)pTestLLM->pUserAddBuffer)->CommandName = "Test";
+
+    std::cout << "\n\n*************************** END EMPTY LIST and DEREGISTER TEST *****************************\n";
+
+    std::cout << "\n\n*************************** BEGIN MULTIPLE LIST ISOLATION TEST *****************************\n";
+//
+//  Each thread owns its own set of lists, every list registered with a different size.
+//      The lists are loaded, churned and checked byte by byte.  Any state shared between
+//      the instances shows up as a wrong size, a wrong list name or a bad element.
+//
+    std::vector<std::thread> Threads;
+    bool   ThreadResult[4] = { false, false, false, false };
+
+    for (int t = 0; t < 4; ++t)
+    {
+        Threads.push_back(std::thread([t, &ThreadResult]() { ThreadResult[t] = MultiListTest(t); }));
+    }
+    for (std::thread& Thread : Threads)
+    {
+        Thread.join();
+    }
+
+    for (int t = 0; t < 4; ++t)
+    {
+        std::cout << ((ThreadResult[t] == true) ? "\nTEST SUCCESS" : "\nTEST FAILED")
+                  << " - Thread " << t << " - 16 lists isolated";
+    }
+
+    std::cout << "\n\n*************************** END MULTIPLE LIST ISOLATION TEST *****************************\n";
+
+    std::cout << "\n\n*************************** BEGIN BATCH ADD TEST *****************************\n";
+//
+//  Add two records one at a time then five from an array.  The list must read back 0-6 in
+//      order and the current element must be the last record of the batch.
+//
+    LLMgr   BatchList;
+    long    Records[5] = { 2, 3, 4, 5, 6 };
+    long    Value      = 0;
+
+    BatchList.ListRegister(sizeof(long), std::string("Batch List"));
+
+    for (long i = 0; i < 2; ++i)
+    {
+        memcpy(BatchList.pUserAddBuffer, &i, sizeof(long));
+        BatchList.ListAddEnd();
+    }
+
+    if (BatchList.ListAddEndBatch(Records, 0) == false)
+    {
+        PrintStatusBlock(&BatchList, __FILE__, __LINE__, "TEST SUCCESS - Batch add fails TEST - count 0");
+    }
+
+    if (BatchList.ListAddEndBatch(Records, 5) == true && *(long*)BatchList.pUserCurrentElement == 6
+        && BatchList.ElementCount == 7)
+    {
+        std::cout << "\nTEST SUCCESS - Batch of 5 added, current element is the last record";
+    }
+    else
+    {
+        PrintStatusBlock(&BatchList, __FILE__, __LINE__, "TEST FAILED - Batch add");
+    }
+
+    bool  InOrder = BatchList.ListPointTop();
+    do
+    {
+        InOrder = InOrder && (*(long*)BatchList.pUserCurrentElement == Value++);
+    } while (BatchList.ListPointNext() == true);
+
+    std::cout << ((InOrder == true && Value == 7) ? "\nTEST SUCCESS" : "\nTEST FAILED")
+              << " - Batch list reads back in order";
+
+    BatchList.ListPointBottom();
+    BatchList.ListPointLast();
+    DirectToken_t  BatchToken = BatchList.GetDirectToken();
+    BatchList.ListPointTop();
+
+    if (BatchList.SetDirectPointer(BatchToken) == true && *(long*)BatchList.pUserCurrentElement == 5)
+    {
+        std::cout << "\nTEST SUCCESS - Token on a batch element\n";
+    }
+    else
+    {
+        PrintStatusBlock(&BatchList, __FILE__, __LINE__, "TEST FAILED - Token on a batch element");
+    }
+
+    BatchList.ListDeleteAll();
+    BatchList.ListDeregister();
+
+    std::cout << "\n\n*************************** END BATCH ADD TEST *****************************\n";
+
+    std::cout << "\n\n*************************** BEGIN SPLICE TEST *****************************\n";
+//
+//  Active holds 0-9.  Element 3 is moved to Idle on its own, then 5 through 9.  Active must
+//      read 0,1,2,4 and Idle 3,5,6,7,8,9.  A token taken on Active must work on Idle.
+//
+    LLMgr   Active;
+    LLMgr   Idle;
+    LLMgr   Wrong;
+
+    Active.ListRegister(sizeof(long), std::string("Splice Active"));
+    Idle.ListRegister(sizeof(long), std::string("Splice Idle"));
+    Wrong.ListRegister(sizeof(long) * 2, std::string("Splice Wrong Size"));
+
+    for (long i = 0; i < 10; ++i)
+    {
+        memcpy(Active.pUserAddBuffer, &i, sizeof(long));
+        Active.ListAddEnd();
+    }
+
+    Active.ListPointTop();
+    for (int i = 0; i < 5; ++i)
+    {
+        Active.ListPointNext();
+    }
+    DirectToken_t  SpliceToken = Active.GetDirectToken();          // Element 5
+
+    if (Active.ListSpliceToBottom(Wrong) == false)
+    {
+        PrintStatusBlock(&Active, __FILE__, __LINE__, "TEST SUCCESS - Splice to a list of another size fails");
+    }
+    if (Active.ListSpliceAll(Active) == false)
+    {
+        PrintStatusBlock(&Active, __FILE__, __LINE__, "TEST SUCCESS - Splice to the same list fails");
+    }
+
+    Active.ListPointTop();
+    for (int i = 0; i < 3; ++i)
+    {
+        Active.ListPointNext();
+    }
+    if (Active.ListSpliceCurrent(Idle) == true && *(long*)Active.pUserCurrentElement == 4
+        && *(long*)Idle.pUserCurrentElement == 3)
+    {
+        std::cout << "\nTEST SUCCESS - Splice current element 3, Active moved on to 4";
+    }
+    else
+    {
+        PrintStatusBlock(&Active, __FILE__, __LINE__, "TEST FAILED - Splice current element");
+    }
+
+    Active.ListPointNext();                                         // Element 5
+    if (Active.ListSpliceToBottom(Idle) == true && *(long*)Active.pUserCurrentElement == 4
+        && Active.ElementCount == 4 && Idle.ElementCount == 6)
+    {
+        std::cout << "\nTEST SUCCESS - Splice 5 through the bottom";
+    }
+    else
+    {
+        PrintStatusBlock(&Active, __FILE__, __LINE__, "TEST FAILED - Splice to bottom");
+    }
+
+    long  ActiveExpect[4] = { 0, 1, 2, 4 };
+    long  IdleExpect[6]   = { 3, 5, 6, 7, 8, 9 };
+    bool  SpliceOrder     = Active.ListPointTop() && Idle.ListPointTop();
+
+    for (int i = 0; i < 4; ++i)
+    {
+        SpliceOrder = SpliceOrder && *(long*)Active.pUserCurrentElement == ActiveExpect[i];
+        Active.ListPointNext();
+    }
+    for (int i = 0; i < 6; ++i)
+    {
+        SpliceOrder = SpliceOrder && *(long*)Idle.pUserCurrentElement == IdleExpect[i];
+        Idle.ListPointNext();
+    }
+    SpliceOrder = SpliceOrder && Idle.ListPointLast() && *(long*)Idle.pUserCurrentElement == 8;
+
+    std::cout << ((SpliceOrder == true) ? "\nTEST SUCCESS" : "\nTEST FAILED")
+              << " - Both lists read back in order forward and back";
+
+    if (Idle.SetDirectPointer(SpliceToken) == true && *(long*)Idle.pUserCurrentElement == 5)
+    {
+        std::cout << "\nTEST SUCCESS - Token from Active works on Idle";
+    }
+    else
+    {
+        PrintStatusBlock(&Idle, __FILE__, __LINE__, "TEST FAILED - Token after splice");
+    }
+
+    Active.ListPointTop();
+    if (Active.SetDirectPointer(SpliceToken) == false
+        && Active.GetStatus().Smessage.find("LL_STATUS_INVALIDADDRESS") != std::string::npos
+        && *(long*)Active.pUserCurrentElement == 0 && Active.ListDelete() == true && Active.ElementCount == 3
+        && *(long*)Active.pUserCurrentElement == 1)
+    {
+        std::cout << "\nTEST SUCCESS - Token of a spliced element turned down on Active, its delete stays on Active";
+    }
+    else
+    {
+        PrintStatusBlock(&Active, __FILE__, __LINE__, "TEST FAILED - Spliced token accepted on the old list");
+    }
+//
+//  Active goes away while Idle still has its elements.  They must stay readable and can be
+//      moved back to a new list and deleted.
+//
+    Active.ListDeleteAll();
+    Active.ListDeregister();
+
+    long  IdleSum = 0;
+    Idle.ListPointTop();
+    do
+    {
+        IdleSum += *(long*)Idle.pUserCurrentElement;
+    } while (Idle.ListPointNext() == true);
+
+    Active.ListRegister(sizeof(long), std::string("Splice Active Again"));
+
+    if (IdleSum == 38 && Idle.ListSpliceAll(Active) == true && Idle.ElementCount == 0
+        && Active.ElementCount == 6 && Idle.pUserCurrentElement == NULL)
+    {
+        std::cout << "\nTEST SUCCESS - Elements outlive their list and splice back\n";
+    }
+    else
+    {
+        PrintStatusBlock(&Idle, __FILE__, __LINE__, "TEST FAILED - Splice all");
+    }
+//
+//  The token of element 5 follows it through a whole list splice and a splice of a run back - only the
+//      list it is in takes it.
+//
+    bool  Followed = Active.SetDirectPointer(SpliceToken) == true && *(long*)Active.pUserCurrentElement == 5
+                  && Idle.SetDirectPointer(SpliceToken) == false;
+
+    Active.ListPointTop();
+    Active.ListPointNext();
+    Followed = Followed && Active.ListSpliceToBottom(Idle) == true && Active.ElementCount == 1 && Idle.ElementCount == 5
+            && Active.SetDirectPointer(SpliceToken) == false
+            && Idle.SetDirectPointer(SpliceToken) == true && *(long*)Idle.pUserCurrentElement == 5
+            && Idle.ListDelete() == true && Idle.SetDirectPointer(SpliceToken) == false && Idle.ElementCount == 4;
+
+    if (Followed == true)
+    {
+        std::cout << "\nTEST SUCCESS - Token followed its element through splice all and splice to bottom\n";
+    }
+    else
+    {
+        PrintStatusBlock(&Idle, __FILE__, __LINE__, "TEST FAILED - Token after splice all");
+    }
+
+    Active.ListDeleteAll();
+    Active.ListDeregister();
+    Idle.ListDeleteAll();
+    Idle.ListDeregister();
+    Wrong.ListDeregister();
+
+    std::cout << "\n\n*************************** END SPLICE TEST *****************************\n";
+
+    std::cout << "\n\n*************************** BEGIN SORT TEST *****************************\n";
+//
+//  1000 records with keys 0-9 in a scrambled order.  Sorted on the key only, so records with the
+//      same key must keep their add order (Sequence).  A token taken before the sort must still
+//      point at the same record afterwards.
+//
+    LLMgr          SortList;
+    SortRecord_t   Record;
+    DirectToken_t  SortToken;
+    long           SortKey = 0;
+
+    SortList.ListRegister(sizeof(SortRecord_t), std::string("Sort List"));
+
+    if (SortList.ListSort(SortCompare) == true)
+    {
+        std::cout << "\nTEST SUCCESS - Sort of an empty list";
+    }
+    if (SortList.ListSort(NULL) == false)
+    {
+        PrintStatusBlock(&SortList, __FILE__, __LINE__, "TEST SUCCESS - Sort fails TEST - no compare function");
+    }
+
+    for (long i = 0; i < 1000; ++i)
+    {
+        Record.Key      = (i * 7919) % 10;
+        Record.Sequence = i;
+        memcpy(SortList.pUserAddBuffer, &Record, sizeof(SortRecord_t));
+        SortList.ListAddEnd();
+        if (i == 500)
+        {
+            SortToken = SortList.GetDirectToken();
+            SortKey   = Record.Key;
+        }
+    }
+
+    bool  Sorted = SortList.ListSort(SortCompare) && SortList.ElementCount == 1000;
+    long  Seen   = 0;
+
+    SortList.ListPointTop();
+    memcpy(&Record, SortList.pUserCurrentElement, sizeof(SortRecord_t));
+    ++Seen;
+    while (SortList.ListPointNext() == true)
+    {
+        SortRecord_t  *pNow = (SortRecord_t *) SortList.pUserCurrentElement;
+
+        Sorted = Sorted && (pNow->Key > Record.Key
+                            || (pNow->Key == Record.Key && pNow->Sequence > Record.Sequence));
+        Record = *pNow;
+        ++Seen;
+    }
+    std::cout << ((Sorted == true && Seen == 1000) ? "\nTEST SUCCESS" : "\nTEST FAILED")
+              << " - 1000 records sorted by key, equal keys in add order";
+
+    Seen = 1;                                                       // Walk back from the bottom
+    while (SortList.ListPointLast() == true)
+    {
+        ++Seen;
+    }
+    std::cout << ((Seen == 1000) ? "\nTEST SUCCESS" : "\nTEST FAILED") << " - Backward links after the sort";
+
+    if (SortList.SetDirectPointer(SortToken) == true && ((SortRecord_t *) SortList.pUserCurrentElement)->Sequence == 500
+        && ((SortRecord_t *) SortList.pUserCurrentElement)->Key == SortKey)
+    {
+        std::cout << "\nTEST SUCCESS - Token taken before the sort\n";
+    }
+    else
+    {
+        PrintStatusBlock(&SortList, __FILE__, __LINE__, "TEST FAILED - Token after sort");
+    }
+
+    SortList.ListDeleteAll();
+    SortList.ListDeregister();
+
+    std::cout << "\n\n*************************** END SORT TEST *****************************\n";
+
+    std::cout << "\n\n*************************** BEGIN FIND TEST *****************************\n";
+//
+//  Sessions indexed on SessionId.  100000 adds make the index grow many times, then every
+//      third session is deleted.  Every session must be found or not found as it should.
+//
+    LLMgr      Sessions;
+    LLMgr      Users;
+    LLMgr      NoIndex;
+    Session_t  Session;
+    long       FindId;
+    long       Misses = 0;
+
+    if (Sessions.ListRegister(sizeof(Session_t), std::string("Sessions"), 28, 8) == false)
+    {
+        PrintStatusBlock(&Sessions, __FILE__, __LINE__, "TEST SUCCESS - Register fails TEST - key past the user area");
+    }
+    Sessions.ListRegister(sizeof(Session_t), std::string("Sessions"), offsetof(Session_t, SessionId), sizeof(long));
+    Users.ListRegister(sizeof(Session_t), std::string("Users"), UserHash, UserCompare);
+    NoIndex.ListRegister(sizeof(Session_t), std::string("No Index"));
+
+    memset(&Session, 0, sizeof(Session_t));
+    for (long i = 0; i < 100000; ++i)
+    {
+        Session.SessionId = i * 13;
+        snprintf(Session.User, sizeof(Session.User), "user%ld", i);
+        memcpy(Sessions.pUserAddBuffer, &Session, sizeof(Session_t));
+        Sessions.ListAddEnd();
+    }
+
+    for (long i = 0; i < 100000; i += 3)
+    {
+        FindId = i * 13;
+        if (Sessions.ListFind(&FindId) == true)
+        {
+            Sessions.ListDelete();
+        }
+    }
+
+    for (long i = 0; i < 100000; ++i)
+    {
+        FindId = i * 13;
+        bool Found = Sessions.ListFind(&FindId);
+
+        if (Found != (i % 3 != 0) || (Found == true && ((Session_t*) Sessions.pUserCurrentElement)->SessionId != FindId))
+        {
+            ++Misses;
+        }
+    }
+    FindId = 7;
+    if (Misses == 0 && Sessions.ElementCount == 66666 && Sessions.ListFind(&FindId) == false)
+    {
+        PrintStatusBlock(&Sessions, __FILE__, __LINE__, "TEST SUCCESS - 100000 adds, 33334 deletes, every key found or not found");
+    }
+    else
+    {
+        std::cout << "\nTEST FAILED - Find after adds and deletes, misses: " << Misses;
+    }
+
+    Sessions.ListPointTop();
+    Session.SessionId = -1;
+    memcpy(Sessions.pUserAddBuffer, &Session, sizeof(Session_t));
+    Sessions.ListAddBefore();
+    FindId = -1;
+    if (Sessions.ListFind(&FindId) == true && Sessions.ListPointLast() == false)
+    {
+        std::cout << "\nTEST SUCCESS - ListAddBefore() element is indexed";
+    }
+    else
+    {
+        PrintStatusBlock(&Sessions, __FILE__, __LINE__, "TEST FAILED - Find after ListAddBefore()");
+    }
+
+    if (NoIndex.ListFind(&FindId) == false)
+    {
+        PrintStatusBlock(&NoIndex, __FILE__, __LINE__, "TEST SUCCESS - Find fails TEST - list has no index");
+    }
+//
+//  Callback index on the user name.  The key passed to ListFind() is a whole record.
+//      A session spliced from Sessions shows up in Users and is gone from Sessions.
+//
+    FindId = 13;
+    Sessions.ListFind(&FindId);
+    Sessions.ListSpliceCurrent(Users);
+
+    memset(Users.pUserAddBuffer, 0, sizeof(Session_t));
+    strcpy(((Session_t*) Users.pUserAddBuffer)->User, "user1");
+
+    if (Users.ListFind(Users.pUserAddBuffer) == true && ((Session_t*) Users.pUserCurrentElement)->SessionId == 13
+        && Sessions.ListFind(&FindId) == false)
+    {
+        std::cout << "\nTEST SUCCESS - Spliced session found by user name in the other list";
+    }
+    else
+    {
+        PrintStatusBlock(&Users, __FILE__, __LINE__, "TEST FAILED - Find after splice");
+    }
+
+    Sessions.ListDeleteAll();
+    FindId = 26;
+    if (Sessions.ListFind(&FindId) == false)
+    {
+        std::cout << "\nTEST SUCCESS - Index is empty after ListDeleteAll()\n";
+    }
+
+    Sessions.ListDeregister();
+    Users.ListDeleteAll();
+    Users.ListDeregister();
+    NoIndex.ListDeregister();
+
+    std::cout << "\n\n*************************** END FIND TEST *****************************\n";
+
+    std::cout << "\n\n*************************** BEGIN ORDERED INDEX TEST *****************************\n";
+//
+//  Timers ordered on Deadline.  The index is added after the first 5000 timers so they
+//      have to be picked up, the rest go in by ListAddEnd(), ListAddBefore() and
+//      ListAddAfter().  Every answer from the index is checked against a scan of the list.
+//
+    LLMgr      Timers;
+    LLMgr      Fired;
+    LLMgr      NoTree;
+    Timer_t    Timer;
+    long       SeekKey;
+    long       Expect;
+    long       Previous;
+    unsigned long Seed = 12345;
+
+    if (Timers.ListOrderIndex(offsetof(Timer_t, Deadline), sizeof(long), DeadlineCompare) == false)
+    {
+        PrintStatusBlock(&Timers, __FILE__, __LINE__, "TEST SUCCESS - Order index fails TEST - list not registered");
+    }
+    Timers.ListRegister(sizeof(Timer_t), std::string("Timers"));
+    Fired.ListRegister(sizeof(Timer_t), std::string("Fired"));
+    NoTree.ListRegister(sizeof(Timer_t), std::string("No Tree"));
+
+    if (Timers.ListOrderIndex(12, sizeof(long), DeadlineCompare) == false)
+    {
+        PrintStatusBlock(&Timers, __FILE__, __LINE__, "TEST SUCCESS - Order index fails TEST - key past the user area");
+    }
+
+    for (long i = 0; i < 20000; ++i)
+    {
+        Seed = Seed * 6364136223846793005UL + 1442695040888963407UL;
+        Timer.TimerId  = i;
+        Timer.Deadline = (long) ((Seed >> 33) % 100000);
+        memcpy(Timers.pUserAddBuffer, &Timer, sizeof(Timer_t));
+
+        if (i == 5000)
+        {
+            if (Timers.ListOrderIndex(offsetof(Timer_t, Deadline), sizeof(long), DeadlineCompare) == true)
+            {
+                std::cout << "\nTEST SUCCESS - Order index added to a list of 5000 timers";
+            }
+            else
+            {
+                PrintStatusBlock(&Timers, __FILE__, __LINE__, "TEST FAILED - Order index on a list with elements");
+            }
+            Fired.ListOrderIndex(offsetof(Timer_t, Deadline), sizeof(long), DeadlineCompare);
+        }
+
+        if (i % 3 == 1)
+        {
+            Timers.ListAddBefore();
+        }
+        else if (i % 3 == 2)
+        {
+            Timers.ListAddAfter();
+        }
+        else
+        {
+            Timers.ListAddEnd();
+        }
+    }
+//
+//  First timer due at or after now - the smallest deadline >= now in the list
+//
+    SeekKey = 50000;
+    Expect  = 100000;
+    Timers.ListPointTop();
+    do
+    {
+        Timer_t *pScan = (Timer_t*) Timers.pUserCurrentElement;
+        if (pScan->Deadline >= SeekKey && pScan->Deadline < Expect)
+        {
+            Expect = pScan->Deadline;
+        }
+    } while (Timers.ListPointNext() == true);
+
+    if (Timers.ListSeek(&SeekKey) == true && ((Timer_t*) Timers.pUserCurrentElement)->Deadline == Expect)
+    {
+        std::cout << "\nTEST SUCCESS - Seek to the first deadline >= 50000, found " << Expect;
+    }
+    else
+    {
+        PrintStatusBlock(&Timers, __FILE__, __LINE__, "TEST FAILED - Seek to the first deadline >= now");
+    }
+//
+//  Range [10000, 40000) in deadline order against a count from a scan
+//
+    Expect = 0;
+    Timers.ListPointTop();
+    do
+    {
+        Timer_t *pScan = (Timer_t*) Timers.pUserCurrentElement;
+        Expect += (pScan->Deadline >= 10000 && pScan->Deadline < 40000);
+    } while (Timers.ListPointNext() == true);
+
+    SeekKey  = 10000;
+    Seen     = 0;
+    Previous = SeekKey;
+    InOrder  = true;
+    for (bool More = Timers.ListSeek(&SeekKey); More == true; More = Timers.ListSeekNext())
+    {
+        Timer_t *pScan = (Timer_t*) Timers.pUserCurrentElement;
+        if (pScan->Deadline >= 40000)
+        {
+            break;
+        }
+        InOrder  = InOrder && pScan->Deadline >= Previous;
+        Previous = pScan->Deadline;
+        ++Seen;
+    }
+
+    if (Seen == Expect && InOrder == true)
+    {
+        std::cout << "\nTEST SUCCESS - Range [10000, 40000) walked in order, timers: " << Seen;
+    }
+    else
+    {
+        std::cout << "\nTEST FAILED - Range walk, expected " << Expect << " saw " << Seen;
+    }
+//
+//  Fire everything due before 20000 - delete while walking the range
+//
+    Expect = Timers.ElementCount;
+    Seen   = 0;
+    SeekKey = 0;
+    for (bool More = Timers.ListSeek(&SeekKey); More == true && ((Timer_t*) Timers.pUserCurrentElement)->Deadline < 20000; )
+    {
+        Timers.ListDelete();
+        ++Seen;
+        More = Timers.ListSeekNext();
+    }
+
+    Previous = 100000;
+    Timers.ListPointTop();
+    do
+    {
+        Timer_t *pScan = (Timer_t*) Timers.pUserCurrentElement;
+        if (pScan->Deadline < Previous)
+        {
+            Previous = pScan->Deadline;
+        }
+    } while (Timers.ListPointNext() == true);
+
+    if (Previous >= 20000 && Timers.ElementCount == Expect - Seen && Timers.ListSeek(&SeekKey) == true
+        && ((Timer_t*) Timers.pUserCurrentElement)->Deadline == Previous)
+    {
+        std::cout << "\nTEST SUCCESS - Deleted while walking, timers fired: " << Seen;
+    }
+    else
+    {
+        PrintStatusBlock(&Timers, __FILE__, __LINE__, "TEST FAILED - Delete while walking the range");
+    }
+//
+//  A timer spliced to Fired is in the Fired index and gone from the Timers index
+//
+    Timers.ListSeek(&SeekKey);
+    Timer = *(Timer_t*) Timers.pUserCurrentElement;
+    Timers.ListSpliceCurrent(Fired);
+
+    if (Fired.ListSeek(&SeekKey) == true && ((Timer_t*) Fired.pUserCurrentElement)->TimerId == Timer.TimerId
+        && Timers.ListSeek(&SeekKey) == true && ((Timer_t*) Timers.pUserCurrentElement)->TimerId != Timer.TimerId)
+    {
+        std::cout << "\nTEST SUCCESS - Spliced timer moved between the order indexes";
+    }
+    else
+    {
+        PrintStatusBlock(&Fired, __FILE__, __LINE__, "TEST FAILED - Seek after splice");
+    }
+
+    SeekKey = 100000;
+    if (Timers.ListSeek(&SeekKey) == false)
+    {
+        PrintStatusBlock(&Timers, __FILE__, __LINE__, "TEST SUCCESS - Seek fails TEST - no deadline that late");
+    }
+
+    if (NoTree.ListSeek(&SeekKey) == false)
+    {
+        PrintStatusBlock(&NoTree, __FILE__, __LINE__, "TEST SUCCESS - Seek fails TEST - list has no order index");
+    }
+
+    Timers.ListDeleteAll();
+    SeekKey = 0;
+    if (Timers.ListSeek(&SeekKey) == false)
+    {
+        std::cout << "\nTEST SUCCESS - Order index is empty after ListDeleteAll()\n";
+    }
+
+    Timers.ListDeregister();
+    Fired.ListDeleteAll();
+    Fired.ListDeregister();
+    NoTree.ListDeregister();
+
+    std::cout << "\n\n*************************** END ORDERED INDEX TEST *****************************\n";
+
+    std::cout << "\n\n*************************** BEGIN POSITION TEST *****************************\n";
+//
+//  A list with the position index built by every kind of add, then deleted from by position,
+//      sorted and spliced.  PositionCheck() walks the list and asks the index for every position.
+//
+    LLMgr      Pages;
+    LLMgr      Archive;
+    LLMgr      NoPosition;
+    long       Batch[500];
+
+    if (Pages.ListRegister(sizeof(long), std::string("Pages"), 0x0100) == false)
+    {
+        PrintStatusBlock(&Pages, __FILE__, __LINE__, "TEST SUCCESS - Register fails TEST - unknown option");
+    }
+    Pages.ListRegister(sizeof(long), std::string("Pages"), LL_OPTION_POSITION);
+    Archive.ListRegister(sizeof(long), std::string("Archive"), LL_OPTION_POSITION);
+    NoPosition.ListRegister(sizeof(long), std::string("No Position"));
+
+    for (long i = 0; i < 10000; ++i)
+    {
+        *(long*) Pages.pUserAddBuffer = i;
+
+        if (i % 4 == 1)
+        {
+            Pages.ListAddBefore();
+        }
+        else if (i % 4 == 2)
+        {
+            Pages.ListAddAfter();
+        }
+        else if (i % 4 == 3)
+        {
+            Pages.ListPointIndex((i * 7919) % Pages.ElementCount);
+            Pages.ListAddAfter();
+        }
+        else
+        {
+            Pages.ListAddEnd();
+        }
+    }
+    for (long i = 0; i < 500; ++i)
+    {
+        Batch[i] = 10000 + i;
+    }
+    Pages.ListAddEndBatch(Batch, 500);
+
+    if (PositionCheck(&Pages) == true && Pages.ListPointIndex(10499) == true && *(long*) Pages.pUserCurrentElement == 10499)
+    {
+        std::cout << "\nTEST SUCCESS - Every position found after ListAddEnd(), Before, After and Batch";
+    }
+    else
+    {
+        PrintStatusBlock(&Pages, __FILE__, __LINE__, "TEST FAILED - Positions after adds");
+    }
+
+    for (long i = Pages.ElementCount - 1; i >= 0; i -= 7)
+    {
+        Pages.ListPointIndex(i);
+        Pages.ListDelete();
+    }
+
+    if (PositionCheck(&Pages) == true && Pages.ElementCount == 9000)
+    {
+        std::cout << "\nTEST SUCCESS - Every position found after deleting every 7th";
+    }
+    else
+    {
+        PrintStatusBlock(&Pages, __FILE__, __LINE__, "TEST FAILED - Positions after deletes");
+    }
+
+    long  Largest = 0;
+
+    Pages.ListPointTop();
+    do
+    {
+        Largest = std::max(Largest, *(long*) Pages.pUserCurrentElement);
+    } while (Pages.ListPointNext() == true);
+
+    Pages.ListSort(DescendingCompare);
+    Pages.ListPointIndex(0);
+    Value = *(long*) Pages.pUserCurrentElement;
+
+    if (PositionCheck(&Pages) == true && Value == Largest)
+    {
+        std::cout << "\nTEST SUCCESS - Every position found after ListSort()";
+    }
+    else
+    {
+        PrintStatusBlock(&Pages, __FILE__, __LINE__, "TEST FAILED - Positions after sort");
+    }
+
+    Pages.ListPointIndex(100);
+    Value = *(long*) Pages.pUserCurrentElement;
+    Pages.ListSpliceToBottom(Archive);
+
+    if (Pages.ElementCount == 100 && Archive.ElementCount == 8900 && Archive.ListCurrentIndex() == 0
+        && *(long*) Archive.pUserCurrentElement == Value && PositionCheck(&Pages) == true && PositionCheck(&Archive) == true)
+    {
+        std::cout << "\nTEST SUCCESS - Positions in both lists after a splice";
+    }
+    else
+    {
+        PrintStatusBlock(&Archive, __FILE__, __LINE__, "TEST FAILED - Positions after splice");
+    }
+
+    if (Pages.ListSpliceCurrent(NoPosition) == false)
+    {
+        PrintStatusBlock(&Pages, __FILE__, __LINE__, "TEST SUCCESS - Splice fails TEST - target has no position index");
+    }
+
+    if (Pages.ListPointIndex(100) == false)
+    {
+        PrintStatusBlock(&Pages, __FILE__, __LINE__, "TEST SUCCESS - Point index fails TEST - past the end");
+    }
+
+    if (NoPosition.ListPointIndex(0) == false)
+    {
+        PrintStatusBlock(&NoPosition, __FILE__, __LINE__, "TEST SUCCESS - Point index fails TEST - list has no position index");
+    }
+
+    Pages.ListDeleteAll();
+    if (Pages.ListPointIndex(0) == false && PositionCheck(&Pages) == true)
+    {
+        std::cout << "\nTEST SUCCESS - Position index is empty after ListDeleteAll()\n";
+    }
+
+    Pages.ListDeregister();
+    Archive.ListDeleteAll();
+    Archive.ListDeregister();
+    NoPosition.ListDeregister();
+
+    std::cout << "\n\n*************************** END POSITION TEST *****************************\n";
+
+    std::cout << "\n\n*************************** BEGIN UNROLLED TEST *****************************\n";
+//
+//  The same adds, moves and deletes are done on a classic list and on unrolled lists with small
+//      and big records.  LayoutMatch() walks both ways and compares the records.
+//
+    LLMgr      Classic;
+    LLMgr      Packed;
+    LLMgr      Wide;
+    char       WideRecord[3000];
+    bool       SameCurrent = true;
+
+    if (Packed.ListRegister(sizeof(long), std::string("Packed"), LL_OPTION_UNROLLED | LL_OPTION_POSITION) == false)
+    {
+        PrintStatusBlock(&Packed, __FILE__, __LINE__, "TEST SUCCESS - Register fails TEST - unrolled with a position index");
+    }
+    if (Packed.ListRegister(sizeof(long), std::string("Packed"), 0, sizeof(long), LL_OPTION_UNROLLED) == false)
+    {
+        PrintStatusBlock(&Packed, __FILE__, __LINE__, "TEST SUCCESS - Register fails TEST - unrolled with a key index");
+    }
+    Classic.ListRegister(sizeof(long), std::string("Classic"));
+    Packed.ListRegister(sizeof(long), std::string("Packed"), LL_OPTION_UNROLLED);
+    Wide.ListRegister(sizeof(WideRecord), std::string("Wide"), LL_OPTION_UNROLLED);
+    memset(WideRecord, 0, sizeof(WideRecord));
+
+    srand(12);
+    for (long i = 0; i < 60000; ++i)
+    {
+        int  Op = rand() % 100;
+
+        *(long*) Classic.pUserAddBuffer = i;
+        *(long*) Packed.pUserAddBuffer  = i;
+        *(long*) Wide.pUserAddBuffer    = i;
+
+        if (Op < 20 || Classic.ElementCount == 0)
+        {
+            Classic.ListAddEnd();
+            Packed.ListAddEnd();
+            Wide.ListAddEnd();
+        }
+        else if (Op < 35)
+        {
+            Classic.ListAddBefore();
+            Packed.ListAddBefore();
+            Wide.ListAddBefore();
+        }
+        else if (Op < 55)
+        {
+            Classic.ListAddAfter();
+            Packed.ListAddAfter();
+            Wide.ListAddAfter();
+        }
+        else if (Op < 62)
+        {
+            Classic.ListPointTop();
+            Packed.ListPointTop();
+            Wide.ListPointTop();
+        }
+        else if (Op < 70)
+        {
+            for (int Step = rand() % 40; Step > 0; --Step)
+            {
+                Classic.ListPointNext();
+                Packed.ListPointNext();
+                Wide.ListPointNext();
+            }
+        }
+        else if (Op < 75)
+        {
+            for (int Step = rand() % 40; Step > 0; --Step)
+            {
+                Classic.ListPointLast();
+                Packed.ListPointLast();
+                Wide.ListPointLast();
+            }
+        }
+        else
+        {
+            Classic.ListDelete();
+            Packed.ListDelete();
+            Wide.ListDelete();
+        }
+
+        if (Classic.ElementCount > 0 && (*(long*) Packed.pUserCurrentElement != *(long*) Classic.pUserCurrentElement
+                                      || *(long*) Wide.pUserCurrentElement != *(long*) Classic.pUserCurrentElement))
+        {
+            SameCurrent = false;
+        }
+    }
+
+    if (SameCurrent == true && LayoutMatch(&Classic, &Packed) == true && LayoutMatch(&Classic, &Wide) == true)
+    {
+        std::cout << "\nTEST SUCCESS - Unrolled lists match the classic list after " << Classic.ElementCount << " elements of adds and deletes";
+    }
+    else
+    {
+        PrintStatusBlock(&Packed, __FILE__, __LINE__, "TEST FAILED - Unrolled lists do not match the classic list");
+    }
+
+    for (long i = 0; i < 500; ++i)
+    {
+        Batch[i] = 100000 + i;
+    }
+    Classic.ListAddEndBatch(Batch, 500);
+    Packed.ListAddEndBatch(Batch, 500);
+
+    if (*(long*) Packed.pUserCurrentElement == 100499 && LayoutMatch(&Classic, &Packed) == true)
+    {
+        std::cout << "\nTEST SUCCESS - Unrolled batch add";
+    }
+    else
+    {
+        PrintStatusBlock(&Packed, __FILE__, __LINE__, "TEST FAILED - Unrolled batch add");
+    }
+
+    Packed.ListPointTop();
+    for (long i = 0; i < Packed.ElementCount / 2; ++i)
+    {
+        Packed.ListPointNext();
+    }
+    Value = *(long*) Packed.pUserCurrentElement;
+    DirectToken_t  UnrollToken = Packed.GetDirectToken();
+    Packed.ListPointTop();
+
+    if (Packed.SetDirectPointer(UnrollToken) == true && *(long*) Packed.pUserCurrentElement == Value)
+    {
+        std::cout << "\nTEST SUCCESS - Unrolled token points back to the record";
+    }
+    else
+    {
+        PrintStatusBlock(&Packed, __FILE__, __LINE__, "TEST FAILED - Unrolled token");
+    }
+
+    Packed.ListDelete();
+    if (Packed.SetDirectPointer(UnrollToken) == false)
+    {
+        PrintStatusBlock(&Packed, __FILE__, __LINE__, "TEST SUCCESS - Token fails TEST - unrolled record deleted");
+    }
+    else
+    {
+        PrintStatusBlock(&Packed, __FILE__, __LINE__, "TEST FAILED - Token of a deleted unrolled record accepted");
+    }
+
+    if (Packed.ListSort(SortCompare) == false && Packed.ListSpliceCurrent(Classic) == false
+        && Packed.ListOrderIndex(0, sizeof(long), SortCompare) == false)
+    {
+        PrintStatusBlock(&Packed, __FILE__, __LINE__, "TEST SUCCESS - Sort, splice and ordered index fail TEST - unrolled list");
+    }
+
+    UnrollToken = Packed.GetDirectToken();
+    Packed.ListDeleteAll();
+    *(long*) Packed.pUserAddBuffer = 1;
+    Packed.ListAddEnd();
+
+    if (Packed.SetDirectPointer(UnrollToken) == false && Packed.ElementCount == 1 && Packed.ListPointNext() == false)
+    {
+        std::cout << "\nTEST SUCCESS - Unrolled token fails after ListDeleteAll()\n";
+    }
+    else
+    {
+        PrintStatusBlock(&Packed, __FILE__, __LINE__, "TEST FAILED - Unrolled token after ListDeleteAll()");
+    }
+
+    Classic.ListDeleteAll();
+    Classic.ListDeregister();
+    Packed.ListDeleteAll();
+    Packed.ListDeregister();
+    Wide.ListDeleteAll();
+    Wide.ListDeregister();
+
+    std::cout << "\n\n*************************** END UNROLLED TEST *****************************\n";
+
+    std::cout << "\n\n*************************** BEGIN DENSE TEST *****************************\n";
+//
+//  The same adds, moves and deletes on a classic list and a dense list, then tokens on the dense list.
+//
+    LLMgr      Links;
+    LLMgr      Reference;
+
+    if (Links.ListRegister(sizeof(long), std::string("Links"), LL_OPTION_DENSE | LL_OPTION_UNROLLED) == false)
+    {
+        PrintStatusBlock(&Links, __FILE__, __LINE__, "TEST SUCCESS - Register fails TEST - dense and unrolled");
+    }
+    Reference.ListRegister(sizeof(long), std::string("Reference"));
+    Links.ListRegister(sizeof(long), std::string("Links"), LL_OPTION_DENSE);
+
+    SameCurrent = true;
+    srand(13);
+    for (long i = 0; i < 60000; ++i)
+    {
+        int  Op = rand() % 100;
+
+        *(long*) Reference.pUserAddBuffer = i;
+        *(long*) Links.pUserAddBuffer     = i;
+
+        if (Op < 20 || Reference.ElementCount == 0)
+        {
+            Reference.ListAddEnd();
+            Links.ListAddEnd();
+        }
+        else if (Op < 35)
+        {
+            Reference.ListAddBefore();
+            Links.ListAddBefore();
+        }
+        else if (Op < 55)
+        {
+            Reference.ListAddAfter();
+            Links.ListAddAfter();
+        }
+        else if (Op < 62)
+        {
+            Reference.ListPointBottom();
+            Links.ListPointBottom();
+        }
+        else if (Op < 75)
+        {
+            for (int Step = rand() % 40; Step > 0; --Step)
+            {
+                Reference.ListPointLast();
+                Links.ListPointLast();
+            }
+        }
+        else
+        {
+            Reference.ListDelete();
+            Links.ListDelete();
+        }
+
+        if (Reference.ElementCount > 0 && *(long*) Links.pUserCurrentElement != *(long*) Reference.pUserCurrentElement)
+        {
+            SameCurrent = false;
+        }
+    }
+
+    Reference.ListAddEndBatch(Batch, 500);
+    Links.ListAddEndBatch(Batch, 500);
+
+    if (SameCurrent == true && *(long*) Links.pUserCurrentElement == Batch[499] && LayoutMatch(&Reference, &Links) == true)
+    {
+        std::cout << "\nTEST SUCCESS - Dense list matches the classic list after " << Links.ElementCount << " elements of adds and deletes";
+    }
+    else
+    {
+        PrintStatusBlock(&Links, __FILE__, __LINE__, "TEST FAILED - Dense list does not match the classic list");
+    }
+
+    Links.ListPointTop();
+    Links.ListPointNext();
+    Value = *(long*) Links.pUserCurrentElement;
+    DirectToken_t  DenseToken = Links.GetDirectToken();
+    Links.ListPointBottom();
+
+    if (Links.SetDirectPointer(DenseToken) == true && *(long*) Links.pUserCurrentElement == Value)
+    {
+        std::cout << "\nTEST SUCCESS - Dense token points back to the element";
+    }
+    else
+    {
+        PrintStatusBlock(&Links, __FILE__, __LINE__, "TEST FAILED - Dense token");
+    }
+
+    Links.ListDelete();
+    *(long*) Links.pUserAddBuffer = -1;
+    Links.ListAddEnd();                                 // Takes the freed index
+
+    if (Links.SetDirectPointer(DenseToken) == false && *(long*) Links.pUserCurrentElement == -1)
+    {
+        PrintStatusBlock(&Links, __FILE__, __LINE__, "TEST SUCCESS - Token fails TEST - dense element deleted and its index reused");
+    }
+    else
+    {
+        PrintStatusBlock(&Links, __FILE__, __LINE__, "TEST FAILED - Token of a deleted dense element accepted");
+    }
+
+    DenseToken.Address = (void *) 0x7FFFFFFF;
+    if (Links.SetDirectPointer(DenseToken) == false)
+    {
+        PrintStatusBlock(&Links, __FILE__, __LINE__, "TEST SUCCESS - Token fails TEST - dense index out of range");
+    }
+
+    if (Links.ListSort(SortCompare) == false && Links.ListSpliceCurrent(Reference) == false)
+    {
+        PrintStatusBlock(&Links, __FILE__, __LINE__, "TEST SUCCESS - Sort and splice fail TEST - dense list");
+    }
+
+    DenseToken = Links.GetDirectToken();
+    Links.ListDeleteAll();
+    Links.ListAddEnd();
+
+    if (Links.SetDirectPointer(DenseToken) == false && Links.ElementCount == 1)
+    {
+        std::cout << "\nTEST SUCCESS - Dense token fails after ListDeleteAll()\n";
+    }
+    else
+    {
+        PrintStatusBlock(&Links, __FILE__, __LINE__, "TEST FAILED - Dense token after ListDeleteAll()");
+    }
+
+    Reference.ListDeleteAll();
+    Reference.ListDeregister();
+    Links.ListDeleteAll();
+    Links.ListDeregister();
+
+    std::cout << "\n\n*************************** END DENSE TEST *****************************\n";
+
+    std::cout << "\n\n*************************** BEGIN TYPED LIST TEST *****************************\n";
+//
+//  LLList<T> with a std::string in the element.  Elements are built in place, read through a reference
+//      and destroyed on a delete, the live count says every constructor had its destructor.
+//
+    {
+        LLList<TypedRecord_t>  Typed;
+        std::string            Prefix("Typed element with a name too long for the short string buffer # ");
+
+        if (Typed.emplace_back(0, Prefix) == false && TypedRecord_t::Live == 0)
+        {
+            PrintStatusBlock(&Typed.Mgr, __FILE__, __LINE__, "TEST SUCCESS - emplace_back fails TEST - not registered");
+        }
+        Typed.ListRegister("Typed");
+
+        for (long i = 0; i < 2000; ++i)
+        {
+            Typed.emplace_back(i, Prefix + std::to_string(i));
+        }
+
+        bool   InPlace = true;
+        long   Seen    = 0;
+
+        Typed.ListPointTop();
+        do
+        {
+            TypedRecord_t& Record = Typed.Current();
+
+            if (Record.Command.CommandValue != Seen || Record.Command.CommandName != Prefix + std::to_string(Seen)
+                || (void*) &Record != Typed.Mgr.pUserCurrentElement)
+            {
+                InPlace = false;
+            }
+            ++Seen;
+        } while (Typed.ListPointNext() == true);
+
+        if (InPlace == true && Seen == 2000 && Typed.size() == 2000 && TypedRecord_t::Live == 2000)
+        {
+            std::cout << "\nTEST SUCCESS - Typed list built 2000 elements in place";
+        }
+        else
+        {
+            PrintStatusBlock(&Typed.Mgr, __FILE__, __LINE__, "TEST FAILED - Typed list elements");
+        }
+
+        Typed.ListPointTop();
+        Typed.emplace_after(-5, std::string("TEST AFTER"));
+        Typed.ListPointBottom();
+        Typed.emplace_before(-20, std::string("TEST BEFORE"));
+        Typed.push_back(Typed.Current());                           // Copy of an element of the same list
+
+        Typed.ListPointTop();
+        Typed.ListPointNext();
+        bool  Inserts = Typed.Current().Command.CommandName == "TEST AFTER";
+
+        Typed.ListPointBottom();
+        Inserts = Inserts && Typed.Current().Command.CommandName == "TEST BEFORE";
+        Typed.ListPointLast();
+        Typed.ListPointLast();
+        Inserts = Inserts && Typed.Current().Command.CommandName == "TEST BEFORE" && Typed.Current().Command.CommandValue == -20;
+
+        if (Inserts == true && Typed.size() == 2003 && TypedRecord_t::Live == 2003)
+        {
+            std::cout << "\nTEST SUCCESS - Typed emplace_after(), emplace_before() and push_back()";
+        }
+        else
+        {
+            PrintStatusBlock(&Typed.Mgr, __FILE__, __LINE__, "TEST FAILED - Typed emplace_after(), emplace_before() and push_back()");
+        }
+
+        Typed.ListPointTop();
+        for (long i = 0; i < 1000; ++i)
+        {
+            Typed.ListDelete();
+        }
+        Typed.Current().Command.CommandName += " - changed through the reference";
+
+        if (Typed.size() == 1003 && TypedRecord_t::Live == 1003
+            && ((TypedRecord_t*) Typed.Mgr.pUserCurrentElement)->Command.CommandName.find("changed") != std::string::npos)
+        {
+            std::cout << "\nTEST SUCCESS - Typed ListDelete() destroys the element";
+        }
+        else
+        {
+            PrintStatusBlock(&Typed.Mgr, __FILE__, __LINE__, "TEST FAILED - Typed ListDelete()");
+        }
+
+        Typed.ListDeleteAll();
+        if (Typed.empty() == true && TypedRecord_t::Live == 0)
+        {
+            std::cout << "\nTEST SUCCESS - Typed ListDeleteAll() destroys every element";
+        }
+        else
+        {
+            PrintStatusBlock(&Typed.Mgr, __FILE__, __LINE__, "TEST FAILED - Typed ListDeleteAll()");
+        }
+
+        for (long i = 0; i < 100; ++i)
+        {
+            Typed.emplace_back(i, Prefix + std::to_string(i));  // Left in the list for the destructor
+        }
+
+        LLList<SortRecord_t, LL_OPTION_DENSE>  Plain;               // Trivially copyable - any layout
+        SortRecord_t                           Last = { 0, 0 };
+
+        Plain.ListRegister("Typed dense");
+        for (long i = 0; i < 5000; ++i)
+        {
+            Plain.emplace_back(SortRecord_t{ i, -i });
+        }
+        Plain.ListPointBottom();
+        Plain.ListPointLast();
+        Plain.emplace_after(SortRecord_t{ -1, -1 });
+        Plain.ListPointBottom();
+        Last = Plain.Current();
+        Plain.ListPointLast();
+
+        if (Last.Key == 4999 && Plain.Current().Key == -1 && Plain.size() == 5001)
+        {
+            std::cout << "\nTEST SUCCESS - Typed dense list";
+        }
+        else
+        {
+            PrintStatusBlock(&Plain.Mgr, __FILE__, __LINE__, "TEST FAILED - Typed dense list");
+        }
+    }
+
+    if (TypedRecord_t::Live == 0)
+    {
+        std::cout << "\nTEST SUCCESS - Typed list destructor destroys the elements left in it\n";
+    }
+    else
+    {
+        std::cout << "\nTEST FAILED - Typed list destructor left " << TypedRecord_t::Live << " elements\n";
+    }
+//
+//  An emptied list and one never registered go away without a destructor run on an element that is not there.
+//
+    {
+        LLList<TypedRecord_t>  Emptied;
+        LLList<TypedRecord_t>  Unregistered;
+
+        Emptied.ListRegister("Emptied");
+        Emptied.emplace_back(1, std::string("a"));
+        Emptied.ListDelete();
+        Emptied.ListDeleteAll();
+    }
+
+    if (TypedRecord_t::Live == 0)
+    {
+        std::cout << "\nTEST SUCCESS - Empty and unregistered typed lists destroyed\n";
+    }
+    else
+    {
+        std::cout << "\nTEST FAILED - Empty typed list destructor, " << TypedRecord_t::Live << " elements live\n";
+    }
+
+    std::cout << "\n\n*************************** END TYPED LIST TEST *****************************\n";
+
+    std::cout << "\n\n*************************** BEGIN CURSOR TEST *****************************\n";
+//
+//  Cursors and iterators on each layout.  A walk must see what the current element sees and must
+//      leave the current element and the status block alone.
+//
+    int          CursorLayouts[3] = { LL_OPTION_NONE, LL_OPTION_UNROLLED, LL_OPTION_DENSE };
+    const char*  CursorNames[3]   = { "Classic", "Unrolled", "Dense" };
+
+    for (int l = 0; l < 3; ++l)
+    {
+        LLMgr   Walked;
+
+        Walked.ListRegister(sizeof(long), std::string("Cursor ") + CursorNames[l], CursorLayouts[l]);
+        for (long i = 0; i < 5000; ++i)
+        {
+            *(long*) Walked.pUserAddBuffer = i;
+            Walked.ListAddEnd();
+        }
+        Walked.ListPointTop();
+        Walked.ListPointNext();
+        void*  pCurrentBefore = Walked.pUserCurrentElement;
+
+        long   Sum   = 0;
+        long   Count = 0;
+
+        for (void* pRecord : Walked)
+        {
+            Sum += *(long*) pRecord;
+            ++Count;
+        }
+        long   Evens = (long) std::count_if(Walked.begin(), Walked.end(), [](void* pRecord) { return *(long*) pRecord % 2 == 0; });
+
+        LLCursor  Forward(Walked);
+        LLCursor  Backward(Walked);
+        bool      Interleaved = Backward.PointBottom();
+
+        for (long i = 0; i < 5000; ++i)
+        {
+            if (*(long*) *Forward != i || *(long*) *Backward != 4999 - i)
+            {
+                Interleaved = false;
+            }
+            Forward.PointNext();
+            Backward.PointLast();
+        }
+        bool  Ends = Forward.PointNext() == false && *(long*) *Forward == 4999
+                  && Backward.PointLast() == false && *(long*) *Backward == 0 && *(long*) *--Walked.end() == 4999;
+
+        StatusBlock_t  CursorStatus = Walked.GetStatus();
+
+        if (Sum == 4999L * 5000 / 2 && Count == 5000 && Evens == 2500 && Interleaved == true && Ends == true
+            && Walked.pUserCurrentElement == pCurrentBefore && CursorStatus.Command == LL_pNEXT && CursorStatus.ReturnCode == true)
+        {
+            std::cout << "\nTEST SUCCESS - " << CursorNames[l] << " cursors walk the list and leave the current element alone";
+        }
+        else
+        {
+            PrintStatusBlock(&Walked, __FILE__, __LINE__, "TEST FAILED - Cursors and iterators");
+        }
+
+        LLCursor  Found = std::find_if(Walked.begin(), Walked.end(), [](void* pRecord) { return *(long*) pRecord == 2500; });
+        LLCursor  Held(Walked);
+
+        if (Walked.ListPointCursor(Found) == true && *(long*) Walked.pUserCurrentElement == 2500
+            && Held.PointCurrent() == true && *Held == Walked.pUserCurrentElement && Walked.ListDelete() == true
+            && std::find_if(Walked.begin(), Walked.end(), [](void* pRecord) { return *(long*) pRecord == 2500; }) == Walked.end()
+            && Walked.ElementCount == 4999)
+        {
+            std::cout << "\nTEST SUCCESS - " << CursorNames[l] << " element found by std::find_if() deleted through ListPointCursor()";
+        }
+        else
+        {
+            PrintStatusBlock(&Walked, __FILE__, __LINE__, "TEST FAILED - ListPointCursor()");
+        }
+
+        if (Walked.ListPointCursor(Walked.end()) == false && Walked.ListPointCursor(LLCursor(Reference)) == false)
+        {
+            PrintStatusBlock(&Walked, __FILE__, __LINE__, "TEST SUCCESS - ListPointCursor fails TEST - end or another list");
+        }
+
+        Walked.ListDeleteAll();
+        if (Walked.begin() == Walked.end())
+        {
+            std::cout << "\nTEST SUCCESS - " << CursorNames[l] << " begin() is end() on an empty list\n";
+        }
+        Walked.ListDeregister();
+    }
+//
+//  Readers on one list at once, each with its own cursors.
+//
+    LLMgr   Shared;
+    long    Readers[4] = { 0, 0, 0, 0 };
+
+    Shared.ListRegister(sizeof(long), std::string("Shared"));
+    for (long i = 0; i < 100000; ++i)
+    {
+        *(long*) Shared.pUserAddBuffer = i;
+        Shared.ListAddEnd();
+    }
+    Threads.clear();
+    for (int t = 0; t < 4; ++t)
+    {
+        Threads.push_back(std::thread([t, &Readers, &Shared]() { Readers[t] = CursorSum(&Shared); }));
+    }
+    for (std::thread& Thread : Threads)
+    {
+        Thread.join();
+    }
+
+    if (Readers[0] == 20 * (99999L * 100000 / 2) && Readers[1] == Readers[0] && Readers[2] == Readers[0] && Readers[3] == Readers[0])
+    {
+        std::cout << "\nTEST SUCCESS - 4 threads walked the list at once with their own cursors";
+    }
+    else
+    {
+        PrintStatusBlock(&Shared, __FILE__, __LINE__, "TEST FAILED - Cursor readers");
+    }
+    Shared.ListDeleteAll();
+    Shared.ListDeregister();
+//
+//  Typed iterators give a T.
+//
+    {
+        LLList<TypedRecord_t>  Typed;
+        long                   Total = 0;
+
+        Typed.ListRegister("Typed cursor");
+        for (long i = 0; i < 100; ++i)
+        {
+            Typed.emplace_back(i, std::string("Typed cursor ") + std::to_string(i));
+        }
+        for (TypedRecord_t& Record : Typed)
+        {
+            Total += Record.Command.CommandValue;
+        }
+        std::for_each(Typed.begin(), Typed.end(), [](TypedRecord_t& Record) { Record.Command.CommandName += " seen"; });
+
+        LLList<TypedRecord_t>::iterator  Named = std::find_if(Typed.begin(), Typed.end(),
+                                                   [](const TypedRecord_t& Record) { return Record.Command.CommandName == "Typed cursor 42 seen"; });
+
+        if (Total == 4950 && Named != Typed.end() && Named->Command.CommandValue == 42
+            && Typed.ListPointCursor(Named) == true && Typed.ListDelete() == true && TypedRecord_t::Live == 99)
+        {
+            std::cout << "\nTEST SUCCESS - Typed iterators with range-for, std::for_each() and std::find_if()\n";
+        }
+        else
+        {
+            PrintStatusBlock(&Typed.Mgr, __FILE__, __LINE__, "TEST FAILED - Typed iterators");
+        }
+    }
+
+    std::cout << "\n\n*************************** END CURSOR TEST *****************************\n";
+
+    std::cout << "\n\n*************************** BEGIN HANDLE TEST *****************************\n";
+//
+//  Classic tokens are a handle slot and generation.  Stale and made up tokens must fail without
+//      reading the element, and freed slots must be handed out again.
+//
+    LLMgr          Sockets;
+    LLMgr          Closed;
+    DirectToken_t  SocketToken;
+    DirectToken_t  Forged;
+
+    Sockets.ListRegister(sizeof(long), std::string("Sockets"));
+    Closed.ListRegister(sizeof(long), std::string("Closed"));
+    for (long i = 0; i < 100; ++i)
+    {
+        *(long*) Sockets.pUserAddBuffer = i;
+        Sockets.ListAddEnd();
+    }
+    Sockets.ListPointTop();
+    for (int Step = 0; Step < 10; ++Step)
+    {
+        Sockets.ListPointNext();
+    }
+    SocketToken = Sockets.GetDirectToken();             // Element 10
+    Sockets.ListDelete();
+    *(long*) Sockets.pUserAddBuffer = -10;
+    Sockets.ListAddEnd();                               // Takes the freed slot
+
+    DirectToken_t  ReuseToken = Sockets.GetDirectToken();
+
+    if (Sockets.SetDirectPointer(SocketToken) == false && ReuseToken.Address == SocketToken.Address)
+    {
+        PrintStatusBlock(&Sockets, __FILE__, __LINE__, "TEST SUCCESS - Token fails TEST - element deleted and its slot reused");
+    }
+    else
+    {
+        PrintStatusBlock(&Sockets, __FILE__, __LINE__, "TEST FAILED - Stale token accepted or slot not reused");
+    }
+
+    if (Sockets.SetDirectPointer(ReuseToken) == true && *(long*) Sockets.pUserCurrentElement == -10)
+    {
+        std::cout << "\nTEST SUCCESS - Token of the element in the reused slot";
+    }
+    else
+    {
+        PrintStatusBlock(&Sockets, __FILE__, __LINE__, "TEST FAILED - Token of the element in the reused slot");
+    }
+
+    Forged         = ReuseToken;
+    Forged.Address = (void*) 0xDEADBEEF;
+    bool  ForgedFail = Sockets.SetDirectPointer(Forged) == false;
+    Forged.Address = (void*) 1;
+    Forged.RNumber = ReuseToken.RNumber + 1;
+    ForgedFail = ForgedFail && Sockets.SetDirectPointer(Forged) == false;
+    Forged.Address = NULL;
+    ForgedFail = ForgedFail && Sockets.SetDirectPointer(Forged) == false;
+
+    if (ForgedFail == true)
+    {
+        PrintStatusBlock(&Sockets, __FILE__, __LINE__, "TEST SUCCESS - Token fails TEST - made up slots and generations");
+    }
+    else
+    {
+        PrintStatusBlock(&Sockets, __FILE__, __LINE__, "TEST FAILED - Made up token accepted");
+    }
+//
+//  Socket churn - connections open and close, late responses carry the tokens of closed ones.
+//
+    std::vector<DirectToken_t>  Open;
+    std::vector<DirectToken_t>  Late;
+    uintptr_t                   HighSlot = 0;
+    long                        Peak     = 0;
+    bool                        LateFail = true;
+
+    srand(17);
+    for (long i = 0; i < 100000; ++i)
+    {
+        if (Open.size() < 50 || rand() % 2 == 0)
+        {
+            *(long*) Sockets.pUserAddBuffer = i;
+            Sockets.ListAddEnd();
+            Open.push_back(Sockets.GetDirectToken());
+            HighSlot = std::max(HighSlot, (uintptr_t) Open.back().Address);
+            Peak     = std::max(Peak, Sockets.ElementCount);
+        }
+        else
+        {
+            size_t  Victim = (size_t) rand() % Open.size();
+
+            Sockets.SetDirectPointer(Open[Victim]);
+            Sockets.ListDelete();
+            Late.push_back(Open[Victim]);
+            Open[Victim] = Open.back();
+            Open.pop_back();
+        }
+        if (Late.empty() == false && rand() % 4 == 0 && Sockets.SetDirectPointer(Late[(size_t) rand() % Late.size()]) == true)
+        {
+            LateFail = false;
+        }
+    }
+
+    if (LateFail == true && HighSlot <= (uintptr_t) Peak)         // A new slot only when none is free
+    {
+        std::cout << "\nTEST SUCCESS - " << Late.size() << " closed tokens turned down, highest slot " << HighSlot - 1
+                  << " for a peak of " << Peak << " elements";
+    }
+    else
+    {
+        PrintStatusBlock(&Sockets, __FILE__, __LINE__, "TEST FAILED - Handle churn");
+    }
+//
+//  Spliced elements keep their tokens, on the new list only while they are in it.
+//
+    Sockets.ListPointTop();
+    SocketToken = Sockets.GetDirectToken();
+    Value       = *(long*) Sockets.pUserCurrentElement;
+    Sockets.ListSpliceCurrent(Closed);
+    if (Sockets.SetDirectPointer(SocketToken) == false
+        && Sockets.GetStatus().Smessage.find("LL_STATUS_INVALIDADDRESS") != std::string::npos)
+    {
+        std::cout << "\nTEST SUCCESS - Token of a spliced element fails on the list it left";
+    }
+    else
+    {
+        PrintStatusBlock(&Sockets, __FILE__, __LINE__, "TEST FAILED - Spliced token accepted on the old list");
+    }
+    Sockets.ListDeleteAll();                            // Its handle table is held by Closed
+
+    if (Closed.SetDirectPointer(SocketToken) == true && *(long*) Closed.pUserCurrentElement == Value)
+    {
+        std::cout << "\nTEST SUCCESS - Spliced token works on the new list after the old list was emptied";
+    }
+    else
+    {
+        PrintStatusBlock(&Closed, __FILE__, __LINE__, "TEST FAILED - Spliced token");
+    }
+
+    Closed.ListDelete();
+    if (Closed.SetDirectPointer(SocketToken) == false && Sockets.SetDirectPointer(SocketToken) == false)
+    {
+        PrintStatusBlock(&Closed, __FILE__, __LINE__, "TEST SUCCESS - Token fails TEST - spliced element deleted");
+    }
+    else
+    {
+        PrintStatusBlock(&Closed, __FILE__, __LINE__, "TEST FAILED - Token of a deleted spliced element accepted");
+    }
+
+    *(long*) Sockets.pUserAddBuffer = 1;
+    Sockets.ListAddEnd();
+    SocketToken = Sockets.GetDirectToken();
+    Sockets.ListDeleteAll();
+    Sockets.ListAddEnd();
+
+    if (Sockets.SetDirectPointer(SocketToken) == false)
+    {
+        PrintStatusBlock(&Sockets, __FILE__, __LINE__, "TEST SUCCESS - Token fails TEST - taken before ListDeleteAll()");
+    }
+    else
+    {
+        PrintStatusBlock(&Sockets, __FILE__, __LINE__, "TEST FAILED - Token from before ListDeleteAll() accepted");
+    }
+
+    Sockets.ListDeleteAll();
+    Sockets.ListDeregister();
+    Closed.ListDeleteAll();
+    Closed.ListDeregister();
+
+    std::cout << "\n\n*************************** END HANDLE TEST *****************************\n";
+
+    std::cout << "\n\n*************************** BEGIN WIRE TOKEN TEST *****************************\n";
+//
+//  64 bit tokens - through the 8 byte wire form and back, one at a time and in a batch with stale and
+//      made up tokens mixed in.  Classic and dense lists, unrolled lists have none.
+//
+    for (int Layout = 0; Layout < 2; ++Layout)
+    {
+        LLMgr                  Wire;
+        std::vector<uint64_t>  Tokens;
+        std::vector<void*>     Records(1000);
+        unsigned char          Packet[8];
+        const char            *Name = (Layout == 0) ? "classic" : "dense";
+
+        Wire.ListRegister(sizeof(long), std::string("Wire"), (Layout == 0) ? LL_OPTION_NONE : LL_OPTION_DENSE);
+        for (long i = 0; i < 1000; ++i)
+        {
+            *(long*) Wire.pUserAddBuffer = i;
+            Wire.ListAddEnd();
+            Tokens.push_back(Wire.GetWireToken());
+        }
+
+        LLMgr::EncodeToken(Tokens[500], Packet);
+        if (Packet[0] == (unsigned char)(Tokens[500] >> 56) && Packet[7] == (unsigned char) Tokens[500]
+            && LLMgr::DecodeToken(Packet) == Tokens[500]
+            && Wire.SetWirePointer(LLMgr::DecodeToken(Packet)) == true && *(long*) Wire.pUserCurrentElement == 500)
+        {
+            std::cout << "\nTEST SUCCESS - " << Name << " token through the wire form, most significant byte first";
+        }
+        else
+        {
+            PrintStatusBlock(&Wire, __FILE__, __LINE__, "TEST FAILED - Wire token round trip");
+        }
+
+        for (long i = 0; i < 1000; i += 10)                 // Every tenth element goes
+        {
+            Wire.SetWirePointer(Tokens[i]);
+            Wire.ListDelete();
+        }
+        Tokens.push_back(0);
+        Tokens.push_back(Tokens[1] ^ 0x100000000ULL);       // Wrong check bits
+        Tokens.push_back(Tokens[1] + 5000);                 // Slot past the end
+        Wire.ListPointTop();
+
+        long  Resolved = Wire.ResolveTokens(Tokens.data(), (long) Tokens.size(), (Records.resize(Tokens.size()), Records.data()));
+        bool  Match    = Resolved == 900 && *(long*) Wire.pUserCurrentElement == 1;
+
+        for (long i = 0; i < 1000 && Match == true; ++i)
+        {
+            Match = (i % 10 == 0) ? Records[i] == NULL : (Records[i] != NULL && *(long*) Records[i] == i);
+        }
+        Match = Match && Records[1000] == NULL && Records[1001] == NULL && Records[1002] == NULL;
+
+        if (Match == true)
+        {
+            std::cout << "\nTEST SUCCESS - " << Name << " ResolveTokens() found 900 of " << Tokens.size()
+                      << ", deleted and made up tokens NULL";
+        }
+        else
+        {
+            PrintStatusBlock(&Wire, __FILE__, __LINE__, "TEST FAILED - ResolveTokens()");
+        }
+
+        if (Wire.SetWirePointer(Tokens[10]) == false && Wire.SetWirePointer(Tokens[1001]) == false
+            && *(long*) Wire.pUserCurrentElement == 1)
+        {
+            PrintStatusBlock(&Wire, __FILE__, __LINE__, "TEST SUCCESS - Token fails TEST - deleted and made up wire tokens");
+        }
+        else
+        {
+            PrintStatusBlock(&Wire, __FILE__, __LINE__, "TEST FAILED - Bad wire token accepted");
+        }
+
+        uint64_t  Before = Tokens[1];
+
+        Wire.ListDeleteAll();
+        *(long*) Wire.pUserAddBuffer = 1;
+        Wire.ListAddEnd();
+        if (Wire.SetWirePointer(Before) == false)
+        {
+            PrintStatusBlock(&Wire, __FILE__, __LINE__, "TEST SUCCESS - Token fails TEST - wire token taken before ListDeleteAll()");
+        }
+        else
+        {
+            PrintStatusBlock(&Wire, __FILE__, __LINE__, "TEST FAILED - Wire token from before ListDeleteAll() accepted");
+        }
+
+        Wire.ListDeleteAll();
+        Wire.ListDeregister();
+    }
+//
+//  A spliced element keeps its wire token on the new list.  Unrolled lists have no wire tokens.
+//
+    Sockets.ListRegister(sizeof(long), std::string("Sockets"));
+    Closed.ListRegister(sizeof(long), std::string("Closed"));
+    *(long*) Sockets.pUserAddBuffer = 77;
+    Sockets.ListAddEnd();
+
+    uint64_t  Moved = Sockets.GetWireToken();
+
+    Sockets.ListSpliceCurrent(Closed);
+    if (Closed.SetWirePointer(Moved) == true && *(long*) Closed.pUserCurrentElement == 77
+        && Sockets.SetWirePointer(Moved) == false)
+    {
+        std::cout << "\nTEST SUCCESS - Spliced element wire token works on the new list, not the old one";
+    }
+    else
+    {
+        PrintStatusBlock(&Closed, __FILE__, __LINE__, "TEST FAILED - Spliced wire token");
+    }
+    Sockets.ListDeregister();
+    Closed.ListDeleteAll();
+    Closed.ListDeregister();
+
+    LLMgr  Rolled;
+
+    Rolled.ListRegister(sizeof(long), std::string("Rolled"), LL_OPTION_UNROLLED);
+    Rolled.ListAddEnd();
+    if (Rolled.GetWireToken() == 0 && Rolled.GetStatus().Smessage.find("LL_STATUS_NOINDEX") != std::string::npos)
+    {
+        PrintStatusBlock(&Rolled, __FILE__, __LINE__, "TEST SUCCESS - Unrolled list has no wire token");
+    }
+    else
+    {
+        PrintStatusBlock(&Rolled, __FILE__, __LINE__, "TEST FAILED - Unrolled wire token");
+    }
+    Rolled.ListDeleteAll();
+    Rolled.ListDeregister();
+
+    std::cout << "\n\n*************************** END WIRE TOKEN TEST *****************************\n";
+
+    std::cout << "\n\n*************************** BEGIN THREADSAFE TEST *****************************\n";
+//
+//  One session list, four threads looking sessions up and walking it with cursors while a fifth adds
+//      and deletes sessions.  Sessions 0-999 stay the whole time, 1000-1999 come and go.
+//
+    LLMgr                     SessionList;
+    std::vector<std::thread>  Workers;
+    std::vector<long>         BadReads(5);
+
+    if (SessionList.ListRegister(sizeof(Session_t), std::string("SharedSessions"), (long) offsetof(Session_t, SessionId),
+                                 (long) sizeof(long), LL_OPTION_THREADSAFE) == true)
+    {
+        PrintStatusBlock(&SessionList, __FILE__, __LINE__, "TEST SUCCESS - Thread-safe list registered");
+    }
+    else
+    {
+        PrintStatusBlock(&SessionList, __FILE__, __LINE__, "TEST FAILED - Thread-safe registration");
+    }
+
+    for (long i = 0; i < 1000; ++i)
+    {
+        ((Session_t*) SessionList.pUserAddBuffer)->SessionId = i;
+        snprintf(((Session_t*) SessionList.pUserAddBuffer)->User, sizeof(Session_t::User), "user%ld", i);
+        SessionList.ListAddEnd();
+    }
+
+    for (int t = 0; t < 4; ++t)
+    {
+        Workers.push_back(std::thread([t, &BadReads, &SessionList]() { BadReads[t] = SessionReader(&SessionList); }));
+    }
+    Workers.push_back(std::thread([&BadReads, &SessionList]() { BadReads[4] = SessionWriter(&SessionList); }));
+    for (std::thread& Worker : Workers)
+    {
+        Worker.join();
+    }
+    Workers.clear();
+
+    if (std::count(BadReads.begin(), BadReads.end(), 0L) == 5 && SessionList.ElementCount == 1000)
+    {
+        std::cout << "\nTEST SUCCESS - 4 readers and a writer on one list, every lookup and walk consistent";
+    }
+    else
+    {
+        std::cout << "\n Bad reads " << BadReads[0] << " " << BadReads[1] << " " << BadReads[2] << " " << BadReads[3]
+                  << " writer failures " << BadReads[4];
+        PrintStatusBlock(&SessionList, __FILE__, __LINE__, "TEST FAILED - Concurrent readers and writer");
+    }
+//
+//  The writer's lock can be taken again - a run of calls under ListWriteLock(), each call locking too.
+//
+    {
+        std::unique_lock<LLLock>  Hold = SessionList.ListWriteLock();
+        long                      Key  = 500;
+        LLCursor                  Found = SessionList.ListFindCursor(&Key);
+
+        if (Found != SessionList.end() && SessionList.ListPointCursor(Found) == true && SessionList.ListDelete() == true
+            && SessionList.ListFind(&Key) == false && SessionList.GetStatus().Command == LL_FIND)
+        {
+            std::cout << "\nTEST SUCCESS - Find, point and delete under one ListWriteLock()";
+        }
+        else
+        {
+            PrintStatusBlock(&SessionList, __FILE__, __LINE__, "TEST FAILED - Calls under ListWriteLock()");
+        }
+    }
+    SessionList.ListDeleteAll();
+    SessionList.ListDeregister();
+//
+//  Two threads splicing between the same two lists opposite ways - the locks are taken in one order.
+//
+    LLMgr  Left;
+    LLMgr  Right;
+    long   Spliced[2];
+
+    Left.ListRegister(sizeof(long), std::string("Left"), LL_OPTION_THREADSAFE);
+    Right.ListRegister(sizeof(long), std::string("Right"), LL_OPTION_THREADSAFE);
+    for (long i = 0; i < 1000; ++i)
+    {
+        *(long*) Left.pUserAddBuffer = i;
+        Left.ListAddEnd();
+        *(long*) Right.pUserAddBuffer = -i;
+        Right.ListAddEnd();
+    }
+    Workers.push_back(std::thread([&Spliced, &Left, &Right]() { Spliced[0] = SpliceChurn(&Left, &Right); }));
+    Workers.push_back(std::thread([&Spliced, &Left, &Right]() { Spliced[1] = SpliceChurn(&Right, &Left); }));
+    for (std::thread& Worker : Workers)
+    {
+        Worker.join();
+    }
+    Workers.clear();
+
+    long  Walked = 0;
+
+    for (void* pRecord : Left)
+    {
+        Walked += (pRecord != NULL);
+    }
+    for (void* pRecord : Right)
+    {
+        Walked += (pRecord != NULL);
+    }
+
+    if (Left.ElementCount + Right.ElementCount == 2000 && Walked == 2000 && Spliced[0] > 0 && Spliced[1] > 0)
+    {
+        std::cout << "\nTEST SUCCESS - " << Spliced[0] + Spliced[1] << " splices both ways at once, no deadlock, 2000 elements";
+    }
+    else
+    {
+        PrintStatusBlock(&Left, __FILE__, __LINE__, "TEST FAILED - Splices both ways");
+    }
+    Left.ListDeleteAll();
+    Left.ListDeregister();
+    Right.ListDeleteAll();
+    Right.ListDeregister();
+
+    if (Left.ListRegister(sizeof(long), std::string("Left"), LL_OPTION_THREADSAFE | LL_OPTION_DENSE) == true
+        && Left.ListRegister(sizeof(long), std::string("Left"), 0x0100) == false)
+    {
+        std::cout << "\nTEST SUCCESS - LL_OPTION_THREADSAFE goes with a layout, unknown options still fail";
+    }
+    else
+    {
+        PrintStatusBlock(&Left, __FILE__, __LINE__, "TEST FAILED - Thread-safe options");
+    }
+    Left.ListDeregister();
+
+    std::cout << "\n\n*************************** END THREADSAFE TEST *****************************\n";
+
+    std::cout << "\n\n*************************** BEGIN MPSC TEST *****************************\n";
+//
+//  Four producer threads post 20000 records each while this thread takes them.  Every record must
+//      come out once, and the records of one producer in the order it posted them.
+//
+    LLMgr              Inbox;
+    Posted_t           Taken;
+    std::vector<long>  NextSequence(4, 0);
+    long               TakenCount = 0;
+    long               OutOfOrder = 0;
+    long               Posted[4];
+
+    Inbox.ListRegister(sizeof(Posted_t), std::string("Inbox"), LL_OPTION_MPSC);
+
+    if (Inbox.ListTake(&Taken) == false && Inbox.GetStatus().Smessage.find("LL_STATUS_LISTEMPTY") != std::string::npos)
+    {
+        PrintStatusBlock(&Inbox, __FILE__, __LINE__, "TEST SUCCESS - Take from an empty inbox fails without waiting");
+    }
+    else
+    {
+        PrintStatusBlock(&Inbox, __FILE__, __LINE__, "TEST FAILED - Take from an empty inbox");
+    }
+
+    for (long t = 0; t < 4; ++t)
+    {
+        Workers.push_back(std::thread([t, &Posted, &Inbox]() { Posted[t] = InboxProducer(&Inbox, t); }));
+    }
+    while (TakenCount < 80000)
+    {
+        if (Inbox.ListTake(&Taken) == true)
+        {
+            OutOfOrder += (Taken.Producer < 0 || Taken.Producer > 3 || Taken.Sequence != NextSequence[Taken.Producer]);
+            if (Taken.Producer >= 0 && Taken.Producer <= 3)
+            {
+                NextSequence[Taken.Producer] = Taken.Sequence + 1;
+            }
+            ++TakenCount;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    for (std::thread& Worker : Workers)
+    {
+        Worker.join();
+    }
+    Workers.clear();
+
+    if (OutOfOrder == 0 && Posted[0] + Posted[1] + Posted[2] + Posted[3] == 80000 && Inbox.ListTake(&Taken) == false)
+    {
+        std::cout << "\nTEST SUCCESS - 80000 records from 4 producers taken once each, in order per producer";
+    }
+    else
+    {
+        std::cout << "\n Out of order " << OutOfOrder << " taken " << TakenCount;
+        PrintStatusBlock(&Inbox, __FILE__, __LINE__, "TEST FAILED - MPSC inbox");
+    }
+
+    Taken.Producer = 9;
+    Taken.Sequence = 9;
+    Inbox.ListPost(&Taken);
+    Inbox.ListPost(&Taken);
+    bool  Pending = Inbox.ListDeregister() == false;
+    Inbox.ListDeleteAll();
+
+    if (Pending == true && Inbox.ListDeregister() == true && Inbox.ListPost(&Taken) == false
+        && pTestLLM->ListPost(&Taken) == false)
+    {
+        std::cout << "\nTEST SUCCESS - Deregister waits for the inbox, ListDeleteAll() empties it, no inbox no post";
+    }
+    else
+    {
+        PrintStatusBlock(&Inbox, __FILE__, __LINE__, "TEST FAILED - Inbox clean up");
+    }
+
+    std::cout << "\n\n*************************** END MPSC TEST *****************************\n";
+
+    std::cout << "\n\n*************************** BEGIN RECLAIM TEST *****************************\n";
+//
+//  Ticks 0-1999 in order.  Four threads walk the list with no lock while a fifth deletes the odd
+//      ticks and puts them back in place.  A walk must see the even ticks, in order, and every
+//      record whole.  Run under ThreadSanitizer this is the check that nothing is freed under a reader.
+//
+    LLMgr              Ticks;
+    std::vector<long>  Faults(5);
+
+    if (Ticks.ListRegister(sizeof(Tick_t), std::string("Ticks"), (long) offsetof(Tick_t, Value), (long) sizeof(long),
+                           LL_OPTION_RECLAIM) == true)
+    {
+        PrintStatusBlock(&Ticks, __FILE__, __LINE__, "TEST SUCCESS - Reclaim list registered");
+    }
+    else
+    {
+        PrintStatusBlock(&Ticks, __FILE__, __LINE__, "TEST FAILED - Reclaim registration");
+    }
+
+    for (long i = 0; i < 2000; ++i)
+    {
+        ((Tick_t*) Ticks.pUserAddBuffer)->Value = i;
+        ((Tick_t*) Ticks.pUserAddBuffer)->Check = ~i;
+        Ticks.ListAddEnd();
+    }
+
+    for (int t = 0; t < 4; ++t)
+    {
+        Workers.push_back(std::thread([t, &Faults, &Ticks]() { Faults[t] = ReclaimReader(&Ticks); }));
+    }
+    Workers.push_back(std::thread([&Faults, &Ticks]() { Faults[4] = ReclaimWriter(&Ticks); }));
+    for (std::thread& Worker : Workers)
+    {
+        Worker.join();
+    }
+    Workers.clear();
+
+    if (std::count(Faults.begin(), Faults.end(), 0L) == 5 && Ticks.ElementCount == 2000)
+    {
+        std::cout << "\nTEST SUCCESS - 4 lock-free readers and a deleting writer, every walk whole and in order";
+    }
+    else
+    {
+        std::cout << "\n Faults " << Faults[0] << " " << Faults[1] << " " << Faults[2] << " " << Faults[3]
+                  << " writer failures " << Faults[4];
+        PrintStatusBlock(&Ticks, __FILE__, __LINE__, "TEST FAILED - Lock-free readers with deletes");
+    }
+//
+//  ListDeleteAll() waits for a reader still in its section before the storage goes.
+//
+    std::atomic<bool>  Entered(false);
+    std::atomic<bool>  Finished(false);
+    long               Whole = 0;
+
+    Workers.push_back(std::thread([&Entered, &Finished, &Whole, &Ticks]() {
+        LLReadSection  Section = Ticks.ListReadSection();
+        LLCursor       Walk(Ticks);
+
+        Entered = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        for (; Walk != Ticks.end(); ++Walk)
+        {
+            Whole += (((Tick_t*) *Walk)->Check == ~((Tick_t*) *Walk)->Value);
+        }
+        Finished = true;
+    }));
+    while (Entered == false)
+    {
+        std::this_thread::yield();
+    }
+    Ticks.ListDeleteAll();
+    bool  Waited = Finished == true;
+    Workers[0].join();
+    Workers.clear();
+
+    if (Waited == true && Whole == 2000 && Ticks.ElementCount == 0)
+    {
+        std::cout << "\nTEST SUCCESS - ListDeleteAll() waited for the reader in its section";
+    }
+    else
+    {
+        PrintStatusBlock(&Ticks, __FILE__, __LINE__, "TEST FAILED - ListDeleteAll() with a reader");
+    }
+
+    ((Tick_t*) Ticks.pUserAddBuffer)->Value = 1;
+    Ticks.ListAddEnd();
+    if (Ticks.ListSort(SortCompare) == false && Ticks.ListSpliceAll(*pTestLLM) == false
+        && Ticks.ListRegister(sizeof(long), std::string("Ticks"), LL_OPTION_RECLAIM | LL_OPTION_UNROLLED) == false)
+    {
+        std::cout << "\nTEST SUCCESS - No sort, splice or packed layout on a reclaim list";
+    }
+    else
+    {
+        PrintStatusBlock(&Ticks, __FILE__, __LINE__, "TEST FAILED - Reclaim list limits");
+    }
+    Ticks.ListDelete();
+
+    if (Ticks.ListDeregister() == true)
+    {
+        LLReadSection  Nothing = pTestLLM->ListReadSection();      // No LL_OPTION_RECLAIM - an empty section
+        std::cout << "\nTEST SUCCESS - Reclaim list deregistered with its last delete still waiting";
+    }
+    else
+    {
+        PrintStatusBlock(&Ticks, __FILE__, __LINE__, "TEST FAILED - Reclaim deregister");
+    }
+
+    std::cout << "\n\n*************************** END RECLAIM TEST *****************************\n";
+
+    std::cout << "\n\n*************************** BEGIN SHARD TEST *****************************\n";
+//
+//  20000 sessions over 8 shards by key, loaded by 4 threads at once.  Then 4 threads look every
+//      session up by key and by its shard token.
+//
+    LLShard                     Sharded;
+    std::vector<DirectToken_t>  ShardTokens(20000);
+    std::vector<long>           ShardFaults(4);
+
+    if (Sharded.ShardRegister(8, sizeof(Session_t), std::string("Sharded"), (long) offsetof(Session_t, SessionId),
+                              (long) sizeof(long)) == true && Sharded.ShardCount() == 8)
+    {
+        std::cout << "\nTEST SUCCESS - 8 shards registered by key";
+    }
+    else
+    {
+        std::cout << "\nTEST FAILED - Shard registration";
+    }
+
+    for (long t = 0; t < 4; ++t)
+    {
+        Workers.push_back(std::thread([t, &ShardFaults, &Sharded, &ShardTokens]() {
+            ShardFaults[t] = ShardLoader(&Sharded, t * 5000, &ShardTokens[t * 5000]); }));
+    }
+    for (std::thread& Worker : Workers)
+    {
+        Worker.join();
+    }
+    Workers.clear();
+
+    long  ShardTotal = 0;
+    long  ShardEmpty = 0;
+
+    for (int n = 0; n < Sharded.ShardCount(); ++n)
+    {
+        ShardTotal += Sharded.Shard(n).ElementCount;
+        ShardEmpty += (Sharded.Shard(n).ElementCount == 0);
+    }
+    if (std::count(ShardFaults.begin(), ShardFaults.end(), 0L) == 4 && Sharded.ElementCount() == 20000
+        && ShardTotal == 20000 && ShardEmpty == 0)
+    {
+        std::cout << "\nTEST SUCCESS - 20000 sessions added by 4 threads, spread over every shard";
+    }
+    else
+    {
+        std::cout << "\nTEST FAILED - Sharded adds, count " << Sharded.ElementCount();
+    }
+
+    for (long t = 0; t < 4; ++t)
+    {
+        Workers.push_back(std::thread([t, &ShardFaults, &Sharded, &ShardTokens]() {
+            ShardFaults[t] = ShardChecker(&Sharded, t * 5000, &ShardTokens[t * 5000]); }));
+    }
+    for (std::thread& Worker : Workers)
+    {
+        Worker.join();
+    }
+    Workers.clear();
+
+    if (std::count(ShardFaults.begin(), ShardFaults.end(), 0L) == 4)
+    {
+        std::cout << "\nTEST SUCCESS - Every session found by key and by token in the shard of its key";
+    }
+    else
+    {
+        std::cout << "\nTEST FAILED - Sharded lookups, faults " << ShardFaults[0] + ShardFaults[1] + ShardFaults[2] + ShardFaults[3];
+    }
+
+    Session_t      ShardRecord;
+    DirectToken_t  BadShard = ShardTokens[1];
+    DirectToken_t  Found;
+    long           ShardKey = 1;
+
+    BadShard.Address = (void*)((uintptr_t) BadShard.Address | ((uintptr_t) 300 << LL_SHARD_SHIFT));
+
+    if (Sharded.ShardRemove(ShardTokens[0]) == true && Sharded.ShardGet(ShardTokens[0], &ShardRecord) == false
+        && Sharded.ShardRemove(ShardTokens[0]) == false && Sharded.ShardGet(BadShard, &ShardRecord) == false
+        && Sharded.ShardRoute(&BadShard) == -1 && Sharded.ElementCount() == 19999)
+    {
+        std::cout << "\nTEST SUCCESS - A removed session's token fails, a token with no such shard fails";
+    }
+    else
+    {
+        std::cout << "\nTEST FAILED - Shard token checks";
+    }
+
+    if (Sharded.ShardFind(&ShardKey, &ShardRecord, &Found) == true && Found.Address == ShardTokens[1].Address
+        && Found.RNumber == ShardTokens[1].RNumber && ShardRecord.SessionId == 1)
+    {
+        std::cout << "\nTEST SUCCESS - ShardFind() gives back the token ShardAdd() did";
+    }
+    else
+    {
+        std::cout << "\nTEST FAILED - ShardFind() token";
+    }
+
+    if (Sharded.ShardDeregister() == false && Sharded.ShardDeleteAll() == true && Sharded.ShardDeregister() == true
+        && Sharded.ShardCount() == 0)
+    {
+        std::cout << "\nTEST SUCCESS - Shards deregister only once empty";
+    }
+    else
+    {
+        std::cout << "\nTEST FAILED - Shard deregister";
+    }
+//
+//  By thread - 4 threads that never asked for a home shard before get one each.
+//
+    LLShard  Homes;
+    long     HomeLoaded[4];
+
+    Homes.ShardRegister(4, sizeof(long), std::string("Homes"));
+    for (long t = 0; t < 4; ++t)
+    {
+        Workers.push_back(std::thread([t, &HomeLoaded, &Homes]() {
+            HomeLoaded[t] = 0;
+            for (long i = 0; i < 1000; ++i)
+            {
+                HomeLoaded[t] += (Homes.ShardAdd(&i).Magic == 1955);
+            }
+        }));
+    }
+    for (std::thread& Worker : Workers)
+    {
+        Worker.join();
+    }
+    Workers.clear();
+
+    if (HomeLoaded[0] + HomeLoaded[1] + HomeLoaded[2] + HomeLoaded[3] == 4000 && Homes.Shard(0).ElementCount == 1000
+        && Homes.Shard(1).ElementCount == 1000 && Homes.Shard(2).ElementCount == 1000 && Homes.Shard(3).ElementCount == 1000
+        && Homes.ShardOf(&ShardKey) == -1 && Homes.ShardFind(&ShardKey, &ShardRecord) == false
+        && Homes.ShardRegister(4, sizeof(long), std::string("Packed"), LL_OPTION_UNROLLED) == false)
+    {
+        std::cout << "\nTEST SUCCESS - By thread, 1000 adds in each home shard";
+    }
+    else
+    {
+        std::cout << "\nTEST FAILED - Shards by thread";
+    }
+
+    std::cout << "\n\n*************************** END SHARD TEST *****************************\n";
+
+    std::cout << "\n\n*************************** BEGIN PARALLEL TEST *****************************\n";
+//
+//  The numbers 0-29999 with every seventh deleted, in each layout.  The position and plain lists take the
+//      first half in by a splice, so they can not be cut by their own handle table.  The lists are cut up
+//      five different ways - handle slots, position index, unrolled nodes, dense indexes and a link walk -
+//      and the pool of 4 threads must agree with the sums every time.
+//
+    LLPool         Pool(3);
+    LLMgr          ParFlat, ParRanked, ParPacked, ParCompact, ParSpliced, ParDonor, ParNest, ParNotThere;
+    LLMgr*         pLayouts[5] = { &ParFlat, &ParRanked, &ParPacked, &ParCompact, &ParSpliced };
+    int            LayoutOptions[5] = { LL_OPTION_THREADSAFE, LL_OPTION_POSITION, LL_OPTION_UNROLLED, LL_OPTION_DENSE, LL_OPTION_NONE };
+    long           ParallelCount = 0;
+    long           ParallelSum = 0;
+    int            Agreed = 0;
+
+    for (long i = 0; i < 30000; ++i)
+    {
+        if (i % 7 != 3)
+        {
+            ++ParallelCount;
+            ParallelSum += i;
+        }
+    }
+
+    for (int l = 0; l < 5; ++l)
+    {
+        std::vector<DirectToken_t>  Doomed;
+
+        pLayouts[l]->ListRegister(sizeof(long), std::string("Parallel") + std::to_string(l), LayoutOptions[l]);
+        if (pLayouts[l] == &ParRanked || pLayouts[l] == &ParSpliced)       // Tokens keep working across a splice
+        {
+            ParDonor.ListRegister(sizeof(long), std::string("ParDonor"), LayoutOptions[l]);
+            for (long i = 0; i < 15000; ++i)
+            {
+                *(long*) ParDonor.pUserAddBuffer = i;
+                ParDonor.ListAddEnd();
+                if (i % 7 == 3)
+                {
+                    Doomed.push_back(ParDonor.GetDirectToken());
+                }
+            }
+            ParDonor.ListSpliceAll(*pLayouts[l]);
+            ParDonor.ListDeregister();
+        }
+        for (long i = pLayouts[l]->ElementCount; i < 30000; ++i)
+        {
+            *(long*) pLayouts[l]->pUserAddBuffer = i;
+            pLayouts[l]->ListAddEnd();
+            if (i % 7 == 3)
+            {
+                Doomed.push_back(pLayouts[l]->GetDirectToken());
+            }
+        }
+        for (DirectToken_t& Token : Doomed)
+        {
+            pLayouts[l]->SetDirectPointer(Token);
+            pLayouts[l]->ListDelete();
+        }
+        Agreed += ParallelCheck(pLayouts[l], &Pool, ParallelCount, ParallelSum);
+    }
+    ParDonor.ListRegister(sizeof(long), std::string("ParDonor"));
+
+    if (Agreed == 5)
+    {
+        std::cout << "\nTEST SUCCESS - ParallelReduce() and ParallelForEach() agree in every layout and after a splice";
+    }
+    else
+    {
+        std::cout << "\nTEST FAILED - Parallel walks, " << Agreed << " of 5 layouts agreed";
+    }
+//
+//  A walk inside the function of another on the same pool runs on its own thread instead of waiting - on
+//      a thread-safe list, as the pool threads walk it at once.
+//      The shared pool, an empty list and a list not registered.
+//
+    std::atomic<long>  Nested(0);
+
+    ParNest.ListRegister(sizeof(long), std::string("ParNest"));
+    for (long i = 0; i <= 2 * LL_PARALLEL_CHUNK; ++i)                         // 3 chunks, the first record of each nests
+    {
+        *(long*) ParNest.pUserAddBuffer = i;
+        ParNest.ListAddEnd();
+    }
+    ParNest.ParallelForEach([&](void* pRecord) {
+        if (*(long*) pRecord % LL_PARALLEL_CHUNK == 0)
+        {
+            Nested += ParFlat.ParallelReduce(0L, [](void*) { return 1L; }, [](long a, long b) { return a + b; }, &Pool);
+        }
+    }, &Pool);
+
+    if (Nested == 3 * ParallelCount
+        && ParRanked.ParallelReduce(0L, [](void* pRecord) { return *(long*) pRecord; }, [](long a, long b) { return a + b; }) == ParallelSum
+        && ParDonor.ParallelReduce(7L, [](void*) { return 1L; }, [](long a, long b) { return a + b; }, &Pool) == 7
+        && ParNotThere.ParallelForEach([](void*) {}, &Pool) == false && ParNotThere.GetStatus().Command == LL_PARALLEL
+        && ParNotThere.ParallelReduce(42L, [](void*) { return 1L; }, [](long a, long b) { return a + b; }) == 42)
+    {
+        std::cout << "\nTEST SUCCESS - Nested walks, the shared pool, an empty list and one not registered";
+    }
+    else
+    {
+        PrintStatusBlock(&ParNotThere, __FILE__, __LINE__, "TEST FAILED - Parallel walk corners");
+    }
+
+    for (LLMgr* pList : { &ParFlat, &ParRanked, &ParPacked, &ParCompact, &ParSpliced, &ParDonor, &ParNest })
+    {
+        pList->ListDeleteAll();
+        pList->ListDeregister();
+    }
+
+    std::cout << "\n\n*************************** END PARALLEL TEST *****************************\n";
+
+    std::cout << "\n\n*************************** BEGIN PERSIST TEST *****************************\n";
+//
+//  3000 records in a new file with every fifth deleted, closed and opened again by another list.  The
+//      records, their order and the tokens taken before the close must all come back.
+//
+    std::string    StorePath = "/tmp/llm-persist-" + std::to_string((long) getpid()) + ".dat";
+    LLMgr          Stored, Reopened, Second, Misfit, NotStored, NoStore;
+    DirectToken_t  StoredToken = { NULL, 0, 0 };
+    DirectToken_t  AfterToken  = { NULL, 0, 0 };
+    uint64_t       StoredWire  = 0;
+    std::vector<DirectToken_t>  Fifths;
+
+    unlink(StorePath.c_str());
+    if (Stored.ListRegister(sizeof(Stored_t), "Stored", StorePath, 5000) == true && Stored.ElementCount == 0)
+    {
+        std::cout << "\nTEST SUCCESS - Persistent list made in a new file";
+    }
+    else
+    {
+        PrintStatusBlock(&Stored, __FILE__, __LINE__, "TEST FAILED - Persistent list registration");
+    }
+
+    for (long i = 0; i < 3000; ++i)
+    {
+        Stored_t*  pAdd = (Stored_t*) Stored.pUserAddBuffer;
+
+        pAdd->Id    = i;
+        pAdd->Check = i * 7 + 1;
+        snprintf(pAdd->Name, sizeof(pAdd->Name), "Stored %ld", i);
+        Stored.ListAddEnd();
+        if (i % 5 == 0)
+        {
+            Fifths.push_back(Stored.GetDirectToken());
+        }
+        if (i == 1234)
+        {
+            StoredToken = Stored.GetDirectToken();
+            StoredWire  = Stored.GetWireToken();
+        }
+    }
+    for (DirectToken_t& Token : Fifths)
+    {
+        Stored.SetDirectPointer(Token);
+        Stored.ListDelete();
+    }
+
+    if (Stored.ElementCount == 2400 && Stored.ListSync() == true && Stored.ListDeregister() == true
+        && Reopened.ListRegister(sizeof(Stored_t), "Reopened", StorePath, 1) == true
+        && Reopened.ElementCount == 2400
+        && Reopened.GetDirectToken().Address == NULL && Reopened.GetWireToken() == 0
+        && Reopened.GetStatus().Smessage.find("LL_STATUS_LISTEND") != std::string::npos
+        && Reopened.ListDelete() == false && Reopened.GetStatus().Smessage.find("LL_STATUS_LISTEND") != std::string::npos
+        && Reopened.ElementCount == 2400 && StoredWalk(&Reopened) == 2400
+        && Reopened.SetDirectPointer(StoredToken) == true && ((Stored_t*) Reopened.pUserCurrentElement)->Id == 1234
+        && Reopened.SetWirePointer(StoredWire) == true && ((Stored_t*) Reopened.pUserCurrentElement)->Id == 1234
+        && Reopened.SetDirectPointer(Fifths[7]) == false)
+    {
+        std::cout << "\nTEST SUCCESS - Closed with 2400 records and opened again with the records, order and tokens, no current element";
+    }
+    else
+    {
+        PrintStatusBlock(&Reopened, __FILE__, __LINE__, "TEST FAILED - Persistent list reopen");
+    }
+//
+//  One process at a time, the capacity is the file's, a file made for another record length is turned
+//      down, and ListSync() needs a persistent list.
+//
+    if (Second.ListRegister(sizeof(Stored_t), "Second", StorePath, 5000) == false
+        && Second.GetStatus().Smessage.find("LL_STATUS_BADFILE") != std::string::npos
+        && Reopened.ListReserve(5120 - 2400) == true && Reopened.ListReserve(5120 - 2400 + 1) == false
+        && NotStored.ListRegister(sizeof(long), "NotStored") == true && NotStored.ListSync() == false
+        && NotStored.GetStatus().Smessage.find("LL_STATUS_NOINDEX") != std::string::npos
+        && NoStore.ListSync() == false && NoStore.GetStatus().Smessage.find("LL_STATUS_NOTREGISTERED") != std::string::npos
+        && NoStore.ListRegister(sizeof(Stored_t), "NoStore", StorePath, 0) == false
+        && NoStore.ListRegister(sizeof(Stored_t), "NoStore", StorePath, 5000, LL_OPTION_POSITION) == false)
+    {
+        std::cout << "\nTEST SUCCESS - File in use, capacity, ListSync() and option checks";
+    }
+    else
+    {
+        PrintStatusBlock(&Second, __FILE__, __LINE__, "TEST FAILED - Persistent list checks");
+    }
+//
+//  ListDeleteAll() puts a new epoch in the file - the old tokens stay dead after the next open.
+//
+    Reopened.ListDeleteAll();
+    ((Stored_t*) Reopened.pUserAddBuffer)->Id    = 77;
+    ((Stored_t*) Reopened.pUserAddBuffer)->Check = 77 * 7 + 1;
+    Reopened.ListAddEnd();
+    AfterToken = Reopened.GetDirectToken();
+    Reopened.ListDeregister();
+
+    if (Stored.ListRegister(sizeof(Stored_t), "Stored", StorePath, 5000) == true && Stored.ElementCount == 1
+        && Stored.SetDirectPointer(StoredToken) == false && Stored.SetDirectPointer(AfterToken) == true
+        && ((Stored_t*) Stored.pUserCurrentElement)->Id == 77 && Stored.ListDeregister() == true
+        && Misfit.ListRegister(32, "Misfit", StorePath, 5000) == false
+        && Misfit.GetStatus().Smessage.find("LL_STATUS_INVALIDPARM") != std::string::npos)
+    {
+        std::cout << "\nTEST SUCCESS - ListDeleteAll() epoch kept in the file, wrong record length turned down";
+    }
+    else
+    {
+        PrintStatusBlock(&Stored, __FILE__, __LINE__, "TEST FAILED - Persistent delete all");
+    }
+//
+//  Crashes.  A child process adds at the bottom and deletes at the top as fast as it can and is killed
+//      with SIGKILL in the middle of it.  Every open after must pass the link check, with the records
+//      whole and in order.  Then a link is broken in a file marked not clean and the open turns it down.
+//
+    int   Survived = 0;
+    int   Ready[2];
+    char  Signal;
+
+    for (int Round = 1; Round <= 5; ++Round)
+    {
+        LLMgr  After;
+        pid_t  Child;
+
+        if (pipe(Ready) != 0)
+        {
+            break;
+        }
+        if ((Child = fork()) == 0)
+        {
+            close(Ready[0]);
+            StoredChurn(StorePath.c_str(), Ready[1]);
+        }
+        close(Ready[1]);
+        if (Child > 0 && read(Ready[0], &Signal, 1) == 1)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(Round * 2));
+        }
+        close(Ready[0]);
+        if (Child > 0)
+        {
+            kill(Child, SIGKILL);
+            waitpid(Child, NULL, 0);
+        }
+
+        if (After.ListRegister(sizeof(Stored_t), "After", StorePath, 5000) == true && After.ElementCount >= 1000
+            && StoredWalk(&After) == After.ElementCount)
+        {
+            ++Survived;
+        }
+        After.ListDeregister();
+    }
+
+    PersistHeader_t  Header;
+    int              File = open(StorePath.c_str(), O_RDWR);
+    uint32_t         Broken = 0;
+    bool             Damaged = false;
+
+    if (File >= 0 && pread(File, &Header, sizeof(Header), 0) == (ssize_t) sizeof(Header) && Header.State.Head != LL_DENSE_NONE)
+    {
+        Broken       = Header.State.Head;               // Head's next link points back to itself
+        Header.Clean = 0;
+        Damaged = pwrite(File, &Broken, sizeof(Broken), (off_t)(Header.LinkOffset + Broken * sizeof(DenseLink_t))) == (ssize_t) sizeof(Broken)
+               && pwrite(File, &Header.Clean, sizeof(Header.Clean), (off_t) offsetof(PersistHeader_t, Clean)) == (ssize_t) sizeof(Header.Clean);
+    }
+    if (File >= 0)
+    {
+        close(File);
+    }
+
+    if (Survived == 5 && Damaged == true
+        && Stored.ListRegister(sizeof(Stored_t), "Stored", StorePath, 5000) == false
+        && Stored.GetStatus().Smessage.find("LL_STATUS_BADFILE") != std::string::npos
+        && unlink(StorePath.c_str()) == 0
+        && Stored.ListRegister(sizeof(Stored_t), "Stored", StorePath, 5000) == true && Stored.ElementCount == 0)
+    {
+        std::cout << "\nTEST SUCCESS - 5 kills mid churn opened whole, a broken link turned down and the file made again";
+    }
+    else
+    {
+        std::cout << "\nTEST FAILED - Persistent list crashes, " << Survived << " of 5 opened whole";
+        PrintStatusBlock(&Stored, __FILE__, __LINE__, "TEST FAILED - Persistent list crashes");
+    }
+
+    Stored.ListDeregister();
+    NotStored.ListDeregister();
+    unlink(StorePath.c_str());
+
+    std::cout << "\n\n*************************** END PERSIST TEST *****************************\n";
+
+    std::cout << "\n\n*************************** BEGIN SHARED TEST *****************************\n";
+//
+//  A connection table in shared memory.  4 worker processes forked from here add 500 connections each
+//      through the list they were handed down, and this process sees all 2000 in the order each added them.
+//
+    std::string    ShareName = "/llm-shared-" + std::to_string((long) getpid());
+    LLMgr          Table, Misshared;
+    DirectToken_t  SharedToken = { NULL, 0, 0 };
+    uint64_t       SharedWire  = 0;
+    int            Exited      = 0;
+    int            Status;
+    pid_t          Sharers[4];
+
+    shm_unlink(ShareName.c_str());
+    if (Table.ListRegister(sizeof(Connection_t), "Table", ShareName, 8192, LL_OPTION_SHARED) == true
+        && Table.ElementCount == 0
+        && Misshared.ListRegister(32, "Misshared", ShareName, 8192, LL_OPTION_SHARED) == false
+        && Misshared.GetStatus().Smessage.find("LL_STATUS_INVALIDPARM") != std::string::npos
+        && Misshared.ListRegister(sizeof(Connection_t), "Misshared", LL_OPTION_SHARED) == false)
+    {
+        std::cout << "\nTEST SUCCESS - Shared list made in a POSIX shared memory segment";
+    }
+    else
+    {
+        PrintStatusBlock(&Table, __FILE__, __LINE__, "TEST FAILED - Shared list registration");
+    }
+
+    for (long w = 0; w < 4; ++w)
+    {
+        if ((Sharers[w] = fork()) == 0)
+        {
+            bool  Added = true;
+
+            for (long i = 0; i < 500; ++i)
+            {
+                Connection_t*  pAdd;
+                std::unique_lock<LLLock>  Hold = Table.ListWriteLock();     // The add buffer is this process's own
+
+                pAdd = (Connection_t*) Table.pUserAddBuffer;
+                pAdd->Worker   = w;
+                pAdd->Sequence = i;
+                pAdd->Check    = w * 1000003 + i;
+                snprintf(pAdd->Peer, sizeof(pAdd->Peer), "10.0.%ld.%ld", w, i);
+                Added = Table.ListAddEnd() && Added;
+            }
+            _exit(Added == true ? 0 : 1);
+        }
+    }
+    for (long w = 0; w < 4; ++w)
+    {
+        if (Sharers[w] > 0 && waitpid(Sharers[w], &Status, 0) == Sharers[w] && WIFEXITED(Status) && WEXITSTATUS(Status) == 0)
+        {
+            ++Exited;
+        }
+    }
+
+    if (Exited == 4 && SharedWalk(&Table) == 2000 && Table.ElementCount == 2000)
+    {
+        std::cout << "\nTEST SUCCESS - 4 worker processes added 500 connections each, all 2000 seen here in order";
+    }
+    else
+    {
+        std::cout << "\nTEST FAILED - Shared adds, " << Exited << " workers, count " << Table.ElementCount;
+    }
+//
+//  A process that registers the segment by name resolves the tokens taken here and deletes the record,
+//      and the token is dead here after.  It adds a new record in the same element, which was current
+//      here - the next call here lets it go all the same.
+//
+    Table.ListPointTop();
+    Table.ListPointNext();
+    SharedToken = Table.GetDirectToken();
+    SharedWire  = Table.GetWireToken();
+    Connection_t  Expected = *(Connection_t*) Table.pUserCurrentElement;
+
+    if ((Sharers[0] = fork()) == 0)
+    {
+        LLMgr  Attached;
+        bool   Resolved;
+
+        Resolved = Attached.ListRegister(sizeof(Connection_t), "Attached", ShareName, 1, LL_OPTION_SHARED) == true
+                && Attached.ElementCount == 2000
+                && Attached.SetWirePointer(SharedWire) == true
+                && memcmp(Attached.pUserCurrentElement, &Expected, sizeof(Connection_t)) == 0
+                && Attached.SetDirectPointer(SharedToken) == true
+                && Attached.ListDelete() == true;
+
+        ((Connection_t*) Attached.pUserAddBuffer)->Worker   = 7;              // Goes in the element just freed
+        ((Connection_t*) Attached.pUserAddBuffer)->Sequence = 0;
+        ((Connection_t*) Attached.pUserAddBuffer)->Check    = 7 * 1000003;
+        Resolved = Resolved && Attached.ListAddEnd() == true
+                && (uint32_t) Attached.GetWireToken() == (uint32_t) SharedWire
+                && Attached.ListDeregister() == true;
+        _exit(Resolved == true ? 0 : 1);
+    }
+    Status = -1;
+    if (Sharers[0] > 0)
+    {
+        waitpid(Sharers[0], &Status, 0);
+    }
+
+    if (WIFEXITED(Status) && WEXITSTATUS(Status) == 0
+        && Table.pUserCurrentElement != NULL && Table.GetDirectToken().Address == NULL
+        && Table.GetStatus().Smessage.find("LL_STATUS_LISTEND") != std::string::npos
+        && Table.pUserCurrentElement == NULL && Table.GetWireToken() == 0 && Table.ListDelete() == false
+        && Table.GetStatus().Smessage.find("LL_STATUS_LISTEND") != std::string::npos
+        && Table.SetDirectPointer(SharedToken) == false && Table.SetWirePointer(SharedWire) == false
+        && Table.ElementCount == 2000 && SharedWalk(&Table) == 2000)
+    {
+        std::cout << "\nTEST SUCCESS - Another process resolved the tokens and replaced the record, current here let go";
+    }
+    else
+    {
+        PrintStatusBlock(&Table, __FILE__, __LINE__, "TEST FAILED - Shared tokens across processes");
+    }
+//
+//  Dead owners.  A process killed while it holds the lock, then three killed in the middle of adds and
+//      deletes - the next call here takes the mutex, rolls back what the dead process left and goes on.
+//
+    int   Recovered = 0;
+    int   Holding[2];
+    char  Held;
+
+    for (int Round = 0; Round < 4; ++Round)
+    {
+        pid_t  Child;
+
+        if (pipe(Holding) != 0)
+        {
+            break;
+        }
+        if ((Child = fork()) == 0)
+        {
+            close(Holding[0]);
+            SharedChurn(&Table, Round == 0, Holding[1]);
+        }
+        close(Holding[1]);
+        if (Child > 0 && read(Holding[0], &Held, 1) == 1 && Round > 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(Round * 2));
+        }
+        close(Holding[0]);
+        if (Child > 0)
+        {
+            kill(Child, SIGKILL);
+            waitpid(Child, NULL, 0);
+        }
+
+        ((Connection_t*) Table.pUserAddBuffer)->Worker   = 8;
+        ((Connection_t*) Table.pUserAddBuffer)->Sequence = Round;
+        ((Connection_t*) Table.pUserAddBuffer)->Check    = 8 * 1000003 + Round;
+        if (Table.ListAddEnd() == true && SharedWalk(&Table) == Table.ElementCount)
+        {
+            ++Recovered;
+        }
+    }
+
+    if (Recovered == 4)
+    {
+        std::cout << "\nTEST SUCCESS - A lock holder and 3 churning processes killed, the list went on whole";
+    }
+    else
+    {
+        PrintStatusBlock(&Table, __FILE__, __LINE__, "TEST FAILED - Shared list dead owners");
+    }
+
+    Table.ListDeleteAll();
+    Table.ListDeregister();
+    shm_unlink(ShareName.c_str());
+
+    std::cout << "\n\n*************************** END SHARED TEST *****************************\n";
+
+    std::cout << "\n  END OF TEST - Goodby world!\n\n" << endl;
+
+    return true;
+}
+
+/*
+* Reader thread for the cursor test.  Walks the list 20 times with its own cursor and
+*   adds up the elements.
+*/
+
+long CursorSum(LLMgr* pList)
+{
+    long  Sum = 0;
+
+    for (int Pass = 0; Pass < 20; ++Pass)
+    {
+        for (void* pRecord : *pList)
+        {
+            Sum += *(long*) pRecord;
+        }
+    }
+    return Sum;
+}
+
+/*
+* Reader thread for the thread-safe test.  Looks sessions up with its own cursor and walks the
+*   whole list now and then, all under the shared lock.  Returns the reads that were wrong.
+*/
+
+long SessionReader(LLMgr* pList)
+{
+    long  Bad = 0;
+
+    for (long Round = 0; Round < 20000; ++Round)
+    {
+        std::shared_lock<LLLock>  Hold  = pList->ListReadLock();
+        long                      Key   = Round % 2000;
+        LLCursor                  Found = pList->ListFindCursor(&Key);
+
+        if (Found != pList->end())
+        {
+            Bad += (((Session_t*) *Found)->SessionId != Key);
+        }
+        else
+        {
+            Bad += (Key < 1000);                            // The ones that never leave
+        }
+
+        if (Round % 1000 == 0)
+        {
+            long  Count = 0;
+
+            for (void* pRecord : *pList)
+            {
+                Count += (pRecord != NULL);
+            }
+            Bad += (Count != pList->ElementCount);
+        }
+    }
+    return Bad;
+}
+
+/*
+* Writer thread for the thread-safe test.  Sessions 1000-1999 are added then deleted ten times.
+*   The add buffer and the current element are the list's, so each fill and add, and each
+*   find and delete, is one run under ListWriteLock().  Returns the calls that failed.
+*/
+
+long SessionWriter(LLMgr* pList)
+{
+    long  Failed = 0;
+
+    for (long i = 0; i < 20000; ++i)
+    {
+        std::unique_lock<LLLock>  Hold = pList->ListWriteLock();
+        long                      Key  = 1000 + i % 1000;
+
+        if (i % 2000 < 1000)
+        {
+            ((Session_t*) pList->pUserAddBuffer)->SessionId = Key;
+            Failed += (pList->ListAddEnd() == false);
+        }
+        else
+        {
+            Failed += (pList->ListFind(&Key) == false || pList->ListDelete() == false);
+        }
+    }
+    return Failed;
+}
+
+/*
+* Splice thread for the thread-safe test.  Moves the top element of one list to the other 5000
+*   times.  Returns the splices that went through.
+*/
+
+long SpliceChurn(LLMgr* pFrom, LLMgr* pTo)
+{
+    long  Moved = 0;
+
+    for (int i = 0; i < 5000; ++i)
+    {
+        pFrom->ListPointTop();                                      // A splice into pFrom can move it again - still in the list
+        Moved += (pFrom->ListSpliceCurrent(*pTo) == true);
+    }
+    return Moved;
+}
+
+/*
+* Producer thread for the MPSC test.  Posts 20000 numbered records.  Returns the posts that went in.
+*/
+
+long InboxProducer(LLMgr* pList, long Producer)
+{
+    Posted_t  Record;
+    long      Posted = 0;
+
+    for (long i = 0; i < 20000; ++i)
+    {
+        Record.Producer = Producer;
+        Record.Sequence = i;
+        Posted += (pList->ListPost(&Record) == true);
+    }
+    return Posted;
+}
+
+/*
+* Reader thread for the reclaim test.  Walks the whole list 300 times inside a read section and
+*   no lock.  Returns the walks that missed an even tick, went backwards or read a bad record.
+*/
+
+long ReclaimReader(LLMgr* pList)
+{
+    long  Bad = 0;
+
+    for (int Walk = 0; Walk < 300; ++Walk)
+    {
+        LLReadSection  Section = pList->ListReadSection();
+        long           Last    = -1;
+        long           Evens   = 0;
+        bool           Broken  = false;
+
+        for (void* pRecord : *pList)
         {
-             PrintStatusBlock(pTestLLM, __FILE__, __LINE__, "TEST Failed  - Not able to delete all the elements");
+            Tick_t  *pTick = (Tick_t*) pRecord;
+
+            Broken |= (pTick->Check != ~pTick->Value || pTick->Value <= Last);
+            Evens  += (pTick->Value % 2 == 0);
+            Last    = pTick->Value;
         }
-    else 
-        {
-            PrintStatusBlock(pTestLLM, __FILE__, __LINE__, "TEST SUCCESS  - All elements free\n");
-       }
+        Bad += (Broken == true || Evens != 1000);
+    }
+    return Bad;
+}
 
-    if (pTestLLM->ListDeregister() == true)                             //  No more tests, so look at the status block
+/*
+* Writer thread for the reclaim test.  Takes an odd tick out if it is in the list, else puts it
+*   back after the even tick before it.  Returns the calls that failed.
+*/
 
-     { std::cout << "\nTEST SUCCESS - Deregister Successful \n";
-     }
-     else
-        { 
-            PrintStatusBlock(pTestLLM, __FILE__, __LINE__, "\nTEST FAILED  - LAST STATUS BLOCK\n");
-           std::cout  << " \nELEMENT COUNT = "  << pTestLLM->ElementCount;
-       
+long ReclaimWriter(LLMgr* pList)
+{
+    long  Failed = 0;
+
+    for (long i = 0; i < 50000; ++i)
+    {
+        std::unique_lock<LLLock>  Hold = pList->ListWriteLock();
+        long                      Key  = 2 * (i % 1000) + 1;
+
+        if (pList->ListFind(&Key) == true)
+        {
+            Failed += (pList->ListDelete() == false);
+        }
+        else
+        {
+            --Key;
+            Failed += (pList->ListFind(&Key) == false);
+            ((Tick_t*) pList->pUserAddBuffer)->Value = Key + 1;
+            ((Tick_t*) pList->pUserAddBuffer)->Check = ~(Key + 1);
+            Failed += (pList->ListAddAfter() == false);
         }
+    }
+    return Failed;
+}
 
-//((CommandTable_p)pTestLLM->pUserAddBuffer)->CommandName = "Test";
+/*
+* Loader thread for the shard test.  Adds sessions First to First + 4999 and keeps their shard
+*   tokens.  Returns the adds that failed.
+*/
 
-    std::cout << "\n\n*************************** END EMPTY LIST and DEREGISTER TEST *****************************\n";
+long ShardLoader(LLShard* pShards, long First, DirectToken_t* pTokens)
+{
+    Session_t  Record;
+    long       Failed = 0;
 
-    std::cout << "\n  END OF TEST - Goodby world!\n\n" << endl;
+    memset(&Record, 0, sizeof(Record));
+    for (long i = 0; i < 5000; ++i)
+    {
+        Record.SessionId = First + i;
+        snprintf(Record.User, sizeof(Record.User), "user%ld", First + i);
+        pTokens[i] = pShards->ShardAdd(&Record);
+        Failed += (pTokens[i].Magic != 1955);
+    }
+    return Failed;
+}
 
-    return true;
+/*
+* Lookup thread for the shard test.  Finds sessions First to First + 4999 by key and by token and
+*   checks the token routes to the shard of the key.  Returns the lookups that were wrong.
+*/
+
+long ShardChecker(LLShard* pShards, long First, DirectToken_t* pTokens)
+{
+    Session_t  Record;
+    long       Bad = 0;
+
+    for (long i = 0; i < 5000; ++i)
+    {
+        long           Key   = First + i;
+        DirectToken_t  Route = pTokens[i];
+
+        Bad += (pShards->ShardFind(&Key, &Record) == false || Record.SessionId != Key);
+        Bad += (pShards->ShardGet(pTokens[i], &Record) == false || Record.SessionId != Key);
+        Bad += (pShards->ShardRoute(&Route) != pShards->ShardOf(&Key));
+    }
+    return Bad;
 }
 
 /*
 * Print routine for status block information in the test program
 */
 
+/*
+* Parallel walk test.  Sum, count and maximum by ParallelReduce(), then every record bumped by
+*   ParallelForEach() and summed again, then put back.  Returns true when every answer is right.
+*/
+bool ParallelCheck(LLMgr* pList, LLPool* pPool, long Count, long Sum)
+{
+    auto  Add  = [](long a, long b) { return a + b; };
+    auto  Big  = [](long a, long b) { return (a > b) ? a : b; };
+    auto  Read = [](void* pRecord) { return *(long*) pRecord; };
+    bool  Right;
+
+    Right = pList->ParallelReduce(0L, Read, Add, pPool) == Sum
+         && pList->ParallelReduce(0L, [](void*) { return 1L; }, Add, pPool) == Count
+         && pList->ParallelReduce(-1L, Read, Big, pPool) == 29999
+         && pList->ParallelForEach([](void* pRecord) { *(long*) pRecord += 1; }, pPool) == true
+         && pList->ParallelReduce(0L, Read, Add, pPool) == Sum + Count;
+
+    pList->ParallelForEach([](void* pRecord) { *(long*) pRecord -= 1; }, pPool);
+    return Right;
+}
+
+/*
+* Persistent list test walk.  The records must go up by Id with good checks - returns how many, or -1.
+*/
+long StoredWalk(LLMgr* pList)
+{
+    long  Count = 0;
+    long  Last  = -1;
+
+    for (LLCursor Cursor = pList->begin(); Cursor != pList->end(); ++Cursor)
+    {
+        Stored_t*  pRecord = (Stored_t*) *Cursor;
+
+        if (pRecord->Id <= Last || pRecord->Check != pRecord->Id * 7 + 1)
+        {
+            return -1;
+        }
+        Last = pRecord->Id;
+        ++Count;
+    }
+    return Count;
+}
+
+/*
+* Child process of the persistent list crash test.  Opens the file, tells the parent on the pipe once
+*   it is churning and adds and deletes until it is killed.
+*/
+void StoredChurn(const char* pPath, int Ready)
+{
+    LLMgr  Churn;
+    long   Next = 0;
+
+    if (Churn.ListRegister(sizeof(Stored_t), "Churn", pPath, 5000) == false)
+    {
+        _exit(1);
+    }
+    if (Churn.ListPointBottom() == true)
+    {
+        Next = ((Stored_t*) Churn.pUserCurrentElement)->Id + 1;
+    }
+
+    for (long n = 0; ; ++n, ++Next)
+    {
+        Stored_t*  pAdd = (Stored_t*) Churn.pUserAddBuffer;
+
+        pAdd->Id    = Next;
+        pAdd->Check = Next * 7 + 1;
+        Churn.ListAddEnd();
+        if (Churn.ElementCount > 3000)
+        {
+            Churn.ListPointTop();
+            Churn.ListDelete();
+        }
+        if (n == 1000 && write(Ready, "R", 1) != 1)
+        {
+            _exit(1);
+        }
+    }
+}
+
+/*
+* Shared list test walk.  Each worker's connections must come in the order it added them with good
+*   checks - returns how many, or -1.  Holds the lock, so the count is caught up too.
+*/
+long SharedWalk(LLMgr* pList)
+{
+    std::shared_lock<LLLock>  Hold = pList->ListReadLock();
+    long  Last[16];
+    long  Count = 0;
+
+    std::fill(Last, Last + 16, -1L);
+    for (LLCursor Cursor = pList->begin(); Cursor != pList->end(); ++Cursor)
+    {
+        Connection_t*  pRecord = (Connection_t*) *Cursor;
+
+        if (pRecord->Worker < 0 || pRecord->Worker >= 16 || pRecord->Sequence <= Last[pRecord->Worker]
+            || pRecord->Check != pRecord->Worker * 1000003 + pRecord->Sequence)
+        {
+            return -1;
+        }
+        Last[pRecord->Worker] = pRecord->Sequence;
+        ++Count;
+    }
+    return Count;
+}
+
+/*
+* Child process of the shared list dead owner test.  Either takes the lock and waits to be killed with
+*   it, or adds at the bottom and deletes at the top until it is killed.  Tells the parent on the pipe
+*   once it is under way.
+*/
+void SharedChurn(LLMgr* pList, bool Hold, int Ready)
+{
+    if (Hold == true)
+    {
+        std::unique_lock<LLLock>  Held = pList->ListWriteLock();
+
+        if (write(Ready, "H", 1) == 1)
+        {
+            pause();
+        }
+        _exit(1);
+    }
+
+    for (long n = 0; ; ++n)
+    {
+        std::unique_lock<LLLock>  Held = pList->ListWriteLock();
+        Connection_t*  pAdd = (Connection_t*) pList->pUserAddBuffer;
+
+        pAdd->Worker   = 9;
+        pAdd->Sequence = n + ((long) getpid() << 24);
+        pAdd->Check    = 9 * 1000003 + pAdd->Sequence;
+        pList->ListAddEnd();
+        if (pList->ElementCount > 2500)
+        {
+            pList->ListPointTop();
+            pList->ListDelete();
+        }
+        if (n == 1000 && write(Ready, "R", 1) != 1)
+        {
+            _exit(1);
+        }
+    }
+}
+
 void PrintStatusBlock(LLMgr* pTestLLM, std::string file,int lineno, std::string test)
 {
     StatusBlock_t Status = pTestLLM->GetStatus();
@@ -400,3 +3509,215 @@ void PrintStatusBlock(LLMgr* pTestLLM, std::string file,int lineno, std::string
         << "   Command #: " << Status.Command << "\n   Command Name: " << Status.Scommand
         << "\n   Status Message: " << Status.Smessage << "\n"; return;
 }
+
+/*
+* Multiple list thread for the isolation test.  Builds 16 lists with different sizes,
+*   churns them and checks every byte of every element is still the list number.
+*/
+
+bool MultiListTest(int Thread)
+{
+    LLMgr   Lists[16];
+    long    Sizes[16];
+    long    Expected[16];
+
+    for (int l = 0; l < 16; ++l)
+    {
+        int Id = Thread * 16 + l;
+
+        Sizes[l]    = 1 + (Id * 517) % 8192;
+        Expected[l] = 0;
+
+        if (Lists[l].ListRegister(Sizes[l], "Isolation list " + std::to_string(Id)) == false)
+        {
+            return false;
+        }
+    }
+
+    for (int Round = 0; Round < 20000; ++Round)
+    {
+        int    l  = (Round * 7 + Thread) % 16;
+        LLMgr* pL = &Lists[l];
+
+        if (Round % 3 == 2 && Expected[l] > 0)
+        {
+            pL->ListPointTop();
+            if (pL->ListDelete() == false)
+            {
+                return false;
+            }
+            --Expected[l];
+        }
+        else
+        {
+            memset(pL->pUserAddBuffer, Thread * 16 + l, Sizes[l]);
+            if (pL->ListAddEnd() == false)
+            {
+                return false;
+            }
+            ++Expected[l];
+        }
+
+        if (pL->GetStatus().Slistname != "Isolation list " + std::to_string(Thread * 16 + l))
+        {
+            return false;
+        }
+    }
+
+    for (int l = 0; l < 16; ++l)
+    {
+        long  Count = 0;
+
+        if (Lists[l].ElementCount != Expected[l] || Lists[l].ListPointTop() == false)
+        {
+            return false;
+        }
+
+        while (Count < Lists[l].ElementCount)
+        {
+            unsigned char* pByte = (unsigned char*)Lists[l].pUserCurrentElement;
+
+            for (long b = 0; b < Sizes[l]; ++b)
+            {
+                if (pByte[b] != (unsigned char)(Thread * 16 + l))
+                {
+                    return false;
+                }
+            }
+            ++Count;
+            Lists[l].ListPointNext();
+        }
+
+        Lists[l].ListDeleteAll();
+        if (Lists[l].ListDeregister() == false)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+* Compare for the sort test - key only so the stability shows
+*/
+int SortCompare(const void* pLeft, const void* pRight)
+{
+    long  Left  = ((const SortRecord_t*) pLeft)->Key;
+    long  Right = ((const SortRecord_t*) pRight)->Key;
+
+    return (Left < Right) ? -1 : (Left > Right) ? 1 : 0;
+}
+
+/*
+* Callbacks for the find test - the key is the User name
+*/
+uint64_t UserHash(const void* pRecord)
+{
+    const char* pUser = ((const Session_t*) pRecord)->User;
+    uint64_t    Hash  = 14695981039346656037ULL;
+
+    while (*pUser != 0)
+    {
+        Hash = (Hash ^ (unsigned char) *pUser++) * 1099511628211ULL;
+    }
+    return Hash;
+}
+
+int UserCompare(const void* pLeft, const void* pRight)
+{
+    return strcmp(((const Session_t*) pLeft)->User, ((const Session_t*) pRight)->User);
+}
+
+/*
+* Compare for the ordered index test - called with two Deadline keys
+*/
+int DeadlineCompare(const void* pLeft, const void* pRight)
+{
+    long  Left  = *(const long*) pLeft;
+    long  Right = *(const long*) pRight;
+
+    return (Left < Right) ? -1 : (Left > Right) ? 1 : 0;
+}
+
+/*
+* Position test check - walk the list, then ask the index for each element by position and for
+*   the position of each element
+*/
+bool PositionCheck(LLMgr* pList)
+{
+    std::vector<void*>  Walk;
+
+    if (pList->ListPointTop() == true && pList->ElementCount > 0)
+    {
+        do
+        {
+            Walk.push_back(pList->pUserCurrentElement);
+        } while (pList->ListPointNext() == true);
+    }
+
+    if ((long) Walk.size() != pList->ElementCount)
+    {
+        return false;
+    }
+
+    for (long i = 0; i < (long) Walk.size(); ++i)
+    {
+        if (pList->ListPointIndex(i) == false || pList->pUserCurrentElement != Walk[i] || pList->ListCurrentIndex() != i)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+* Compare for the position test - largest long first
+*/
+int DescendingCompare(const void* pLeft, const void* pRight)
+{
+    long  Left  = *(const long*) pLeft;
+    long  Right = *(const long*) pRight;
+
+    return (Left > Right) ? -1 : (Left < Right) ? 1 : 0;
+}
+
+/*
+* Unrolled and dense tests - the two lists hold the same longs in the same order, walked down and then back up
+*/
+bool LayoutMatch(LLMgr* pClassic, LLMgr* pUnrolled)
+{
+    if (pClassic->ElementCount != pUnrolled->ElementCount)
+    {
+        return false;
+    }
+    if (pClassic->ElementCount == 0)
+    {
+        return true;
+    }
+
+    pClassic->ListPointTop();
+    pUnrolled->ListPointTop();
+    do
+    {
+        if (*(long*) pClassic->pUserCurrentElement != *(long*) pUnrolled->pUserCurrentElement)
+        {
+            return false;
+        }
+    } while (pClassic->ListPointNext() == true && pUnrolled->ListPointNext() == true);
+
+    if (pUnrolled->ListPointNext() == true)
+    {
+        return false;
+    }
+
+    do
+    {
+        if (*(long*) pClassic->pUserCurrentElement != *(long*) pUnrolled->pUserCurrentElement)
+        {
+            return false;
+        }
+    } while (pClassic->ListPointLast() == true && pUnrolled->ListPointLast() == true);
+
+    return pUnrolled->ListPointLast() == false;
+}
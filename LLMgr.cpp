@@ -28,10 +28,69 @@
  *                      Changed defines, split command and status tables. Changed the direct pointing 
  *                      capabilities and removed a bunch of junk. Added GetStatus().
  *                      fixed Delete_all routine.
+ * GMG   10-17-2026    Elements come from the list slab (LLSlab) instead of a malloc()/free()
+ *                      per add and delete.  Added ListReserve().
+ * GMG   10-17-2026    ListDeleteAll() no longer loops ListDelete().  It releases the slab
+ *                      chunks and bumps the list epoch so old tokens are rejected.
+ * GMG   10-17-2026    InitStatus() and SetStatusFail() only store codes.  The strings are
+ *                      looked up when GetStatus() is called.
+ * GMG   10-17-2026    Moved Status, ListTotalElementLength and ReturnToken out of the file
+ *                      globals.  Two lists no longer share state.
+ * GMG   10-17-2026    ListAddEnd() links to pListBottom instead of chasing the chain from the top.
+ * GMG   10-17-2026    Added ListAddEndBatch() for loading an array of records.
+ * GMG   10-17-2026    Added the splice methods.  The slab is reference counted so elements
+ *                      moved to another list keep their storage, and epochs are unique per
+ *                      process so tokens of moved elements still validate on the new list.
+ *                      The destructor now deregisters the list.
+ * GMG   10-17-2026    Added ListSort().
+ * GMG   10-17-2026    Added the key index (LLHash) and ListFind().  The adds, deletes and
+ *                      splices keep it up to date.
+ * GMG   10-17-2026    Added the ordered index (LLTree), ListSeek() and ListSeekNext().
+ *                      ListAddAfter() in the middle of the list now sets the back
+ *                      pointer of the element after the new one.
+ * GMG   10-17-2026    Registration options.  LL_OPTION_POSITION keeps the position
+ *                      index (LLRank) for ListPointIndex() and ListCurrentIndex().
+ * GMG   10-17-2026    LL_OPTION_UNROLLED keeps the records in LLUnroll nodes.  The add,
+ *                      delete, navigation and token methods go there first.
+ * GMG   10-17-2026    LL_OPTION_DENSE keeps the links in an LLDense index array apart from
+ *                      the records.  Dispatched the same way as LL_OPTION_UNROLLED.
+ * GMG   10-17-2026    Added ListPointCursor() for the LLCursor walks in LLMgr.h.
+ * GMG   10-17-2026    Classic elements get a slot in the list handle table (LLHandle) when
+ *                      they go in the list.  SetDirectPointer() checks the slot generation
+ *                      instead of reading the element the token names.  Spliced lists hold
+ *                      the handle tables of the epochs they took in.
+ * GMG   10-17-2026    64 bit wire tokens.  GetWireToken(), SetWirePointer() and the batch
+ *                      ResolveTokens() that prefetches the slots and elements.
+ * GMG   10-17-2026    ElementRandom() uses a splitmix64 generator kept in the list.  rand()
+ *                      takes the glibc lock on every add and the srand(time(0)) in the
+ *                      constructor reseeded every list made in the same second alike.
+ * GMG   10-17-2026    LL_OPTION_THREADSAFE list lock (LLLock), ListReadLock(), ListWriteLock()
+ *                      and ListFindCursor().
+ * GMG   10-17-2026    LL_OPTION_MPSC inbox (LLQueue) with ListPost() and ListTake().
+ * GMG   10-17-2026    LL_OPTION_RECLAIM.  ListDelete() hands the element to LLReclaim
+ *                      instead of the slab, and the links a cursor follows forward are
+ *                      stored and read with release and acquire so section readers walk
+ *                      without the lock.
+ * GMG   10-17-2026    HashBytes() is a public static so LLShard picks shards with the key hash.
+ * GMG   10-17-2026    ParallelChunks() and ParallelClaim() cut a list up for ParallelForEach()
+ *                      and ParallelReduce() in LLMgr.h, from the handle table or dense indexes
+ *                      when it can.
+ * GMG   10-17-2026    Persistent lists.  ListRegister() with a file path attaches the dense
+ *                      list to an LLPersist mapping, ListDeleteAll() keeps the epoch in the
+ *                      file, and ListDeregister() and the destructor close the file with the
+ *                      records in it.  Added ListSync().
+ * GMG   10-17-2026    LL_OPTION_SHARED.  The list lock takes the robust mutex of the shared
+ *                      segment and ShareHook() rolls back a dead owner's operation and
+ *                      catches the count, epoch and current element up with the others.
  *-------------------------------------------------------------
 */
 
 #include <time.h>
+#include <unistd.h>
+#include <new>
+#include <atomic>
+#include <chrono>
+#include <functional>
 #include <iostream>     // Include the iostream header and String class is in this under windows
 #include "LLMgr.h"
 
@@ -56,6 +115,26 @@ static CommandTable_t LL_CommandArray[] =
     { LL_pLAST, "LL_pLAST - Request to point to the previous element" },
     { LL_pNEXT, "LL_pNEXT - Request to point to the next element" },
     { LL_pTOP, "LL_pTOP - Request - to point to the top of the list" },
+    { LL_RESERVE, "LL_RESERVE - Request to pre-fill element storage" },
+    { LL_ADDENDBATCH, "LL_ADDENDBATCH - Request add an array of records at end of the list" },
+    { LL_SPLICECURRENT, "LL_SPLICECURRENT - Request move current element to another list" },
+    { LL_SPLICEBOTTOM, "LL_SPLICEBOTTOM - Request move current through bottom to another list" },
+    { LL_SPLICEALL, "LL_SPLICEALL - Request move all elements to another list" },
+    { LL_SORT, "LL_SORT - Request sort of the list" },
+    { LL_FIND, "LL_FIND - Request point to the element with a key" },
+    { LL_ORDERINDEX, "LL_ORDERINDEX - Request add an ordered index to the list" },
+    { LL_SEEK, "LL_SEEK - Request point to the first element at or after a key" },
+    { LL_SEEKNEXT, "LL_SEEKNEXT - Request point to the next element in key order" },
+    { LL_POINTINDEX, "LL_POINTINDEX - Request point to the element at a position" },
+    { LL_CURRENTINDEX, "LL_CURRENTINDEX - Request position of the current element" },
+    { LL_POINTCURSOR, "LL_POINTCURSOR - Request point to the element of a cursor" },
+    { LL_GETWIRETOKEN, "LL_GETWIRETOKEN - Request 64 bit token for the current element" },
+    { LL_SETWIREPOINTER, "LL_SETWIREPOINTER - Request point to the element of a 64 bit token" },
+    { LL_RESOLVETOKENS, "LL_RESOLVETOKENS - Request user data areas for a batch of 64 bit tokens" },
+    { LL_FINDCURSOR, "LL_FINDCURSOR - Request cursor on the element with a key" },
+    { LL_TAKE, "LL_TAKE - Request oldest record from the inbox" },
+    { LL_PARALLEL, "LL_PARALLEL - Request parallel walk over every record" },
+    { LL_SYNC, "LL_SYNC - Request write of a persistent list to the disk" },
     { -1,            "MNEMONIC_UNKNOWN"      }
 };
 
@@ -70,13 +149,57 @@ static StatusTable_t LL_StatusArray[] =
     { LL_STATUS_NOTEMPTY, "LL_STATUS_NOTEMPTY - List needs to be empty before deregistration" },
     { LL_STATUS_NOTREGISTERED, "LL_STATUS_NOTREGISTERED - Can't use the methods until the list is registered" },
     { LL_STATUS_INVALIDSIZE, "LL_STATUS_INVALIDSIZE - Range of user data area 1-8192" },
+    { LL_STATUS_INVALIDTARGET, "LL_STATUS_INVALIDTARGET - Target must be another registered list of the same size" },
+    { LL_STATUS_INVALIDPARM, "LL_STATUS_INVALIDPARM - A required parameter was NULL or out of range" },
+    { LL_STATUS_NOINDEX, "LL_STATUS_NOINDEX - The list does not have the index the request needs" },
+    { LL_STATUS_NOTFOUND, "LL_STATUS_NOTFOUND - No element in the list has the key" },
+    { LL_STATUS_BADFILE, "LL_STATUS_BADFILE - List file could not be opened, failed its check or is in use" },
     { -1,                    "MNEMONIC_UNKNOWN"      }
 };
 
+/*
+*  Every list incarnation (registration or ListDeleteAll()) gets its own epoch from this counter.
+*      Epochs are unique in the process so a list that takes in elements from another list can
+*      accept the tokens of those elements by epoch.
+*/
+static std::atomic<uint32_t> LL_EpochCounter(0);
+
+static uint32_t NextEpoch(void)
+{
+    return ++LL_EpochCounter;
+}
+
+/*
+*  splitmix64 - one step of the element validation generator.  State goes up by the golden
+*      ratio and the result is the state mixed, so every list has its own sequence and no
+*      two lists share state.
+*/
+static inline uint64_t SplitMix64(uint64_t *pState)
+{
+    uint64_t  z = (*pState += 0x9E3779B97F4A7C15ULL);
+
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/*
+*  Seed for a new list - the clock and the address of the counter (ASLR) are mixed once a process,
+*      then every list takes the next count through splitmix, so lists made together still differ.
+*/
+static std::atomic<uint64_t> LL_SeedCounter(0);
+
+static uint64_t NextSeed(void)
+{
+    static const uint64_t ProcessSeed = (uint64_t) std::chrono::steady_clock::now().time_since_epoch().count()
+                                        ^ ((uint64_t)(uintptr_t) &LL_SeedCounter << 16)
+                                        ^ (uint64_t) time(0);
+    uint64_t  State = ProcessSeed + ++LL_SeedCounter * 0x9E3779B97F4A7C15ULL;
+
+    return SplitMix64(&State);
+}
+
 
-    DirectToken_t ReturnToken;                          // Return From GetDirectToken() - Used in SetDirectPointer() 
-    unsigned int   ListTotalElementLength = 0;          // Internal length of user area with pointer header
-    StatusBlock_t Status;                               // Reports what happned in a method call
 //--------------------------------------------------------------------
 // Constructor method will init the local protected and user data to
 //    reasonable values
@@ -91,12 +214,43 @@ LLMgr::LLMgr ()
     pListTop            = NULL;
     pListBottom         = NULL;
     pClassBuffer        = NULL;
+    pListSlab           = NULL;
+    pListHash           = NULL;
+    HashKeyOffset       = 0;
+    HashKeyLength       = 0;
+    HashFunction        = NULL;
+    HashCompare         = NULL;
+    pListTree           = NULL;
+    TreeKeyOffset       = 0;
+    pTreeElement        = NULL;
+    TreeAhead           = false;
+    pListRank           = NULL;
+    RankOffset          = 0;
+    pListUnroll         = NULL;
+    UnrollCursor.pNode  = NULL;
+    UnrollCursor.Pos    = 0;
+    pListDense          = NULL;
+    DenseCurrent        = LL_DENSE_NONE;
+    DenseCurrentRandom  = 0;
+    ListProcess         = 0;
+    pListStore          = NULL;
+    pListHandle         = NULL;
+    pListOwner          = NULL;
+    pListLock           = NULL;
+    pListQueue          = NULL;
+    pListReclaim        = NULL;
     ListElementCount    = 0;
     ListUserElementLength   = 0;              // Internal length of user data area passed at registration
     ListRegistered      = false;
+    ListEpoch           = 0;
+    ListTotalElementLength = 0;
     Status.ReturnCode   = true;
-    Status.Slistname    = "NOT SET";
-    srand(static_cast<unsigned int>(time(0)));              // Seed the random number generator
+    Status.Command      = 0;
+    Status.StatusValue  = -1;
+    Status.LineNo       = 0;
+    Status.pFileName    = "";
+    StatusListName      = "NOT SET";
+    ListRandomState     = NextSeed();                       // Own generator - no srand() of the shared one
 
 }
 
@@ -106,7 +260,17 @@ LLMgr::LLMgr ()
  LLMgr::~LLMgr()
 {
 
-     ListDeleteAll();
+    if (pListStore == NULL)                     // A persistent list is closed with its records in the file
+    {
+        ListDeleteAll();
+    }
+
+    // Added Deregister Check in here  als - moved ahead of the resets so it runs and the slab is let go
+
+    if (ListRegistered == true)
+    {
+       this-> ListDeregister();
+    }
 
     ElementCount        = 0;
     pUserCurrentElement = NULL;
@@ -119,15 +283,6 @@ LLMgr::LLMgr ()
     ListUserElementLength   = 0;             // Internal length of user data area passed at registration
     ListRegistered      = false;
 
-    // Added Deregister Check in here  als
-
-    if (ListRegistered == true)
-    {
-       this-> ListDeregister();
-    }
-
-    ListRegistered      = false;
-
 }
 
 /*
@@ -143,7 +298,7 @@ LLMgr::LLMgr ()
  *    to relocate the buffer into the list.
  *------------------------------------------------------------------
 */
-bool LLMgr::ListRegister(long int ListSize, std::string Name)
+bool LLMgr::ListRegister(long int ListSize, std::string Name, int Options)
 {
     ListPointers_t  *pElementPointers;
 
@@ -161,6 +316,17 @@ bool LLMgr::ListRegister(long int ListSize, std::string Name)
         return false;
     }
 
+    int  Layout = Options & (LL_OPTION_POSITION | LL_OPTION_UNROLLED | LL_OPTION_DENSE);
+
+    if ((Options & ~(LL_OPTION_POSITION | LL_OPTION_UNROLLED | LL_OPTION_DENSE | LL_OPTION_THREADSAFE | LL_OPTION_MPSC
+                     | LL_OPTION_RECLAIM)) != 0
+     || (Layout & (Layout - 1)) != 0                                    // One layout option at most
+     || ((Options & LL_OPTION_RECLAIM) != 0 && (Layout & (LL_OPTION_UNROLLED | LL_OPTION_DENSE)) != 0))
+    {
+        SetStatusFail( LL_FILELINE, LL_STATUS_INVALIDPARM, LL_REGISTER   );
+        return false;
+    }
+
 /*----------------------------------------------------------------------------------------------------------
  *  Storage area for pointers and the element size passed at registration
  *      This is the user passed lenght + the pointers for the list.
@@ -171,11 +337,146 @@ bool LLMgr::ListRegister(long int ListSize, std::string Name)
 */
    ListTotalElementLength = ListSize + sizeof(ListPointers_t);          // Memory needed = pointer structure + user data area
 
-   if ((pClassBuffer = malloc(ListTotalElementLength)) == NULL)         // Failure is not an opton - Panic!
+   if ((Options & LL_OPTION_POSITION) != 0)                             // Position index node after the user data area
+    {
+        RankOffset             = (ListTotalElementLength + 7) & ~(size_t) 7;
+        ListTotalElementLength = RankOffset + sizeof(RankNode_t);
+
+        if ((pListRank = new (std::nothrow) LLRank()) == NULL)
+        {
+            RankOffset = 0;
+            SetStatusFail( LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_REGISTER   );
+            return false;
+        }
+    }
+
+   if ((pListSlab = new (std::nothrow) LLSlab()) == NULL)               // Every element is carved from the list slab
+    {
+        delete pListRank;
+        pListRank  = NULL;
+        RankOffset = 0;
+        SetStatusFail( LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_REGISTER   );
+        return false;
+    }
+
+   ListEpoch = NextEpoch();                                             // New list - new epoch for the tokens
+
+   if (pListSlab->SlabInit(ListTotalElementLength) == false
+    || (pClassBuffer = pListSlab->SlabAlloc()) == NULL)                 // Failure is not an opton - Panic!
     {
+        delete pListSlab;
+        pListSlab = NULL;
+        delete pListRank;
+        pListRank  = NULL;
+        RankOffset = 0;
         SetStatusFail( LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_REGISTER   );
         return false;
     }
+
+   if ((Options & LL_OPTION_UNROLLED) != 0)                             // Records live in the unrolled nodes, the slab only
+    {                                                                   // holds the add buffer
+        if ((pListUnroll = new (std::nothrow) LLUnroll()) == NULL
+         || pListUnroll->UnrollInit(ListSize) == false)
+        {
+            delete pListUnroll;
+            pListUnroll = NULL;
+            pListSlab->SlabFree(pClassBuffer);
+            delete pListSlab;
+            pListSlab    = NULL;
+            pClassBuffer = NULL;
+            SetStatusFail( LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_REGISTER   );
+            return false;
+        }
+        UnrollCursor.pNode = NULL;
+    }
+
+   if ((Options & LL_OPTION_DENSE) != 0)                                // Links and records in LLDense, the slab only holds
+    {                                                                   // the add buffer
+        if ((pListDense = new (std::nothrow) LLDense()) == NULL
+         || pListDense->DenseInit(ListSize) == false)
+        {
+            delete pListDense;
+            pListDense = NULL;
+            pListSlab->SlabFree(pClassBuffer);
+            delete pListSlab;
+            pListSlab    = NULL;
+            pClassBuffer = NULL;
+            SetStatusFail( LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_REGISTER   );
+            return false;
+        }
+        DenseCurrent = LL_DENSE_NONE;
+    }
+
+   if (pListUnroll == NULL && pListDense == NULL)                       // Classic tokens are checked in the handle table
+    {
+        if ((pListHandle = new (std::nothrow) LLHandle()) == NULL
+         || (pListOwner = new (std::nothrow) HandleOwner_t) == NULL)
+        {
+            delete pListHandle;
+            pListHandle = NULL;
+            pListSlab->SlabFree(pClassBuffer);
+            delete pListSlab;
+            pListSlab    = NULL;
+            pClassBuffer = NULL;
+            delete pListRank;
+            pListRank  = NULL;
+            RankOffset = 0;
+            SetStatusFail( LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_REGISTER   );
+            return false;
+        }
+        pListHandle->Epoch = ListEpoch;
+        pListOwner->pList  = this;
+    }
+
+   if ((Options & LL_OPTION_RECLAIM) != 0)                              // Deleted elements wait here for the readers
+    {
+        if ((pListReclaim = new (std::nothrow) LLReclaim()) == NULL)
+        {
+            delete pListHandle;
+            pListHandle = NULL;
+            delete pListOwner;
+            pListOwner  = NULL;
+            pListSlab->SlabFree(pClassBuffer);
+            delete pListSlab;
+            pListSlab    = NULL;
+            pClassBuffer = NULL;
+            delete pListRank;
+            pListRank  = NULL;
+            RankOffset = 0;
+            SetStatusFail( LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_REGISTER   );
+            return false;
+        }
+        pListReclaim->ReclaimInit(pListSlab);
+    }
+
+   if ((Options & LL_OPTION_MPSC) != 0)                                 // Inbox for the producer threads
+    {
+        if ((pListQueue = new (std::nothrow) LLQueue()) == NULL
+         || pListQueue->QueueInit(ListSize) == false)
+        {
+            delete pListQueue;
+            pListQueue  = NULL;
+            delete pListReclaim;
+            pListReclaim = NULL;
+            delete pListHandle;
+            pListHandle = NULL;
+            delete pListOwner;
+            pListOwner  = NULL;
+            delete pListUnroll;
+            pListUnroll = NULL;
+            delete pListDense;
+            pListDense  = NULL;
+            pListSlab->SlabFree(pClassBuffer);
+            delete pListSlab;
+            pListSlab    = NULL;
+            pClassBuffer = NULL;
+            delete pListRank;
+            pListRank  = NULL;
+            RankOffset = 0;
+            SetStatusFail( LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_REGISTER   );
+            return false;
+        }
+    }
 /*----------------------------------------------------------------------------------------------------------
 *   Now:
 *       1. Seed the randome number generator
@@ -185,21 +486,205 @@ bool LLMgr::ListRegister(long int ListSize, std::string Name)
 *-------------------------------------------------------------------------------------------------------------
 */
 
-    Status.Slistname = Name;                              // Add list name to status block
+    StatusListName = Name;                                // Add list name to status block
 
     pElementPointers       = (ListPointers_t *) pClassBuffer;   // Cast over pointer structure at the front
     pElementPointers->pFwd  = NULL;                       //  Set fwd pointer to null
     pElementPointers->pBwd  = NULL;                       //  set bwd pointer to null   
     pElementPointers->Address = pClassBuffer;             //  Store the direct address of this list element in the structure
-    pElementPointers->Random = rand();                    //  Store random number in pointer structure
+    pElementPointers->Random = 0;                         //  Handle slot is given when it goes in the list
     pUserAddBuffer = (char *) pClassBuffer 
             + sizeof(ListPointers_t);                     // Add the pointer structure length to point to user data area
 
     ListRegistered    = true;                             // Set list to registered
     ListUserElementLength = ListSize;                     // Save user data area size for other methods
+    pListLock = ((Options & (LL_OPTION_THREADSAFE | LL_OPTION_RECLAIM)) != 0) ? &ListLock : NULL;   // Shared between threads
  
    return true;                                           // Nothing broke, done
 }
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Register the list with a key index for ListFind().
+ *
+ *    KeyOffset, KeyLength - the key is these bytes of the user data
+ *       area.  ListFind() is passed KeyLength bytes of key.
+ *    Hash, Compare - user functions over whole user data areas.
+ *       ListFind() is passed a user data area with the key filled in
+ *       (pUserAddBuffer will do).
+ *
+ *    Every add, delete and splice keeps the index.  The key of an
+ *    element must not be changed while it is in the list.  More than
+ *    one element can have the same key, ListFind() stops on one of them.
+ *------------------------------------------------------------------
+*/
+bool LLMgr::ListRegister(long int ListSize, std::string Name, long KeyOffset, long KeyLength, int Options)
+{
+    InitStatus(  LL_FILELINE, LL_REGISTER );
+
+    if (ListRegistered == false && (KeyOffset < 0 || KeyLength < 1 || KeyOffset + KeyLength > ListSize
+                                 || (Options & (LL_OPTION_UNROLLED | LL_OPTION_DENSE)) != 0))
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_INVALIDPARM, LL_REGISTER  );
+        return  false;
+    }
+
+    if (ListRegister(ListSize, Name, Options) == false)
+    {
+        return  false;
+    }
+
+    if ((pListHash = new (std::nothrow) LLHash()) == NULL)
+    {
+        ListDeregister();
+        SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_REGISTER  );
+        return  false;
+    }
+
+    HashKeyOffset = KeyOffset;
+    HashKeyLength = KeyLength;
+    return  true;
+}
+
+bool LLMgr::ListRegister(long int ListSize, std::string Name, ListHash_t Hash, ListCompare_t Compare, int Options)
+{
+    InitStatus(  LL_FILELINE, LL_REGISTER );
+
+    if (ListRegistered == false && (Hash == NULL || Compare == NULL
+                                 || (Options & (LL_OPTION_UNROLLED | LL_OPTION_DENSE)) != 0))
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_INVALIDPARM, LL_REGISTER  );
+        return  false;
+    }
+
+    if (ListRegister(ListSize, Name, Options) == false)
+    {
+        return  false;
+    }
+
+    if ((pListHash = new (std::nothrow) LLHash()) == NULL)
+    {
+        ListDeregister();
+        SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_REGISTER  );
+        return  false;
+    }
+
+    HashFunction = Hash;
+    HashCompare  = Compare;
+    return  true;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Register a persistent list kept in the file at Path (see
+ *    LLPersist.h).  The list is registered dense, then the file is
+ *    opened or made for Capacity elements and the dense arrays are
+ *    mapped from it.  A file that was not closed clean has its links
+ *    checked first.  The reopened list takes the epoch in the file,
+ *    so the tokens of its records are good again, and the current
+ *    element is not set.  A failure leaves the list not registered.
+ *------------------------------------------------------------------
+*/
+bool LLMgr::ListRegister(long int ListSize, std::string Name, std::string Path, long Capacity, int Options)
+{
+    int  Opened;
+
+    InitStatus(  LL_FILELINE, LL_REGISTER );
+
+    bool Shared = (Options & LL_OPTION_SHARED) != 0;
+
+    if (ListRegistered == false && (Path.empty() == true || Capacity < 1 || Capacity > LL_PERSIST_MAXELEMENTS
+                                 || (Options & ~(LL_OPTION_DENSE | LL_OPTION_THREADSAFE | LL_OPTION_SHARED)) != 0))
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_INVALIDPARM, LL_REGISTER  );
+        return  false;
+    }
+
+    if (ListRegister(ListSize, Name, (Options & ~LL_OPTION_SHARED) | LL_OPTION_DENSE
+                                     | (Shared == true ? LL_OPTION_THREADSAFE : LL_OPTION_NONE)) == false)
+    {
+        return  false;
+    }
+
+    if ((pListStore = new (std::nothrow) LLPersist()) == NULL)
+    {
+        ListDeregister();
+        SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_REGISTER  );
+        return  false;
+    }
+
+    Opened = pListStore->PersistOpen(Path.c_str(), (size_t) ListSize, (uint32_t) Capacity, ListEpoch, Shared);
+    if (Opened == LL_PERSIST_CREATED || Opened == LL_PERSIST_REOPENED)
+    {
+        pListDense->DenseAttach(pListStore);
+        if (pListStore->PersistWasClean() == false && pListDense->DenseCheck() == false)
+        {
+            Opened = LL_PERSIST_DAMAGED;
+        }
+    }
+
+    if (Opened != LL_PERSIST_CREATED && Opened != LL_PERSIST_REOPENED)
+    {
+        pListStore->PersistDrop();                      // Not marked clean - a damaged file stays damaged
+        delete pListStore;
+        pListStore = NULL;
+        ListDeregister();
+        SetStatusFail(  LL_FILELINE, (Opened == LL_PERSIST_MISMATCH) ? LL_STATUS_INVALIDPARM : LL_STATUS_BADFILE, LL_REGISTER  );
+        return  false;
+    }
+
+    if (Shared == true)                                 // The first hold catches up with the segment
+    {
+        ListLock.LockShare(pListStore->PersistMutex(), ShareHook, this);
+        std::unique_lock<LLLock>  Hold = ListWriteLock();
+        return  true;
+    }
+
+    ListEpoch    = pListStore->PersistHeader()->Epoch;
+    ElementCount = ListElementCount = (long) pListDense->DenseCount();
+    return  true;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Called by the list lock of a shared list each time it has
+ *    just taken the segment mutex.  A dead owner's operation is rolled
+ *    back first.  Then the count and epoch are read from the segment,
+ *    where the other processes keep them, and a current element one of
+ *    them deleted is let go - the calls that need one then fail with
+ *    LL_STATUS_LISTEND.  The validation number is checked as well as
+ *    the free mark, so an element deleted and added again in between
+ *    is let go too rather than taken for the new record.  The generator
+ *    is seeded with the process id on the first hold in a process, so
+ *    a process forked with the list, or registering it next to another,
+ *    does not hand out the same validation numbers.
+ *------------------------------------------------------------------
+*/
+void LLMgr::ShareHook(void *pArg, bool OwnerDied)
+{
+    LLMgr  *pList = (LLMgr *) pArg;
+
+    if (OwnerDied == true)
+    {
+        pList->pListStore->PersistRecover();
+    }
+    if (pList->ListProcess != (long) getpid())
+    {
+        pList->ListProcess     = (long) getpid();
+        pList->ListRandomState = NextSeed() ^ ((uint64_t) pList->ListProcess * 0x9E3779B97F4A7C15ULL);
+    }
+
+    pList->ListEpoch    = pList->pListStore->PersistHeader()->Epoch;
+    pList->ElementCount = pList->ListElementCount = (long) pList->pListDense->DenseCount();
+
+    if (pList->DenseCurrent != LL_DENSE_NONE
+     && (pList->DenseCurrent >= pList->pListDense->DenseUsed() || pList->pListDense->DenseLive(pList->DenseCurrent) == false
+      || pList->pListDense->DenseRandom(pList->DenseCurrent) != pList->DenseCurrentRandom))
+    {
+        pList->DenseCurrent = LL_DENSE_NONE;
+        pList->DensePoint();
+    }
+}
 /*
  *--------------------------------------------------------------------
  * Function: DeRegister the list which includes freeing the
@@ -218,14 +703,86 @@ bool LLMgr::ListDeregister()
         return false;
     }
 
-    if (ListElementCount > 0 )
+    if ((ListElementCount > 0 && pListStore == NULL) || (pListQueue != NULL && pListQueue->QueueEmpty() == false))
     {
         SetStatusFail(  LL_FILELINE, LL_STATUS_NOTEMPTY , LL_DEREGISTER );
         return  false;
     }
 
-    free(pClassBuffer);                                 // Free the temporaty buffer
+    delete pListQueue;                                  // Inbox if there was one
+    pListQueue = NULL;
+
+    if (pListReclaim != NULL)                           // Last deletes back to the slab once no reader is on them
+    {
+        pListReclaim->ReclaimWait();
+        pListReclaim->ReclaimCollect();
+        delete pListReclaim;
+        pListReclaim = NULL;
+    }
+
+    pListSlab->SlabFree(pClassBuffer);                  // Return the temporaty buffer
+    pListLock = NULL;
+
+    if (pListSlab->SlabDrop() == true)                  // and the slab when no other list holds its elements
+    {
+        delete pListSlab;
+    }
+
+    for (LLSlab *pAdopted : ListAdoptedSlabs)           // Let go of the slabs of elements spliced in
+    {
+        if (pAdopted->SlabDrop() == true)
+        {
+            delete pAdopted;
+        }
+    }
+    ListAdoptedSlabs.clear();
+
+    HandleDropAll();                                    // and the handle tables
+    if (pListHandle != NULL && pListHandle->HandleDrop() == true)
+    {
+        delete pListHandle;
+    }
+    pListHandle = NULL;
+    delete pListOwner;                                  // No slot points to it, the list is empty
+    pListOwner  = NULL;
+
+    delete pListHash;                                   // Key index if there was one
+    pListHash     = NULL;
+    HashKeyOffset = 0;
+    HashKeyLength = 0;
+    HashFunction  = NULL;
+    HashCompare   = NULL;
+
+    delete pListTree;                                   // and the ordered index
+    pListTree     = NULL;
+    pTreeElement  = NULL;
+    TreeAhead     = false;
+
+    delete pListRank;                                   // and the position index
+    pListRank     = NULL;
+    RankOffset    = 0;
+
+    delete pListUnroll;                                 // and the unrolled nodes
+    pListUnroll   = NULL;
+    UnrollCursor.pNode = NULL;
+
+    delete pListDense;                                  // and the dense links
+    pListDense    = NULL;
+    DenseCurrent  = LL_DENSE_NONE;
+
+    if (pListStore != NULL)                             // A persistent list stays in its file
+    {
+        ListLock.LockShare(NULL, NULL, NULL);
+        pListStore->PersistClose();
+        delete pListStore;
+        pListStore          = NULL;
+        pListCurrent        = NULL;
+        pUserCurrentElement = NULL;
+        ElementCount        = ListElementCount = 0;
+    }
 
+    pListSlab      = NULL;
+    pClassBuffer   = NULL;
     pUserAddBuffer = NULL;
 
     ListRegistered = false;
@@ -251,6 +808,8 @@ bool LLMgr::ListAddEnd(void)
  * Check to be sure they registered their list
  *------------------------------------------------------------------
 */
+     std::unique_lock<LLLock>  Hold = ListWriteLock();            // LL_OPTION_THREADSAFE - exclusive
+
      InitStatus(  LL_FILELINE, LL_ADDEND );
 
     if (ListRegistered != true)
@@ -259,6 +818,19 @@ bool LLMgr::ListAddEnd(void)
         return  false;
     }
 
+    if (pListUnroll != NULL)
+    {
+        UnrollCursor_t  Last;
+
+        pListUnroll->UnrollLast(&Last);
+        return  UnrollAdd(Last, true, LL_ADDEND);
+    }
+
+    if (pListDense != NULL)
+    {
+        return  DenseAdd(pListDense->DenseLast(), true, pUserAddBuffer, LL_ADDEND);
+    }
+
 /*
  *-----------------------------------------------------------------
  * 1)  Get the size of the element + pointer  fields.
@@ -270,13 +842,28 @@ bool LLMgr::ListAddEnd(void)
  *-----------------------------------------------------------------
 */
 
-    if ((pNewElement = malloc(ListTotalElementLength)) == NULL)
+    if ((pNewElement = pListSlab->SlabAlloc()) == NULL)
     {
          SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_ADDEND  );
         return  false;
     }
 
-    ((ListPointers_t*)pNewElement)->Random = rand();        // Get a random number for safety check
+    if (HandleAdd(pClassBuffer) == false)                    // The add buffer is the element going in
+    {
+        pListSlab->SlabFree(pNewElement);
+        SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_ADDEND  );
+        return  false;
+    }
+
+    if (IndexAdd(pClassBuffer) == false)
+    {
+        HandleRemove(pClassBuffer);
+        pListSlab->SlabFree(pNewElement);
+        SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_ADDEND  );
+        return  false;
+    }
+
+    ((ListPointers_t*)pNewElement)->Random = 0;               // Next add buffer - no handle slot until it goes in
     ((ListPointers_t*)pNewElement)->Address = pNewElement;  // Save elements address in pointer structure
 
     pHoldBuffer    = pNewElement;	                         //  Save new storage area addr 
@@ -289,7 +876,7 @@ bool LLMgr::ListAddEnd(void)
  * 1) Null the Forward and Backward Pointers in the new element.
  * 2) Now check to see if an entry exist (1st update).
  *      if it is null, then begin the list.
- *      If it has a valid entry chase the chain until the end.
+ *      If it has a valid entry the bottom pointer is the end of the list.
  *      Then add it to the end of the list.
  *----------------------------------------------------------------
 */
@@ -301,31 +888,28 @@ bool LLMgr::ListAddEnd(void)
 //
     if (pListTop == NULL)
     {
-        pListTop = pNewElement;
+        LL_LINKSTORE(pListTop, pNewElement);
         pListBottom = pNewElement;
     }
     else
     {
-        pNextEntry = ( ListPointers_t *) pListTop;                 //  First Entry - List has elements, so start at the top 
-   //------------------------------------------------------------------
-   // Loop thru looking for the end of the list.  Each time make the
-   //      Last equal to the next then increment to the next.
-   //------------------------------------------------------------------
-        while (pNextEntry->pFwd != NULL)
-        {
-            pNextEntry =  ( ListPointers_t *)pNextEntry->pFwd;      // get the forward pointer
-        }
+        pNextEntry = ( ListPointers_t *) pListBottom;              //  Last Entry - kept by every add and delete
    //--------------------------------------------------------------------------------------------------
-   // We are now at the last entry so:
+   // We are at the last entry so:
    //      1) Point to the current element from the last in list.
    //      2) Point to the last element from the current.
    //      3) Update bottom of list Pointer.  
    //   !!Note: Null for the last forward pointer initialized above = Set end of list
    //----------------------------------------------------------------------------------------------------
-        pNextEntry->pFwd       = pNewElement;                       // Update last entry forward pointer
+        LL_LINKSTORE(pNextEntry->pFwd, pNewElement);                // Update last entry forward pointer - readers see it whole
         pCurrentPointers->pBwd = pNextEntry;                        // The new element now points to last entry
         pListBottom            = pNewElement;                       // Reset bottom of the list
     }
+
+    if (pListRank != NULL)
+    {
+        pListRank->RankInsertBefore(NULL, ElementRank(pNewElement));   // Last in the position index
+    }
 /*
  *--------------------------------------------------------------------
  *  Now we need to:
@@ -347,63 +931,245 @@ bool LLMgr::ListAddEnd(void)
 }
 
 /*
- *--------------------------------------------------------------------
- *   ListAddBefore will add an element to the list before the
- *    current element of the list.  Storage will be aquired and the
- *    NewElement buffer will be copied to the new list element
- *    allocated from the memory heap.
- *-------------------------------------------------------------------
+ *--------------------------------------------------------------------------
+ * Function: AddEndBatch adds Count user records to the end of the list.
+ *    The records are contiguous, each the registered size, starting at
+ *    pRecords.  The elements are carved from the slab as one block and
+ *    linked to each other first, then the chain is hooked to the bottom
+ *    of the list in one step.  The add buffer is not used.  The current
+ *    element is the last record added.
+ *--------------------------------------------------------------------------
 */
-bool LLMgr::ListAddBefore(void)
+bool LLMgr::ListAddEndBatch(const void *pRecords, long Count)
 {
-     ListPointers_t *pCurrentEntryPointers;
-     ListPointers_t *pNewEntryPointers;
-     ListPointers_t *pPriorEntryPointers;
-    void *pNewBuffer;
-    void *pHoldBuffer;
-/*
- *-------------------------------------------------------------------
- * Check to be sure they registered their list
- *------------------------------------------------------------------
-*/
-     InitStatus(  LL_FILELINE, LL_ADDBEFORE );
+    char            *pRun;                                      // First element of the block
+    size_t           Stride;                                    // Distance between elements in the block
+    ListPointers_t  *pNewEntry;
+    ListPointers_t  *pPriorEntry;
+
+    std::unique_lock<LLLock>  Hold = ListWriteLock();            // LL_OPTION_THREADSAFE - exclusive
+
+    InitStatus(  LL_FILELINE, LL_ADDENDBATCH );
 
     if (ListRegistered != true)
     {
-         SetStatusFail(  LL_FILELINE, LL_STATUS_NOTREGISTERED ,LL_ADDBEFORE );
+        SetStatusFail(  LL_FILELINE, LL_STATUS_NOTREGISTERED, LL_ADDENDBATCH  );
         return  false;
     }
-/*
- *------------------------------------------------------------------
- * Check to see if this is the first entry in the list.
- *-----------------------------------------------------------------
-*/
-    if (pListTop == NULL)
-    {
-        return  ListAddEnd();
-    }
-/*
- *-----------------------------------------------------------------
- *  Get the local buffer for the size of the data + pointers. The constructor
- *       saved this in ListTotalElementLength.
- *-----------------------------------------------------------------
-*/
-    if ((pNewBuffer = malloc(ListTotalElementLength)) == NULL)
+
+    if (Count < 1 || pRecords == NULL)
     {
-        SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_ADDBEFORE  );
+        SetStatusFail(  LL_FILELINE, LL_STATUS_INVALIDSIZE, LL_ADDENDBATCH  );
         return  false;
     }
 
-    ((ListPointers_t*)pNewBuffer)->Random = rand();        // Get a random number for safety check
-    ((ListPointers_t*)pNewBuffer)->Address = pNewBuffer;  // Save elements address in pointer structure
+    if (pListUnroll != NULL)                                    // Nodes for every record first so it is all or nothing
+    {
+        UnrollCursor_t  Last;
 
-/*
- *------------------------------------------------------------------
- * Relocate the user's add buffer to the new buffer and the
- *   new buffer to the user's add buffer.
- *-----------------------------------------------------------------
-*/
-    pHoldBuffer    = pNewBuffer;	 // save new buffer addr
+        if (pListUnroll->UnrollReserve((size_t) Count) == false)
+        {
+            SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_ADDENDBATCH  );
+            return  false;
+        }
+        pListUnroll->UnrollLast(&Last);
+        for (long i = 0; i < Count; ++i)
+        {
+            pListUnroll->UnrollInsert(&Last, true, (const char *) pRecords + i * ListUserElementLength, (uint64_t) ElementRandom());
+        }
+        UnrollCursor = Last;
+        UnrollPoint();
+        ElementCount = ListElementCount += Count;
+        return  true;
+    }
+
+    if (pListDense != NULL)
+    {
+        if (pListDense->DenseReserve((size_t) Count) == false)
+        {
+            SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_ADDENDBATCH  );
+            return  false;
+        }
+        for (long i = 0; i < Count; ++i)
+        {
+            DenseAdd(pListDense->DenseLast(), true, (const char *) pRecords + i * ListUserElementLength, LL_ADDENDBATCH);
+        }
+        return  true;
+    }
+
+    if (pListHandle->HandleReserve((size_t) Count) == false         // Slots first so HandleAdd() can't fail
+     || (pRun = (char *) pListSlab->SlabAllocRun((size_t) Count)) == NULL)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_ADDENDBATCH  );
+        return  false;
+    }
+/*
+ *-----------------------------------------------------------------
+ * Build the chain inside the block.  Each element points back to
+ *    the one before it and forward to the one after it.
+ *-----------------------------------------------------------------
+*/
+    Stride      = pListSlab->SlabStride();
+    pPriorEntry = NULL;
+
+    for (long i = 0; i < Count; ++i)
+    {
+        pNewEntry = (ListPointers_t *)(pRun + i * Stride);
+
+        pNewEntry->pFwd    = (i + 1 < Count) ? pRun + (i + 1) * Stride : NULL;
+        pNewEntry->pBwd    = pPriorEntry;
+        pNewEntry->Address = pNewEntry;
+        HandleAdd(pNewEntry);
+
+        memcpy((char *) pNewEntry + sizeof(ListPointers_t),
+               (const char *) pRecords + i * ListUserElementLength, ListUserElementLength);
+
+        pPriorEntry = pNewEntry;
+    }
+/*
+ *-----------------------------------------------------------------
+ * Index the new elements.  If the index can't take them all the
+ *    ones that went in are taken out and the block is given back.
+ *-----------------------------------------------------------------
+*/
+    if (HasIndex() == true)
+    {
+        for (long i = 0; i < Count; ++i)
+        {
+            if (IndexAdd(pRun + i * Stride) == false)
+            {
+                while (i-- > 0)
+                {
+                    IndexRemove(pRun + i * Stride);
+                }
+                for (i = 0; i < Count; ++i)
+                {
+                    HandleRemove(pRun + i * Stride);
+                    pListSlab->SlabFree(pRun + i * Stride);
+                }
+                SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_ADDENDBATCH  );
+                return  false;
+            }
+        }
+    }
+/*
+ *-----------------------------------------------------------------
+ * Hook the chain on to the bottom of the list
+ *-----------------------------------------------------------------
+*/
+    if (pListTop == NULL)
+    {
+        LL_LINKSTORE(pListTop, pRun);
+    }
+    else
+    {
+        LL_LINKSTORE(((ListPointers_t *) pListBottom)->pFwd, pRun);
+        ((ListPointers_t *) pRun)->pBwd        = pListBottom;
+    }
+
+    pListBottom         = pPriorEntry;
+    pListCurrent        = pPriorEntry;
+    pUserCurrentElement = (char *) pPriorEntry + sizeof(ListPointers_t);
+
+    if (pListRank != NULL)
+    {
+        for (long i = 0; i < Count; ++i)
+        {
+            pListRank->RankInsertBefore(NULL, ElementRank(pRun + i * Stride));
+        }
+    }
+
+    ListElementCount += Count;
+    ElementCount      = ListElementCount;
+
+    return  true;
+}
+
+/*
+ *--------------------------------------------------------------------
+ *   ListAddBefore will add an element to the list before the
+ *    current element of the list.  Storage will be aquired and the
+ *    NewElement buffer will be copied to the new list element
+ *    allocated from the memory heap.
+ *-------------------------------------------------------------------
+*/
+bool LLMgr::ListAddBefore(void)
+{
+     ListPointers_t *pCurrentEntryPointers;
+     ListPointers_t *pNewEntryPointers;
+     ListPointers_t *pPriorEntryPointers;
+    void *pNewBuffer;
+    void *pHoldBuffer;
+/*
+ *-------------------------------------------------------------------
+ * Check to be sure they registered their list
+ *------------------------------------------------------------------
+*/
+     std::unique_lock<LLLock>  Hold = ListWriteLock();            // LL_OPTION_THREADSAFE - exclusive
+
+     InitStatus(  LL_FILELINE, LL_ADDBEFORE );
+
+    if (ListRegistered != true)
+    {
+         SetStatusFail(  LL_FILELINE, LL_STATUS_NOTREGISTERED ,LL_ADDBEFORE );
+        return  false;
+    }
+
+    if (pListUnroll != NULL)
+    {
+        return  UnrollAdd(UnrollCursor, false, LL_ADDBEFORE);
+    }
+
+    if (pListDense != NULL)
+    {
+        return  DenseAdd(DenseCurrent, false, pUserAddBuffer, LL_ADDBEFORE);
+    }
+/*
+ *------------------------------------------------------------------
+ * Check to see if this is the first entry in the list.
+ *-----------------------------------------------------------------
+*/
+    if (pListTop == NULL)
+    {
+        return  ListAddEnd();
+    }
+/*
+ *-----------------------------------------------------------------
+ *  Get the local buffer for the size of the data + pointers. It is
+ *       carved from the list slab sized by ListTotalElementLength.
+ *-----------------------------------------------------------------
+*/
+    if ((pNewBuffer = pListSlab->SlabAlloc()) == NULL)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_ADDBEFORE  );
+        return  false;
+    }
+
+    if (HandleAdd(pClassBuffer) == false)                    // The add buffer is the element going in
+    {
+        pListSlab->SlabFree(pNewBuffer);
+        SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_ADDBEFORE  );
+        return  false;
+    }
+
+    if (IndexAdd(pClassBuffer) == false)
+    {
+        HandleRemove(pClassBuffer);
+        pListSlab->SlabFree(pNewBuffer);
+        SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_ADDBEFORE  );
+        return  false;
+    }
+
+    ((ListPointers_t*)pNewBuffer)->Random = 0;               // Next add buffer - no handle slot until it goes in
+    ((ListPointers_t*)pNewBuffer)->Address = pNewBuffer;  // Save elements address in pointer structure
+
+/*
+ *------------------------------------------------------------------
+ * Relocate the user's add buffer to the new buffer and the
+ *   new buffer to the user's add buffer.
+ *-----------------------------------------------------------------
+*/
+    pHoldBuffer    = pNewBuffer;	 // save new buffer addr
     pNewBuffer     = pClassBuffer;   //  Get the current class buffer
     pClassBuffer   = pHoldBuffer;    // make the new buff the add buff
     pUserAddBuffer = (char *) pClassBuffer + sizeof( ListPointers_t);
@@ -436,7 +1202,7 @@ bool LLMgr::ListAddBefore(void)
     {
         pNewEntryPointers->pFwd     = pListTop;
         pCurrentEntryPointers->pBwd = pNewBuffer;
-        pListTop                    = pNewBuffer;
+        LL_LINKSTORE(pListTop, pNewBuffer);
     }
     else
     {
@@ -458,9 +1224,14 @@ bool LLMgr::ListAddBefore(void)
 
         pPriorEntryPointers = ( ListPointers_t *)pCurrentEntryPointers->pBwd;
 
-        pPriorEntryPointers->pFwd   = pNewBuffer;
+        LL_LINKSTORE(pPriorEntryPointers->pFwd, pNewBuffer);
         pCurrentEntryPointers->pBwd = pNewBuffer;
     }
+
+    if (pListRank != NULL)
+    {
+        pListRank->RankInsertBefore(ElementRank(pCurrentEntryPointers), ElementRank(pNewBuffer));
+    }
 /*
  *--------------------------------------------------------------------
  * Now we need to:
@@ -501,6 +1272,8 @@ bool LLMgr::ListAddAfter(void)
  * Check to be sure they registered their list
  *------------------------------------------------------------------
 */
+     std::unique_lock<LLLock>  Hold = ListWriteLock();            // LL_OPTION_THREADSAFE - exclusive
+
      InitStatus(  LL_FILELINE, LL_ADDAFTER );
 
     if (ListRegistered != true)
@@ -508,6 +1281,16 @@ bool LLMgr::ListAddAfter(void)
          SetStatusFail(  LL_FILELINE, LL_STATUS_NOTREGISTERED,LL_ADDAFTER  );
         return  false;
     }
+
+    if (pListUnroll != NULL)
+    {
+        return  UnrollAdd(UnrollCursor, true, LL_ADDAFTER);
+    }
+
+    if (pListDense != NULL)
+    {
+        return  DenseAdd(DenseCurrent, true, pUserAddBuffer, LL_ADDAFTER);
+    }
 /*
  *------------------------------------------------------------------
  * Check to see if this is the first entry in the list.
@@ -523,13 +1306,28 @@ bool LLMgr::ListAddAfter(void)
  *  Get the local buffer for the size of the data + pointers.
  *-----------------------------------------------------------------
 */
-    if ((pAfterBuffer = malloc(ListTotalElementLength)) == NULL)
+    if ((pAfterBuffer = pListSlab->SlabAlloc()) == NULL)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_ADDAFTER  );
+        return  false;
+    }
+
+    if (HandleAdd(pClassBuffer) == false)                    // The add buffer is the element going in
+    {
+        pListSlab->SlabFree(pAfterBuffer);
+        SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_ADDAFTER  );
+        return  false;
+    }
+
+    if (IndexAdd(pClassBuffer) == false)
     {
+        HandleRemove(pClassBuffer);
+        pListSlab->SlabFree(pAfterBuffer);
         SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_ADDAFTER  );
         return  false;
     }
 
-    ((ListPointers_t*)pAfterBuffer)->Random = rand();        // Get a random number for safety check
+    ((ListPointers_t*)pAfterBuffer)->Random = 0;               // Next add buffer - no handle slot until it goes in
     ((ListPointers_t*)pAfterBuffer)->Address = pAfterBuffer;  // Save elements address in pointer structure
 
 /*
@@ -571,7 +1369,7 @@ bool LLMgr::ListAddAfter(void)
  *-----------------------------------------------------------------
 */
         pNewEntry->pBwd        = ( ListPointers_t *)pListBottom;
-        pCurrentPointers->pFwd = pAfterBuffer;
+        LL_LINKSTORE(pCurrentPointers->pFwd, pAfterBuffer);
         pListBottom            = ( ListPointers_t *)pAfterBuffer;
     }
     else
@@ -582,13 +1380,21 @@ bool LLMgr::ListAddAfter(void)
  * 1) Set the Bwd pointer of the NewEntry to what is ListCurrent
  * 2) Set the Fwd pointer of the NewEntry to what was the Fwd pointer
  *    of the current entry.
- * 3) Set the Fwd pointer of what was the current entry to point to
+ * 3) Set the Bwd pointer of the entry after the current entry to
+ *    point to the locally defined AfterBuffer.
+ * 4) Set the Fwd pointer of what was the current entry to point to
  *    the locally defined AfterBuffer.
  *-----------------------------------------------------------------
 */
         pNewEntry->pBwd        = ( ListPointers_t *)pListCurrent;
         pNewEntry->pFwd        = pCurrentPointers->pFwd;
-        pCurrentPointers->pFwd = pAfterBuffer;
+        (( ListPointers_t *) pCurrentPointers->pFwd)->pBwd = pAfterBuffer;
+        LL_LINKSTORE(pCurrentPointers->pFwd, pAfterBuffer);
+    }
+
+    if (pListRank != NULL)
+    {
+        pListRank->RankInsertAfter(ElementRank(pCurrentPointers), ElementRank(pAfterBuffer));
     }
 /*
  *--------------------------------------------------------------------
@@ -615,78 +1421,1483 @@ bool LLMgr::ListAddAfter(void)
 /*
 *--------------------------------------------------------------
 *  Deletes all items of the list
+*     When every element lives in this list's own slab and no other
+*     list holds elements from it there is no need to walk the list.
+*     The chunks go back to the heap in one pass and the list is reset.
+*     The add buffer is carried over to a new slab element.
+*
+*     A list that has traded elements with another list by a splice
+*     can't give its chunks back.  The elements are walked once and put
+*     on the slab free list with their handle slots freed.
+*
+*     Either way the list gets a new epoch so a token taken before the
+*     delete will not match an element added after it.  The handle table
+*     goes with the epoch: it is emptied in one step, or replaced when
+*     another list still holds elements with slots in it.
 *--------------------------------------------------------------
 */
 
  bool  LLMgr::ListDeleteAll(void){
 
-   InitStatus(  LL_FILELINE, LL_DELETE_ALL );
-   ListPointTop();                          // Fixed Al's coding  mistake - GMG 2025-08-21
-  
-if(ElementCount){                           // if we have anything to delete
-    while( ListDelete() ==  true);
-  }
+    char            SaveArea[8192];         // User add buffer is at most 8192 bytes
+    ListPointers_t *pEntry;
+    ListPointers_t *pNextEntry;
+    LLHandle       *pNewHandle = NULL;
+
+    std::unique_lock<LLLock>  Hold = ListWriteLock();            // LL_OPTION_THREADSAFE - exclusive
+
+    InitStatus(  LL_FILELINE, LL_DELETE_ALL );
+
+    if (pListQueue != NULL)                 // Inbox records not taken go too
+    {
+        pListQueue->QueueClear();
+    }
+
+    if (ListRegistered != true || ListElementCount == 0)
+    {
+        return true;                        // Nothing to delete
+    }
+
+    if (pListHandle != NULL && pListHandle->RefCount > 1
+     && (pNewHandle = new (std::nothrow) LLHandle()) == NULL)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_DELETE_ALL  );
+        return false;                       // Nothing deleted yet
+    }
+
+    ListEpoch = NextEpoch();
+
+    if (pListUnroll != NULL)                // Every node goes, the add buffer is not in them
+    {
+        pListUnroll->UnrollClear();
+        UnrollCursor.pNode  = NULL;
+        UnrollPoint();
+        ElementCount        = ListElementCount = 0;
+        return true;
+    }
+
+    if (pListDense != NULL)
+    {
+        if (pListStore != NULL)             // The epoch goes in the file with the clear, so the old tokens
+        {                                   //   stay turned down after a restart
+            ListEpoch = pListStore->PersistHeader()->Epoch + 1;
+            pListStore->PersistPut(&pListStore->PersistHeader()->Epoch, ListEpoch);
+        }
+        pListDense->DenseClear();
+        DenseCurrent        = LL_DENSE_NONE;
+        DensePoint();
+        ElementCount        = ListElementCount = 0;
+        return true;
+    }
+
+    if (pListHash != NULL)
+    {
+        pListHash->HashClear();             // Every element is going
+    }
+    if (pListTree != NULL)
+    {
+        pListTree->TreeClear();
+    }
+    if (pListRank != NULL)
+    {
+        pListRank->RankClear();
+    }
+
+    if (pListReclaim != NULL)               // Unhook the whole chain and wait out the readers on it.  It is
+    {                                       // never spliced, so the slab is released below
+        LL_LINKSTORE(pListTop, NULL);
+        pListReclaim->ReclaimWait();
+        pListReclaim->ReclaimCollect();     // Elements deleted before go back to the slab first
+    }
+
+    if (pListSlab->RefCount > 1 || ListAdoptedSlabs.empty() == false)
+    {
+        for (pEntry = (ListPointers_t *) pListTop; pEntry != NULL; pEntry = pNextEntry)
+        {
+            pNextEntry     = (ListPointers_t *) pEntry->pFwd;
+            HandleRemove(pEntry);
+            pListSlab->SlabFree(pEntry);
+        }
+        HandleDropAll();                    // The slabs are kept, their elements are on the free list
+        HandleReset(pNewHandle);
+
+        LL_LINKSTORE(pListTop, NULL);
+        pListBottom         = NULL;
+        pListCurrent        = NULL;
+        pUserCurrentElement = NULL;
+        ElementCount        = ListElementCount = 0;
+
+        return true;
+    }
+
+    memcpy(SaveArea, pUserAddBuffer, ListUserElementLength);
+
+    pListSlab->SlabRelease();               // Every element and the add buffer are gone
+    HandleDropAll();
+    HandleReset(pNewHandle);
+
+    LL_LINKSTORE(pListTop, NULL);
+    pListBottom         = NULL;
+    pListCurrent        = NULL;
+    pUserCurrentElement = NULL;
+    ElementCount        = ListElementCount = 0;
+
+    if ((pClassBuffer = pListSlab->SlabAlloc()) == NULL)
+    {
+        pUserAddBuffer = NULL;
+        SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_DELETE_ALL  );
+        return false;
+    }
+
+    ((ListPointers_t*)pClassBuffer)->pFwd    = NULL;
+    ((ListPointers_t*)pClassBuffer)->pBwd    = NULL;
+    ((ListPointers_t*)pClassBuffer)->Address = pClassBuffer;
+    ((ListPointers_t*)pClassBuffer)->Random  = 0;
+    pUserAddBuffer = (char *) pClassBuffer + sizeof(ListPointers_t);
 
+    memcpy(pUserAddBuffer, SaveArea, ListUserElementLength);
 
-  return true;
+    return true;
 }
 
 /*
  *--------------------------------------------------------------------
- *  Delete the linked list entry which is at the current pointer
- *    then adjust the users current pointer to point to the
- *    correct entry.  This entry can be null if the list is empty
- *    so the next read or access can create a storage violation if
- *    the return code is not checked.
+ *  ListSort orders the list with the user Compare function.  It is a
+ *    bottom up merge sort on the pFwd chain: elements are taken from
+ *    the top one at a time and merged into Bins[], where Bins[i] is
+ *    empty or a sorted run of 2^i elements.  The bins are merged at
+ *    the end and the pBwd pointers are set in one last pass.
+ *
+ *    Only the pointers change, the user data is never copied, so the
+ *    tokens of the elements stay good.  Equal elements keep the order
+ *    they had.  The top element is current when the sort is done.
+ *    A position index is built again in the new order.
  *--------------------------------------------------------------------
 */
 
-bool LLMgr::ListDelete(void)
+#define  LL_SORT_BINS   64                  // Bins[i] holds 2^i elements - enough for any list
+
+static ListPointers_t *SortMerge(ListPointers_t *pLeft, ListPointers_t *pRight, ListCompare_t Compare)
 {
-/*
- *----------------------------------------------------------------
- * TopBottomSwitch Values
- * N = None      - T = Top      - B = Bottom
- *---------------------------------------------------------------
-*/
-    char    		TopBottomSwitch;
-     ListPointers_t   *pNextEntry ;
-     ListPointers_t  *pCurrentPointers;
-/*
- *----------------------------------------------------------------
- * 0) Assure we have registered the list
- * 1) Initialize the status return information.
- * 2) Check to assure we are not pointing to a NULL list.
- *----------------------------------------------------------------
-*/
-     InitStatus(  LL_FILELINE, LL_DELETE );
+    ListPointers_t   Head;
+    ListPointers_t  *pTail = &Head;
+//
+//  Take from the left run unless the right is strictly less - keeps the sort stable
+//
+    while (pLeft != NULL && pRight != NULL)
+    {
+        if (Compare((char *) pRight + sizeof(ListPointers_t), (char *) pLeft + sizeof(ListPointers_t)) < 0)
+        {
+            pTail->pFwd = pRight;
+            pRight      = (ListPointers_t *) pRight->pFwd;
+        }
+        else
+        {
+            pTail->pFwd = pLeft;
+            pLeft       = (ListPointers_t *) pLeft->pFwd;
+        }
+        pTail = (ListPointers_t *) pTail->pFwd;
+    }
+    pTail->pFwd = (pLeft != NULL) ? pLeft : pRight;
+
+    return (ListPointers_t *) Head.pFwd;
+}
+
+bool LLMgr::ListSort(ListCompare_t Compare)
+{
+    ListPointers_t  *Bins[LL_SORT_BINS] = { NULL };
+    ListPointers_t  *pRun;
+    ListPointers_t  *pNext;
+    ListPointers_t  *pEntry;
+    ListPointers_t  *pPrev;
+    int              Used = 0;              // Bins[0] to Bins[Used - 1] may hold runs
+    int              i;
+
+    std::unique_lock<LLLock>  Hold = ListWriteLock();            // LL_OPTION_THREADSAFE - exclusive
+
+    InitStatus(  LL_FILELINE, LL_SORT );
 
     if (ListRegistered != true)
     {
-         SetStatusFail(  LL_FILELINE, LL_STATUS_NOTREGISTERED, LL_DELETE  );
+        SetStatusFail(  LL_FILELINE, LL_STATUS_NOTREGISTERED, LL_SORT  );
         return  false;
     }
 
-    if (pListTop == NULL)
+    if (Compare == NULL || pListUnroll != NULL || pListDense != NULL || pListReclaim != NULL)
     {
-         SetStatusFail(  LL_FILELINE, LL_STATUS_LISTEMPTY, LL_DELETE  );
+        SetStatusFail(  LL_FILELINE, LL_STATUS_INVALIDPARM, LL_SORT  );
         return  false;
     }
-/*
- *-------------------------------------------------------------------
- * The checks must be complete if we get here so
- *   cast the pointers on the current entry fro the repair job.
- *------------------------------------------------------------------
-*/
-    pCurrentPointers = ( ListPointers_t *)pListCurrent;
-    TopBottomSwitch  = 'N';
-/*
- *-------------------------------------------------------------------
- * 1) Check to see if we are at the head of the list , if we are
- * 2) Make the NextEntry = to the forward pointer of current.
- * 3) Check to see if NextEntry is null.  When Null, no elements are
- *      left in the list so null all pointers.
- *      If it is not, Null the backward pointer and update the
+
+    if (ListElementCount < 2)
+    {
+        return  true;                       // Already in order
+    }
+//
+//  Each element is a run of 1.  Carry it up through the bins like adding 1 to a binary number.
+//      The run in a bin came before the new one in the list so it goes on the left.
+//
+    for (pEntry = (ListPointers_t *) pListTop; pEntry != NULL; pEntry = pNext)
+    {
+        pNext        = (ListPointers_t *) pEntry->pFwd;
+        pEntry->pFwd = NULL;
+        pRun         = pEntry;
+
+        for (i = 0; i < Used && Bins[i] != NULL; ++i)
+        {
+            pRun    = SortMerge(Bins[i], pRun, Compare);
+            Bins[i] = NULL;
+        }
+        Bins[i] = pRun;
+        if (i == Used)
+        {
+            ++Used;
+        }
+    }
+
+    pRun = NULL;
+    for (i = 0; i < Used; ++i)              // Lower bins hold the later elements
+    {
+        if (Bins[i] != NULL)
+        {
+            pRun = SortMerge(Bins[i], pRun, Compare);
+        }
+    }
+//
+//  Put back the pBwd pointers and the top and bottom
+//
+    if (pListRank != NULL)
+    {
+        pListRank->RankClear();
+    }
+
+    pPrev = NULL;
+    for (pEntry = pRun; pEntry != NULL; pEntry = (ListPointers_t *) pEntry->pFwd)
+    {
+        pEntry->pBwd = pPrev;
+        pPrev        = pEntry;
+
+        if (pListRank != NULL)
+        {
+            pListRank->RankInsertBefore(NULL, ElementRank(pEntry));
+        }
+    }
+
+    pListTop            = pRun;
+    pListBottom         = pPrev;
+    pListCurrent        = pListTop;
+    pUserCurrentElement = (char *) pListCurrent + sizeof(ListPointers_t);
+
+    return  true;
+}
+
+/*
+ *--------------------------------------------------------------------
+ *  The splice methods move elements from this list to the end of the
+ *    Target list.  Nothing is copied or reallocated, only the pFwd and
+ *    pBwd pointers at the ends of the run are changed, so a token taken
+ *    on this list keeps working on the Target.  The Target becomes a
+ *    holder of this list's slab so the storage stays while it has the
+ *    elements.  The current element of the Target is the first element
+ *    moved.
+ *
+ *    ListSpliceCurrent()  - the current element.  The current element of
+ *                           this list moves on as it does for ListDelete().
+ *    ListSpliceToBottom() - the current element through the bottom.  The
+ *                           moved elements are counted by following pFwd,
+ *                           the element before the run becomes current.
+ *    ListSpliceAll()      - every element, this list is left empty.
+ *--------------------------------------------------------------------
+*/
+
+bool LLMgr::ListSpliceCurrent(LLMgr &Target)
+{
+    ListPointers_t  *pMove;
+    void            *pNewCurrent;
+
+    std::unique_lock<LLLock>  Hold;                              // LL_OPTION_THREADSAFE - both lists exclusive
+    std::unique_lock<LLLock>  HoldTarget;
+    SpliceLock(Target, Hold, HoldTarget);
+
+    InitStatus(  LL_FILELINE, LL_SPLICECURRENT );
+
+    if (SpliceCheck(Target, LL_SPLICECURRENT) == false)
+    {
+        return  false;
+    }
+
+    pMove       = (ListPointers_t *) pListCurrent;
+    pNewCurrent = (pMove->pFwd != NULL) ? pMove->pFwd : pMove->pBwd;
+
+    HandleGive(pMove, Target);
+    bool Indexed = SpliceMove(Target, pMove, pMove, 1);
+
+    pListCurrent        = pNewCurrent;
+    pUserCurrentElement = (pListCurrent != NULL) ? (char *) pListCurrent + sizeof(ListPointers_t) : NULL;
+
+    return  Indexed;
+}
+
+bool LLMgr::ListSpliceToBottom(LLMgr &Target)
+{
+    ListPointers_t  *pFirst;
+    ListPointers_t  *pEntry;
+    long             Count = 0;
+
+    std::unique_lock<LLLock>  Hold;                              // LL_OPTION_THREADSAFE - both lists exclusive
+    std::unique_lock<LLLock>  HoldTarget;
+    SpliceLock(Target, Hold, HoldTarget);
+
+    InitStatus(  LL_FILELINE, LL_SPLICEBOTTOM );
+
+    if (SpliceCheck(Target, LL_SPLICEBOTTOM) == false)
+    {
+        return  false;
+    }
+
+    pFirst = (ListPointers_t *) pListCurrent;
+
+    for (pEntry = pFirst; pEntry != NULL; pEntry = (ListPointers_t *) pEntry->pFwd)
+    {
+        HandleGive(pEntry, Target);                              // The count walk hands the slots over too
+        ++Count;
+    }
+
+    pListCurrent = pFirst->pBwd;
+
+    bool Indexed = SpliceMove(Target, pFirst, pListBottom, Count);
+
+    pUserCurrentElement = (pListCurrent != NULL) ? (char *) pListCurrent + sizeof(ListPointers_t) : NULL;
+
+    return  Indexed;
+}
+
+bool LLMgr::ListSpliceAll(LLMgr &Target)
+{
+    HandleOwner_t  *pNewOwner;
+
+    std::unique_lock<LLLock>  Hold;                              // LL_OPTION_THREADSAFE - both lists exclusive
+    std::unique_lock<LLLock>  HoldTarget;
+    SpliceLock(Target, Hold, HoldTarget);
+
+    InitStatus(  LL_FILELINE, LL_SPLICEALL );
+
+    if (SpliceCheck(Target, LL_SPLICEALL) == false)
+    {
+        return  false;
+    }
+
+    if ((pNewOwner = new (std::nothrow) HandleOwner_t) == NULL)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_SPLICEALL  );
+        return  false;
+    }
+//
+//  Every element of this list points to this list's owner records, so they go to the Target naming
+//      it, and this list starts a new one.  No slot is touched.
+//
+    pListOwner->pList = &Target;
+    Target.ListAdoptedOwners.push_back(pListOwner);
+    for (HandleOwner_t *pAdopted : ListAdoptedOwners)
+    {
+        pAdopted->pList = &Target;
+        Target.ListAdoptedOwners.push_back(pAdopted);
+    }
+    ListAdoptedOwners.clear();
+    pListOwner        = pNewOwner;
+    pListOwner->pList = this;
+
+    bool Indexed = SpliceMove(Target, pListTop, pListBottom, ListElementCount);
+
+    pListCurrent        = NULL;
+    pUserCurrentElement = NULL;
+
+    return  Indexed;
+}
+
+/*
+ *--------------------------------------------------------------------
+ *  SpliceLock - a splice changes two lists, so both are held exclusive.
+ *    They are always taken lower address first so two threads splicing
+ *    the same pair opposite ways cannot each hold one and wait.
+ *--------------------------------------------------------------------
+*/
+
+void LLMgr::SpliceLock(LLMgr &Target, std::unique_lock<LLLock> &First, std::unique_lock<LLLock> &Second)
+{
+    LLLock  *pLow  = pListLock;
+    LLLock  *pHigh = Target.pListLock;
+
+    if (pLow != NULL && pHigh != NULL && std::less<LLLock *>()(pHigh, pLow))
+    {
+        std::swap(pLow, pHigh);
+    }
+    if (pLow != NULL)
+    {
+        First = std::unique_lock<LLLock>(*pLow);
+    }
+    if (pHigh != NULL && pHigh != pLow)
+    {
+        Second = std::unique_lock<LLLock>(*pHigh);
+    }
+}
+
+/*
+ *--------------------------------------------------------------------
+ *  SpliceCheck - both lists registered with the same user size, not
+ *    the same list, and something here to move.
+ *--------------------------------------------------------------------
+*/
+
+bool LLMgr::SpliceCheck(LLMgr &Target, long Command)
+{
+    if (ListRegistered != true)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_NOTREGISTERED, Command  );
+        return  false;
+    }
+
+    if (&Target == this || Target.ListRegistered != true
+        || Target.ListUserElementLength != ListUserElementLength
+        || (Target.pListRank == NULL) != (pListRank == NULL)           // Elements with and without a RankNode_t
+        || Target.pListUnroll != NULL || pListUnroll != NULL          // Records in nodes or dense arrays are not elements
+        || Target.pListDense != NULL || pListDense != NULL
+        || Target.pListReclaim != NULL || pListReclaim != NULL)       // Section readers may be on the relinked elements
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_INVALIDTARGET, Command  );
+        return  false;
+    }
+
+    if (pListTop == NULL)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_LISTEMPTY, Command  );
+        return  false;
+    }
+
+    return  true;
+}
+
+/*
+ *--------------------------------------------------------------------
+ *  SpliceMove unhooks the run pFirst..pLast (Count elements) from this
+ *    list and hooks it on to the bottom of the Target.  The Target
+ *    takes a hold on every slab the elements could have come from and
+ *    accepts the epochs of their tokens.  The callers have already
+ *    handed the handle slots of the run to the Target, so the tokens
+ *    stop working here.
+ *
+ *    When either list has a key index, or both have a position index,
+ *    the run is walked to move the elements between the indexes.  The move is done even if the
+ *    Target index can't grow, false comes back with ALLOCFAIL set.
+ *--------------------------------------------------------------------
+*/
+
+bool LLMgr::SpliceMove(LLMgr &Target, void *pFirst, void *pLast, long Count)
+{
+    ListPointers_t  *pFirstEntry = (ListPointers_t *) pFirst;
+    ListPointers_t  *pLastEntry  = (ListPointers_t *) pLast;
+//
+//  Unhook from this list
+//
+    if (pFirstEntry->pBwd == NULL)
+    {
+        pListTop = pLastEntry->pFwd;
+    }
+    else
+    {
+        ((ListPointers_t *) pFirstEntry->pBwd)->pFwd = pLastEntry->pFwd;
+    }
+
+    if (pLastEntry->pFwd == NULL)
+    {
+        pListBottom = pFirstEntry->pBwd;
+    }
+    else
+    {
+        ((ListPointers_t *) pLastEntry->pFwd)->pBwd = pFirstEntry->pBwd;
+    }
+
+    ElementCount = ListElementCount -= Count;
+//
+//  Hook on to the bottom of the Target
+//
+    pFirstEntry->pBwd = Target.pListBottom;
+    pLastEntry->pFwd  = NULL;
+
+    if (Target.pListTop == NULL)
+    {
+        Target.pListTop = pFirstEntry;
+    }
+    else
+    {
+        ((ListPointers_t *) Target.pListBottom)->pFwd = pFirstEntry;
+    }
+
+    Target.pListBottom         = pLastEntry;
+    Target.pListCurrent        = pFirstEntry;
+    Target.pUserCurrentElement = (char *) pFirstEntry + sizeof(ListPointers_t);
+    Target.ElementCount        = Target.ListElementCount += Count;
+//
+//  The Target holds this slab and the ones this list holds.  Their epochs come along.
+//
+    Target.SpliceAdopt(pListSlab, pListHandle);
+
+    for (size_t i = 0; i < ListAdoptedSlabs.size(); ++i)
+    {
+        Target.SpliceAdopt(ListAdoptedSlabs[i], NULL);
+    }
+    for (size_t i = 0; i < ListAdoptedHandles.size(); ++i)
+    {
+        Target.SpliceAdopt(NULL, ListAdoptedHandles[i]);
+    }
+//
+//  Move the elements between the position indexes - both lists have one or neither does
+//
+    if (pListRank != NULL)
+    {
+        for (ListPointers_t *pEntry = pFirstEntry; pEntry != NULL; pEntry = (ListPointers_t *) pEntry->pFwd)
+        {
+            pListRank->RankErase(ElementRank(pEntry));
+            Target.pListRank->RankInsertBefore(NULL, ElementRank(pEntry));
+        }
+    }
+//
+//  Move the elements between the key indexes
+//
+    bool  Indexed = true;
+
+    if (HasIndex() == true || Target.HasIndex() == true)
+    {
+        for (ListPointers_t *pEntry = pFirstEntry; pEntry != NULL; pEntry = (ListPointers_t *) pEntry->pFwd)
+        {
+            IndexRemove(pEntry);
+            Indexed = Target.IndexAdd(pEntry) && Indexed;
+        }
+    }
+
+    if (Indexed == false)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, Status.Command  );
+    }
+    return Indexed;
+}
+
+/*
+ *--------------------------------------------------------------------
+ *  SpliceAdopt - hold a slab that has elements in this list and accept
+ *    tokens carrying Epoch.  Each is only recorded once.
+ *--------------------------------------------------------------------
+*/
+
+void LLMgr::SpliceAdopt(LLSlab *pSlab, LLHandle *pHandle)
+{
+    if (pSlab != NULL && pSlab != pListSlab)
+    {
+        size_t i = 0;
+
+        while (i < ListAdoptedSlabs.size() && ListAdoptedSlabs[i] != pSlab)
+        {
+            ++i;
+        }
+        if (i == ListAdoptedSlabs.size())
+        {
+            pSlab->SlabHold();
+            ListAdoptedSlabs.push_back(pSlab);
+        }
+    }
+
+    if (pHandle != NULL && HandleOf(pHandle->Epoch) == NULL)
+    {
+        pHandle->HandleHold();
+        ListAdoptedHandles.push_back(pHandle);
+    }
+}
+
+/*
+ *--------------------------------------------------------------------
+ *  EpochValid - the epoch of a token is this list's or came in with
+ *    spliced elements.  Only spliced lists get past the first check.
+ *--------------------------------------------------------------------
+*/
+
+bool LLMgr::EpochValid(uint32_t Epoch)
+{
+    if (Epoch == ListEpoch)
+    {
+        return true;
+    }
+
+    for (size_t i = 0; i < ListAdoptedHandles.size(); ++i)
+    {
+        if (ListAdoptedHandles[i]->Epoch == Epoch)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ *--------------------------------------------------------------------
+ *  Handle table helpers.  An element in a classic list has a slot in
+ *    the table of its epoch - the high half of Random is the epoch and
+ *    the low half the slot.  Spliced in elements keep the slot they
+ *    had, their table is held with the epoch.
+ *--------------------------------------------------------------------
+*/
+
+LLHandle *LLMgr::HandleOf(uint32_t Epoch)
+{
+    if (pListHandle != NULL && pListHandle->Epoch == Epoch)
+    {
+        return pListHandle;
+    }
+
+    for (size_t i = 0; i < ListAdoptedHandles.size(); ++i)
+    {
+        if (ListAdoptedHandles[i]->Epoch == Epoch)
+        {
+            return ListAdoptedHandles[i];
+        }
+    }
+    return NULL;
+}
+
+bool LLMgr::HandleAdd(void *pElement)
+{
+    uint32_t  Slot;
+
+    if ((Slot = pListHandle->HandleAlloc(pElement, pListOwner)) == LL_HANDLE_NONE)
+    {
+        return false;
+    }
+    ((ListPointers_t *) pElement)->Random = (time_t)(((uint64_t) ListEpoch << 32) | Slot);
+    return true;
+}
+
+void LLMgr::HandleRemove(void *pElement)
+{
+    uint64_t  Random = (uint64_t)((ListPointers_t *) pElement)->Random;
+
+    HandleOf((uint32_t)(Random >> 32))->HandleFree((uint32_t) Random);
+}
+
+void LLMgr::HandleDropAll(void)
+{
+    for (LLHandle *pAdopted : ListAdoptedHandles)
+    {
+        if (pAdopted->HandleDrop() == true)
+        {
+            delete pAdopted;
+        }
+    }
+    ListAdoptedHandles.clear();
+
+    for (HandleOwner_t *pAdopted : ListAdoptedOwners)   // Only the elements of this list point to them, and
+    {                                                   //   they are gone
+        delete pAdopted;
+    }
+    ListAdoptedOwners.clear();
+}
+
+void LLMgr::HandleGive(void *pElement, LLMgr &Target)
+{
+    uint64_t  Random = (uint64_t)((ListPointers_t *) pElement)->Random;
+
+    HandleOf((uint32_t)(Random >> 32))->HandleOwn((uint32_t) Random, Target.pListOwner);
+}
+
+/*
+ *--------------------------------------------------------------------
+ *  HandleReset gives the list an empty handle table for the new epoch
+ *    after ListDeleteAll().  pNew replaces a table another list still
+ *    holds, otherwise the table is emptied in place.
+ *--------------------------------------------------------------------
+*/
+
+void LLMgr::HandleReset(LLHandle *pNew)
+{
+    if (pListHandle == NULL)
+    {
+        return;                             // Unrolled or dense
+    }
+
+    if (pNew != NULL)
+    {
+        pListHandle->HandleDrop();
+        pListHandle = pNew;
+    }
+    else
+    {
+        pListHandle->HandleClear();
+    }
+    pListHandle->Epoch = ListEpoch;
+}
+
+/*
+ *--------------------------------------------------------------------
+ *  Key index helpers.  A key is the KeyLength bytes of a key index or
+ *    a whole user data area for a callback index.  HashBytes() works a
+ *    word at a time and mixes the result so nearby keys spread over
+ *    the table.
+ *--------------------------------------------------------------------
+*/
+
+uint64_t LLMgr::HashBytes(const void *pKey, size_t Length)
+{
+    const unsigned char *pByte = (const unsigned char *) pKey;
+    uint64_t             Hash  = 0x9E3779B97F4A7C15ULL ^ Length;
+    uint64_t             Word;
+
+    while (Length >= sizeof(uint64_t))
+    {
+        memcpy(&Word, pByte, sizeof(uint64_t));
+        Hash    = (Hash ^ Word) * 0xBF58476D1CE4E5B9ULL;
+        Hash   ^= Hash >> 31;
+        pByte  += sizeof(uint64_t);
+        Length -= sizeof(uint64_t);
+    }
+
+    Word = 0;
+    memcpy(&Word, pByte, Length);                   // Last 0-7 bytes
+    Hash  = (Hash ^ Word) * 0x94D049BB133111EBULL;
+    Hash ^= Hash >> 29;
+    Hash *= 0xBF58476D1CE4E5B9ULL;
+    Hash ^= Hash >> 32;
+
+    return Hash;
+}
+
+uint64_t LLMgr::KeyHash(const void *pKey)
+{
+    uint64_t  Hash;
+
+    if (HashKeyLength != 0)
+    {
+        return HashBytes(pKey, (size_t) HashKeyLength);
+    }
+
+    Hash  = HashFunction(pKey);                     // The table uses the low bits - mix in the high ones
+    Hash ^= Hash >> 33;
+    Hash *= 0xFF51AFD7ED558CCDULL;
+    Hash ^= Hash >> 33;
+    return Hash;
+}
+
+const void *LLMgr::ElementKey(void *pElement)
+{
+    return (char *) pElement + sizeof(ListPointers_t) + HashKeyOffset;
+}
+
+bool LLMgr::IndexAdd(void *pElement)
+{
+    if (pListHash != NULL && pListHash->HashInsert(KeyHash(ElementKey(pElement)), pElement) == false)
+    {
+        return false;
+    }
+
+    if (pListTree != NULL
+        && pListTree->TreeInsert((char *) pElement + sizeof(ListPointers_t) + TreeKeyOffset, pElement) == false)
+    {
+        if (pListHash != NULL)
+        {
+            pListHash->HashErase(KeyHash(ElementKey(pElement)), pElement);
+        }
+        return false;
+    }
+    return true;
+}
+
+void LLMgr::IndexRemove(void *pElement)
+{
+    if (pListHash != NULL)
+    {
+        pListHash->HashErase(KeyHash(ElementKey(pElement)), pElement);
+    }
+    if (pListTree != NULL)
+    {
+        const void *pKey = (char *) pElement + sizeof(ListPointers_t) + TreeKeyOffset;
+
+        pListTree->TreeErase(pKey, pElement);
+
+        if (pElement == pTreeElement)                   // Deleting as ListSeekNext() goes - keep the place
+        {
+            pTreeElement = pListTree->TreeSeek(pKey, pElement, &TreeCursor);
+            TreeAhead    = true;
+        }
+    }
+}
+
+/*
+ *--------------------------------------------------------------------
+ *  ListFind points to an element with the key.  Only the elements
+ *    with the same hash are compared, the list is not walked.
+ *--------------------------------------------------------------------
+*/
+
+bool LLMgr::ListFind(const void *pKey)
+{
+    void        *pElement;
+
+    std::unique_lock<LLLock>  Hold = ListWriteLock();            // LL_OPTION_THREADSAFE - exclusive
+
+    InitStatus(  LL_FILELINE, LL_FIND );
+
+    if (ListRegistered != true)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_NOTREGISTERED, LL_FIND  );
+        return  false;
+    }
+
+    if (pListHash == NULL)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_NOINDEX, LL_FIND  );
+        return  false;
+    }
+
+    if (pKey == NULL)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_INVALIDPARM, LL_FIND  );
+        return  false;
+    }
+
+    if ((pElement = FindElement(pKey)) != NULL)
+    {
+        pListCurrent        = pElement;
+        pUserCurrentElement = (char *) pElement + sizeof(ListPointers_t);
+        return  true;
+    }
+
+    SetStatusFail(  LL_FILELINE, LL_STATUS_NOTFOUND, LL_FIND  );
+    return  false;
+}
+
+/*
+ *--------------------------------------------------------------------
+ *  FindElement - the probe of ListFind() and ListFindCursor().  Only
+ *    reads the index and the elements, so it runs under a shared lock.
+ *--------------------------------------------------------------------
+*/
+
+void *LLMgr::FindElement(const void *pKey)
+{
+    HashProbe_t  Probe;
+    uint64_t     Hash = KeyHash(pKey);
+    void        *pElement;
+
+    for (pElement = pListHash->HashFirst(Hash, &Probe); pElement != NULL; pElement = pListHash->HashNext(Hash, &Probe))
+    {
+        if ((HashKeyLength != 0) ? memcmp(ElementKey(pElement), pKey, (size_t) HashKeyLength) == 0
+                                 : HashCompare(ElementKey(pElement), pKey) == 0)
+        {
+            return  pElement;
+        }
+    }
+    return  NULL;
+}
+
+/*
+ *--------------------------------------------------------------------
+ *  ListFindCursor - ListFind() for a thread with its own cursor.  The
+ *    current element does not move, the lookup takes the list lock
+ *    shared so any number of them run at once.  The cursor is end()
+ *    when nothing has the key.  Hold ListReadLock() across the lookup
+ *    and the use of the cursor if other threads change the list.
+ *--------------------------------------------------------------------
+*/
+
+LLCursor LLMgr::ListFindCursor(const void *pKey)
+{
+    std::shared_lock<LLLock>  Hold = ListReadLock();           // LL_OPTION_THREADSAFE - shared
+    LLCursor                  Found = end();
+
+    ReadInit(  LL_FILELINE, LL_FINDCURSOR );
+
+    if (ListRegistered != true)
+    {
+        ReadFail(  LL_FILELINE, LL_STATUS_NOTREGISTERED, LL_FINDCURSOR  );
+        return  Found;
+    }
+
+    if (pListHash == NULL || pKey == NULL)
+    {
+        ReadFail(  LL_FILELINE, (pListHash == NULL) ? LL_STATUS_NOINDEX : LL_STATUS_INVALIDPARM, LL_FINDCURSOR  );
+        return  Found;
+    }
+
+    if ((Found.pElement = FindElement(pKey)) == NULL)
+    {
+        ReadFail(  LL_FILELINE, LL_STATUS_NOTFOUND, LL_FINDCURSOR  );
+    }
+    return  Found;
+}
+
+/*
+ *--------------------------------------------------------------------
+ *  ListOrderIndex adds an ordered index on KeyLength bytes at KeyOffset
+ *    in the user data area.  Compare is called with two keys, not user
+ *    data areas, NULL compares them with memcmp().  The elements already
+ *    in the list are indexed.  Every add, delete and splice after that
+ *    keeps it up to date.  The key must not be changed while the
+ *    element is in the list.  A list has one ordered index.
+ *--------------------------------------------------------------------
+*/
+
+bool LLMgr::ListOrderIndex(long KeyOffset, long KeyLength, ListCompare_t Compare)
+{
+    ListPointers_t  *pEntry;
+
+    std::unique_lock<LLLock>  Hold = ListWriteLock();            // LL_OPTION_THREADSAFE - exclusive
+
+    InitStatus(  LL_FILELINE, LL_ORDERINDEX );
+
+    if (ListRegistered != true)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_NOTREGISTERED, LL_ORDERINDEX  );
+        return  false;
+    }
+
+    if (pListTree != NULL || pListUnroll != NULL || pListDense != NULL
+        || KeyOffset < 0 || KeyLength < 1 || KeyOffset + KeyLength > ListUserElementLength)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_INVALIDPARM, LL_ORDERINDEX  );
+        return  false;
+    }
+
+    if ((pListTree = new (std::nothrow) LLTree()) == NULL || pListTree->TreeInit((size_t) KeyLength, Compare) == false)
+    {
+        delete pListTree;
+        pListTree = NULL;
+        SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_ORDERINDEX  );
+        return  false;
+    }
+    TreeKeyOffset = KeyOffset;
+
+    for (pEntry = (ListPointers_t *) pListTop; pEntry != NULL; pEntry = (ListPointers_t *) pEntry->pFwd)
+    {
+        if (pListTree->TreeInsert((char *) pEntry + sizeof(ListPointers_t) + TreeKeyOffset, pEntry) == false)
+        {
+            delete pListTree;
+            pListTree = NULL;
+            SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_ORDERINDEX  );
+            return  false;
+        }
+    }
+    return  true;
+}
+
+/*
+ *--------------------------------------------------------------------
+ *  ListSeek points to the first element in key order with a key >= the
+ *    key passed, "the first session due at or after now".  ListSeekNext
+ *    then moves to the element after the current one in key order, so
+ *    a range [a, b) is ListSeek(a) then ListSeekNext() until the key
+ *    is >= b.  Elements with equal keys come back in no set order.
+ *
+ *    ListSeekNext() carries on from where the tree cursor is when the
+ *    list has not changed.  After an add, or a move of the current
+ *    element by another method, it looks up the key of the current
+ *    element again.  When ListDelete() takes the element ListSeekNext()
+ *    is on, the next ListSeekNext() goes to the element after it in key
+ *    order, so a range can be deleted from as it is walked.
+ *--------------------------------------------------------------------
+*/
+
+bool LLMgr::ListSeek(const void *pKey)
+{
+    void    *pElement;
+
+    std::unique_lock<LLLock>  Hold = ListWriteLock();            // LL_OPTION_THREADSAFE - exclusive
+
+    InitStatus(  LL_FILELINE, LL_SEEK );
+
+    if (ListRegistered != true)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_NOTREGISTERED, LL_SEEK  );
+        return  false;
+    }
+
+    if (pListTree == NULL)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_NOINDEX, LL_SEEK  );
+        return  false;
+    }
+
+    if (pKey == NULL)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_INVALIDPARM, LL_SEEK  );
+        return  false;
+    }
+
+    if ((pElement = pListTree->TreeSeek(pKey, NULL, &TreeCursor)) == NULL)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_NOTFOUND, LL_SEEK  );
+        return  false;
+    }
+
+    pTreeElement        = pElement;
+    TreeAhead           = false;
+    pListCurrent        = pElement;
+    pUserCurrentElement = (char *) pElement + sizeof(ListPointers_t);
+    return  true;
+}
+
+bool LLMgr::ListSeekNext(void)
+{
+    void    *pElement;
+
+    std::unique_lock<LLLock>  Hold = ListWriteLock();            // LL_OPTION_THREADSAFE - exclusive
+
+    InitStatus(  LL_FILELINE, LL_SEEKNEXT );
+
+    if (ListRegistered != true)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_NOTREGISTERED, LL_SEEKNEXT  );
+        return  false;
+    }
+
+    if (pListTree == NULL)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_NOINDEX, LL_SEEKNEXT  );
+        return  false;
+    }
+
+    if (TreeAhead == true && TreeCursor.Changes == pListTree->Changes)
+    {
+        pElement = pTreeElement;                        // The one after the element ListDelete() took
+    }
+    else if (pListCurrent == NULL)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_LISTEMPTY, LL_SEEKNEXT  );
+        return  false;
+    }
+    else if (pTreeElement == pListCurrent && TreeCursor.Changes == pListTree->Changes)
+    {
+        pElement = pListTree->TreeNext(&TreeCursor);
+    }
+    else
+    {
+        pElement = pListTree->TreeSeek((char *) pListCurrent + sizeof(ListPointers_t) + TreeKeyOffset,
+                                       pListCurrent, &TreeCursor);
+    }
+
+    TreeAhead = false;
+
+    if (pElement == NULL)
+    {
+        pTreeElement = NULL;
+        SetStatusFail(  LL_FILELINE, LL_STATUS_LISTEND, LL_SEEKNEXT  );
+        return  false;
+    }
+
+    pTreeElement        = pElement;
+    pListCurrent        = pElement;
+    pUserCurrentElement = (char *) pElement + sizeof(ListPointers_t);
+    return  true;
+}
+
+/*
+ *--------------------------------------------------------------------
+ *  ListPointIndex points to the element at Position, 0 is the top of
+ *    the list, and ListCurrentIndex tells the position of the current
+ *    element.  Both take O(log n) in the position index, so the list
+ *    must be registered with LL_OPTION_POSITION.  A page of a list is
+ *    ListPointIndex() to the first element then ListPointNext().
+ *--------------------------------------------------------------------
+*/
+
+bool LLMgr::ListPointIndex(long Position)
+{
+    RankNode_t  *pNode;
+
+    std::unique_lock<LLLock>  Hold = ListWriteLock();            // LL_OPTION_THREADSAFE - exclusive
+
+    InitStatus(  LL_FILELINE, LL_POINTINDEX );
+
+    if (ListRegistered != true)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_NOTREGISTERED, LL_POINTINDEX  );
+        return  false;
+    }
+
+    if (pListRank == NULL)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_NOINDEX, LL_POINTINDEX  );
+        return  false;
+    }
+
+    if (Position < 0)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_INVALIDPARM, LL_POINTINDEX  );
+        return  false;
+    }
+
+    if ((pNode = pListRank->RankAt((size_t) Position)) == NULL)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_LISTEND, LL_POINTINDEX  );
+        return  false;
+    }
+
+    pListCurrent        = (char *) pNode - RankOffset;
+    pUserCurrentElement = (char *) pListCurrent + sizeof(ListPointers_t);
+    return  true;
+}
+
+long LLMgr::ListCurrentIndex(void)
+{
+    std::unique_lock<LLLock>  Hold = ListWriteLock();            // LL_OPTION_THREADSAFE - exclusive
+
+    InitStatus(  LL_FILELINE, LL_CURRENTINDEX );
+
+    if (ListRegistered != true)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_NOTREGISTERED, LL_CURRENTINDEX  );
+        return  -1;
+    }
+
+    if (pListRank == NULL)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_NOINDEX, LL_CURRENTINDEX  );
+        return  -1;
+    }
+
+    if (pListCurrent == NULL)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_LISTEMPTY, LL_CURRENTINDEX  );
+        return  -1;
+    }
+
+    return  (long) pListRank->RankOf(ElementRank(pListCurrent));
+}
+
+/*
+ *--------------------------------------------------------------------
+ *  ListPointCursor makes the element a cursor is on the current
+ *    element, after a walk or a std::find_if() has found it.  The
+ *    cursor must be on this list and not past the end.
+ *--------------------------------------------------------------------
+*/
+
+bool LLMgr::ListPointCursor(const LLCursor &Cursor)
+{
+    std::unique_lock<LLLock>  Hold = ListWriteLock();            // LL_OPTION_THREADSAFE - exclusive
+
+    InitStatus(  LL_FILELINE, LL_POINTCURSOR );
+
+    if (ListRegistered != true)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_NOTREGISTERED, LL_POINTCURSOR  );
+        return  false;
+    }
+
+    if (Cursor.pList != this)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_INVALIDPARM, LL_POINTCURSOR  );
+        return  false;
+    }
+
+    if (Cursor.Element() == NULL)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_LISTEND, LL_POINTCURSOR  );
+        return  false;
+    }
+
+    if (pListUnroll != NULL)
+    {
+        UnrollCursor = Cursor.Unroll;
+        UnrollPoint();
+        return  true;
+    }
+
+    if (pListDense != NULL)
+    {
+        DenseCurrent = Cursor.Index;
+        DensePoint();
+        return  true;
+    }
+
+    pListCurrent        = Cursor.pElement;
+    pUserCurrentElement = (char *) pListCurrent + sizeof(ListPointers_t);
+    return  true;
+}
+
+/*
+ *--------------------------------------------------------------------
+ *  Unrolled list helpers.  UnrollAdd copies the add buffer in after or
+ *    before the record At (pNode NULL on an empty list) and makes it
+ *    current.  UnrollPoint sets the current pointers from UnrollCursor:
+ *    pUserCurrentElement is the record and pListCurrent its tag.
+ *--------------------------------------------------------------------
+*/
+
+bool LLMgr::UnrollAdd(UnrollCursor_t At, bool After, long Command)
+{
+    if (pListUnroll->UnrollInsert(&At, After, pUserAddBuffer, (uint64_t) ElementRandom()) == false)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, Command  );
+        return  false;
+    }
+
+    UnrollCursor = At;
+    UnrollPoint();
+    ElementCount = ++ListElementCount;
+    return  true;
+}
+
+void LLMgr::UnrollPoint(void)
+{
+    if (UnrollCursor.pNode == NULL)
+    {
+        pListCurrent        = NULL;
+        pUserCurrentElement = NULL;
+        return;
+    }
+
+    pUserCurrentElement = pListUnroll->UnrollRecord(&UnrollCursor);
+    pListCurrent        = (char *) pUserCurrentElement - sizeof(uint64_t);
+}
+
+/*
+ *--------------------------------------------------------------------
+ *  Dense list helpers.  DenseAdd links a copy of pRecord after or
+ *    before the element At (LL_DENSE_NONE on an empty list) and makes
+ *    it current.  DensePoint sets the current pointers from
+ *    DenseCurrent, pListCurrent is the record as there are no
+ *    pointers in front of it.
+ *--------------------------------------------------------------------
+*/
+
+bool LLMgr::DenseAdd(uint32_t At, bool After, const void *pRecord, long Command)
+{
+    uint32_t  Random = (uint32_t) ElementRandom();
+    uint32_t  Index;
+
+    if ((Index = pListDense->DenseAlloc(Random != 0 ? Random : 1)) == LL_DENSE_NONE)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, Command  );
+        return  false;
+    }
+    memcpy(pListDense->DenseRecord(Index), pRecord, ListUserElementLength);
+
+    if (After == true)
+    {
+        pListDense->DenseLinkAfter(At, Index);
+    }
+    else
+    {
+        pListDense->DenseLinkBefore(At, Index);
+    }
+
+    DenseCurrent = Index;
+    DensePoint();
+    ElementCount = ++ListElementCount;
+    return  true;
+}
+
+void LLMgr::DensePoint(void)
+{
+    if (DenseCurrent == LL_DENSE_NONE)
+    {
+        pListCurrent        = NULL;
+        pUserCurrentElement = NULL;
+        return;
+    }
+
+    pUserCurrentElement = pListDense->DenseRecord(DenseCurrent);
+    pListCurrent        = pUserCurrentElement;
+    DenseCurrentRandom  = pListDense->DenseRandom(DenseCurrent);
+}
+
+/*
+ *--------------------------------------------------------------------
+ *  ListReserve makes sure Count more elements can be added without
+ *    the slab going back to the heap.  Used to pre-fill a list that
+ *    is about to be loaded or that sees heavy add/delete churn.
+ *--------------------------------------------------------------------
+*/
+
+bool LLMgr::ListReserve(long Count)
+{
+    std::unique_lock<LLLock>  Hold = ListWriteLock();            // LL_OPTION_THREADSAFE - exclusive
+
+    InitStatus(  LL_FILELINE, LL_RESERVE );
+
+    if (ListRegistered != true)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_NOTREGISTERED, LL_RESERVE  );
+        return  false;
+    }
+
+    if (Count < 0)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_INVALIDSIZE, LL_RESERVE  );
+        return  false;
+    }
+
+    if (pListUnroll != NULL)
+    {
+        if (pListUnroll->UnrollReserve((size_t) Count) == false)
+        {
+            SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_RESERVE  );
+            return  false;
+        }
+        return  true;
+    }
+
+    if (pListDense != NULL)
+    {
+        if (pListDense->DenseReserve((size_t) Count) == false)
+        {
+            SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_RESERVE  );
+            return  false;
+        }
+        return  true;
+    }
+
+    if (pListSlab->SlabReserve(Count) == false
+        || pListHandle->HandleReserve((size_t) Count) == false
+        || (pListHash != NULL && pListHash->HashReserve((size_t)(ListElementCount + Count)) == false))
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_ALLOCFAIL, LL_RESERVE  );
+        return  false;
+    }
+
+    return  true;
+}
+
+/*
+ *--------------------------------------------------------------------
+ *  ListSync writes every changed page of a persistent list to the
+ *    disk and marks the file clean, so it opens after a machine crash
+ *    without the link check.  Costs a write of the pages changed since
+ *    the last one - call it at the points a restart should come back
+ *    to, not on every add.
+ *--------------------------------------------------------------------
+*/
+
+bool LLMgr::ListSync(void)
+{
+    std::unique_lock<LLLock>  Hold = ListWriteLock();            // LL_OPTION_THREADSAFE - exclusive
+
+    InitStatus(  LL_FILELINE, LL_SYNC );
+
+    if (ListRegistered != true)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_NOTREGISTERED, LL_SYNC  );
+        return  false;
+    }
+
+    if (pListStore == NULL)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_NOINDEX, LL_SYNC  );
+        return  false;
+    }
+
+    if (pListStore->PersistSync() == false)
+    {
+        SetStatusFail(  LL_FILELINE, LL_STATUS_BADFILE, LL_SYNC  );
+        return  false;
+    }
+
+    return  true;
+}
+
+/*
+ *--------------------------------------------------------------------
+ *  Delete the linked list entry which is at the current pointer
+ *    then adjust the users current pointer to point to the
+ *    correct entry.  This entry can be null if the list is empty
+ *    so the next read or access can create a storage violation if
+ *    the return code is not checked.
+ *--------------------------------------------------------------------
+*/
+
+bool LLMgr::ListDelete(void)
+{
+/*
+ *----------------------------------------------------------------
+ * TopBottomSwitch Values
+ * N = None      - T = Top      - B = Bottom
+ *---------------------------------------------------------------
+*/
+    char    		TopBottomSwitch;
+     ListPointers_t   *pNextEntry ;
+     ListPointers_t  *pCurrentPointers;
+/*
+ *----------------------------------------------------------------
+ * 0) Assure we have registered the list
+ * 1) Initialize the status return information.
+ * 2) Check to assure we are not pointing to a NULL list.
+ *----------------------------------------------------------------
+*/
+     std::unique_lock<LLLock>  Hold = ListWriteLock();            // LL_OPTION_THREADSAFE - exclusive
+
+     InitStatus(  LL_FILELINE, LL_DELETE );
+
+    if (ListRegistered != true)
+    {
+         SetStatusFail(  LL_FILELINE, LL_STATUS_NOTREGISTERED, LL_DELETE  );
+        return  false;
+    }
+
+    if (pListUnroll != NULL)
+    {
+        if (ListElementCount == 0)
+        {
+            SetStatusFail(  LL_FILELINE, LL_STATUS_LISTEMPTY, LL_DELETE  );
+            return  false;
+        }
+        pListUnroll->UnrollErase(&UnrollCursor);
+        UnrollPoint();
+        ElementCount = --ListElementCount;
+        return  true;
+    }
+
+    if (pListDense != NULL)                                     // Current moves to the next, or back one at the bottom
+    {
+        uint32_t  Deleted = DenseCurrent;
+
+        if (ListElementCount == 0)
+        {
+            SetStatusFail(  LL_FILELINE, LL_STATUS_LISTEMPTY, LL_DELETE  );
+            return  false;
+        }
+        if (Deleted == LL_DENSE_NONE)                           // Reopened, or another process deleted it
+        {
+            SetStatusFail(  LL_FILELINE, LL_STATUS_LISTEND, LL_DELETE  );
+            return  false;
+        }
+        DenseCurrent = pListDense->DenseNext(Deleted);
+        if (DenseCurrent == LL_DENSE_NONE)
+        {
+            DenseCurrent = pListDense->DensePrev(Deleted);
+        }
+        pListDense->DenseErase(Deleted);
+        DensePoint();
+        ElementCount = --ListElementCount;
+        return  true;
+    }
+
+    if (pListTop == NULL)
+    {
+         SetStatusFail(  LL_FILELINE, LL_STATUS_LISTEMPTY, LL_DELETE  );
+        return  false;
+    }
+/*
+ *-------------------------------------------------------------------
+ * The checks must be complete if we get here so
+ *   cast the pointers on the current entry fro the repair job.
+ *------------------------------------------------------------------
+*/
+    pCurrentPointers = ( ListPointers_t *)pListCurrent;
+    TopBottomSwitch  = 'N';
+/*
+ *-------------------------------------------------------------------
+ * 1) Check to see if we are at the head of the list , if we are
+ * 2) Make the NextEntry = to the forward pointer of current.
+ * 3) Check to see if NextEntry is null.  When Null, no elements are
+ *      left in the list so null all pointers.
+ *      If it is not, Null the backward pointer and update the
  *      top and current list pointers.
  *------------------------------------------------------------------
 */
@@ -697,14 +2908,14 @@ bool LLMgr::ListDelete(void)
 
         if (pNextEntry == NULL)
         {
-            pListTop     = NULL;
+            LL_LINKSTORE(pListTop, NULL);
             pListBottom  = NULL;
             pListCurrent = NULL;
         }
         else
         {
             pNextEntry->pBwd = NULL;
-            pListTop         = pNextEntry;
+            LL_LINKSTORE(pListTop, pNextEntry);
             pListCurrent     = pNextEntry;
         }
     }
@@ -722,13 +2933,13 @@ bool LLMgr::ListDelete(void)
 
         if (pNextEntry == NULL)
         {
-            pListTop = NULL;
+            LL_LINKSTORE(pListTop, NULL);
             pListBottom = NULL;
             pListCurrent = NULL;
         }
         else
         {
-            pNextEntry->pFwd = NULL;
+            LL_LINKSTORE(pNextEntry->pFwd, NULL);
             pListBottom      = pNextEntry;
             pListCurrent     = pNextEntry;
         }
@@ -746,7 +2957,7 @@ bool LLMgr::ListDelete(void)
     if (TopBottomSwitch == 'N')
     {
         pNextEntry       = ( ListPointers_t *)pCurrentPointers->pBwd;
-        pNextEntry->pFwd = pCurrentPointers->pFwd;
+        LL_LINKSTORE(pNextEntry->pFwd, pCurrentPointers->pFwd);
         pNextEntry       = ( ListPointers_t *)pCurrentPointers->pFwd;
         pNextEntry->pBwd = pCurrentPointers->pBwd;
         pListCurrent     = pNextEntry;
@@ -771,9 +2982,25 @@ bool LLMgr::ListDelete(void)
 
     ElementCount = --ListElementCount;
 
-    (( ListPointers_t *) pCurrentPointers)->Random = 0;
+    IndexRemove(pCurrentPointers);
+
+    if (pListRank != NULL)
+    {
+        pListRank->RankErase(ElementRank(pCurrentPointers));
+    }
+
+    HandleRemove(pCurrentPointers);                    // Tokens for it fail from here on
+
+    if (pListReclaim != NULL)                          // A section reader may be on it - its pFwd still leads on
+    {
+        if (pListReclaim->ReclaimRetire(pCurrentPointers) == true)
+        {
+            pListReclaim->ReclaimCollect();
+        }
+        return  true;
+    }
 
-    free(pCurrentPointers);
+    pListSlab->SlabFree(pCurrentPointers);             // Back on the slab free list for the next add
 
     return  true;
 }
@@ -792,8 +3019,24 @@ bool LLMgr::ListPointTop(void)
  * Indicate the last command to be executed for dubugging
  *----------------------------------------------------------------
 */
+     std::unique_lock<LLLock>  Hold = ListWriteLock();            // LL_OPTION_THREADSAFE - exclusive
+
      InitStatus(  LL_FILELINE, LL_pTOP );
 
+    if (pListUnroll != NULL)
+    {
+        pListUnroll->UnrollFirst(&UnrollCursor);
+        UnrollPoint();
+        return  true;
+    }
+
+    if (pListDense != NULL)
+    {
+        DenseCurrent = pListDense->DenseFirst();
+        DensePoint();
+        return  true;
+    }
+
 /*
  *-----------------------------------------------------------------
  * 1) Current pointer to top
@@ -820,8 +3063,24 @@ bool LLMgr::ListPointBottom(void)
  * Indicate the last command to be executed for dubugging
  *----------------------------------------------------------------
 */
+     std::unique_lock<LLLock>  Hold = ListWriteLock();            // LL_OPTION_THREADSAFE - exclusive
+
      InitStatus(  LL_FILELINE, LL_pBOTTOM );
 
+    if (pListUnroll != NULL)
+    {
+        pListUnroll->UnrollLast(&UnrollCursor);
+        UnrollPoint();
+        return  true;
+    }
+
+    if (pListDense != NULL)
+    {
+        DenseCurrent = pListDense->DenseLast();
+        DensePoint();
+        return  true;
+    }
+
 /*
  *-----------------------------------------------------------------
  * 1) Current pointer to bottom
@@ -851,8 +3110,33 @@ bool LLMgr::ListPointNext(void)
  * Indicate the last command to be executed for dubugging
  *----------------------------------------------------------------
 */
+     std::unique_lock<LLLock>  Hold = ListWriteLock();            // LL_OPTION_THREADSAFE - exclusive
+
      InitStatus(  LL_FILELINE, LL_pNEXT );
 
+    if (pListUnroll != NULL)
+    {
+        if (UnrollCursor.pNode == NULL || pListUnroll->UnrollNext(&UnrollCursor) == false)
+        {
+            SetStatusFail(  LL_FILELINE, LL_STATUS_LISTEND, LL_pNEXT  );
+            return  false;
+        }
+        UnrollPoint();
+        return  true;
+    }
+
+    if (pListDense != NULL)
+    {
+        if (DenseCurrent == LL_DENSE_NONE || pListDense->DenseNext(DenseCurrent) == LL_DENSE_NONE)
+        {
+            SetStatusFail(  LL_FILELINE, LL_STATUS_LISTEND, LL_pNEXT  );
+            return  false;
+        }
+        DenseCurrent = pListDense->DenseNext(DenseCurrent);
+        DensePoint();
+        return  true;
+    }
+
 /*
  *------------------------------------------------------------------
  * Mask the forward and backward pointers on the current entry
@@ -895,8 +3179,33 @@ bool LLMgr::ListPointLast(void)
  * Indicate the last command to be executed for dubugging
  *----------------------------------------------------------------
 */
+     std::unique_lock<LLLock>  Hold = ListWriteLock();            // LL_OPTION_THREADSAFE - exclusive
+
      InitStatus(  LL_FILELINE, LL_pLAST );
 
+    if (pListUnroll != NULL)
+    {
+        if (UnrollCursor.pNode == NULL || pListUnroll->UnrollPrev(&UnrollCursor) == false)
+        {
+             SetStatusFail(  LL_FILELINE, LL_STATUS_LISTEND, LL_pLAST );
+            return  false;
+        }
+        UnrollPoint();
+        return  true;
+    }
+
+    if (pListDense != NULL)
+    {
+        if (DenseCurrent == LL_DENSE_NONE || pListDense->DensePrev(DenseCurrent) == LL_DENSE_NONE)
+        {
+             SetStatusFail(  LL_FILELINE, LL_STATUS_LISTEND, LL_pLAST );
+            return  false;
+        }
+        DenseCurrent = pListDense->DensePrev(DenseCurrent);
+        DensePoint();
+        return  true;
+    }
+
 /*
  *------------------------------------------------------------------
  * Mask the forward and backward pointers on the current entry
@@ -922,70 +3231,28 @@ bool LLMgr::ListPointLast(void)
 */
     pUserCurrentElement = (char *)pListCurrent + sizeof( ListPointers_t);
 
-    return  true;
-}
-
-/*
-    SetStatusFail
-     - File name - from __FILE__, __LINE__
-     - Line number of the calling routine
-     - Enumerated status code from a function that calls the method
-     - The requested command being executed
-
-     All fields are added to the control status control block and can be retrived
-            with GetStatus()
-     The routine will fill in the message body for the status array.
-*/
-
-bool  LLMgr::SetStatusFail(const char file[], long line, long status, long command)
- {
-     Status.ReturnCode  =   false;
-     Status.Command     =   0;
-     Status.LineNo      =   line;
-     Status.FileName    =   file;
-     Status.Smessage    =   "NOT SET";
-     Status.Scommand    =   "NotSet";
-
- //
- //  Strip the directory from the file - It will need to change for linux system
- //
-    size_t lastSlashPos = Status.FileName.find_last_of("/\\");
-
-    std::string fileName = (lastSlashPos == std::string::npos) ? Status.FileName : Status.FileName.substr(lastSlashPos + 1);
-//
-// Set the status block file name and command
-//
-    Status.FileName = fileName;
-    Status.Command = command;
-//
-// Locate the command in the table and load to status block
-//      Need to determine the number of rows int the array
-//
-    Status.Scommand.clear();
-    int ArrayRows = sizeof(LL_CommandArray) / sizeof(LL_CommandArray[0]);
-
-    for (int i = 0; i< ArrayRows; ++i)
-     {
-       if (LL_CommandArray[i].CommandValue == Status.Command)
-       {
-           Status.Scommand = LL_CommandArray[i].CommandName;
-            break;
-       }
-     }
-//
-// Find the status message in the table and load to status block
-//
-     ArrayRows = sizeof(LL_StatusArray) / sizeof(LL_StatusArray[0]);
+    return  true;
+}
 
-     for (int i = 0; i < ArrayRows; ++i)
-     {
+/*
+    SetStatusFail
+     - File name - from __FILE__, __LINE__
+     - Line number of the calling routine
+     - Enumerated status code from a function that calls the method
+     - The requested command being executed
 
-         if (LL_StatusArray[i].StatusValue == status)
-           {
-               Status.Smessage = LL_StatusArray[i].StatusName;
-               break;
-           }
-     }
+     All fields are added to the control status control block and can be retrived
+            with GetStatus()
+     GetStatus() will fill in the message body from the status array.
+*/
+
+bool  LLMgr::SetStatusFail(const char file[], long line, long status, long command)
+ {
+     Status.ReturnCode  =   false;
+     Status.Command     =   command;
+     Status.StatusValue =   status;
+     Status.LineNo      =   line;
+     Status.pFileName   =   file;
 
       return true;
 
@@ -993,53 +3260,111 @@ bool  LLMgr::SetStatusFail(const char file[], long line, long status, long comma
 /*
 *
 * InitStatus() clears the status control block and sets it to True values and the last command passed.
+*       It is called by every method so it only stores numbers and the file name pointer.
 *
 */
 bool  LLMgr::InitStatus(const char file[], long line, long command)
  {
-     // add code here
+     Status.ReturnCode  =  true;              // Assume nothing goes wrong
      Status.Command     =  command;           // Command that requested
+     Status.StatusValue =  -1;                // No status until a failure
      Status.LineNo      =  line;              // Source code line where the call was made
-     Status.FileName    =  file;              // Source code file name
-     Status.Scommand    =  " NOT SET ";       // String representation of command - changed below   
-     Status.ReturnCode   =   true;            // Assume nothing goes wrong
-     Status.Smessage     = "** TRUE - NO MESSSAGE PROVIDED **";  // When true - default message
+     Status.pFileName   =  file;              // Source code file name
 
- //
- //  This will strip the directory from the file - It will need to change for linux system
- //
-    size_t lastSlashPos = Status.FileName.find_last_of("/\\");
+     return true;
+ }
+
+/*
+*   ReadInit() and ReadFail() are the status calls of the methods that only take the list lock
+*       shared.  On a thread-safe list several of them run at once, so they leave the status
+*       block alone and the return value is the status.
+*/
+void LLMgr::ReadInit(const char file[], long line, long command)
+{
+    if (pListLock == NULL)
+    {
+        InitStatus(file, line, command);
+    }
+}
 
-    std::string fileName = (lastSlashPos == std::string::npos) ? Status.FileName : Status.FileName.substr(lastSlashPos + 1);
+void LLMgr::ReadFail(const char file[], long line, long status, long command)
+{
+    if (pListLock == NULL)
+    {
+        SetStatusFail(file, line, status, command);
+    }
+}
+
+/*
+*   ElementRandom() builds the validation number stored in a new element.
+*       The low 32 bits are random and the high 32 bits are the list epoch.
+*       The generator is the list's own, so adds on lists in different
+*       threads do not meet on a lock.
+*/
+time_t LLMgr::ElementRandom(void)
+{
+    return (time_t)(((uint64_t) ListEpoch << 32) | (uint32_t) SplitMix64(&ListRandomState));
+}
 
-    Status.FileName = fileName;         // Set status block file name
+/*
+*   Returns the status block
+*       The strings are built here from the codes saved by InitStatus() and SetStatusFail()
+*/
 
+StatusBlock_t LLMgr::GetStatus()
+{
+    std::shared_lock<LLLock>  Hold = ListReadLock();           // LL_OPTION_THREADSAFE - shared
+    StatusBlock_t  Block;
+
+    Block.ReturnCode = Status.ReturnCode;
+    Block.Command    = Status.Command;
+    Block.LineNo     = Status.LineNo;
+    Block.FileName   = Status.pFileName;
+    Block.Slistname  = StatusListName;
+ //
+ //  Strip the directory from the file - It will need to change for linux system
+ //
+    size_t lastSlashPos = Block.FileName.find_last_of("/\\");
 
-// Search the table for the character representation of the command and load status block set uo file and line
+    if (lastSlashPos != std::string::npos)
+    {
+        Block.FileName = Block.FileName.substr(lastSlashPos + 1);
+    }
+//
+// Search the table for the character representation of the command
 //
-    Status.Scommand.clear();
     int ArrayRows = sizeof(LL_CommandArray) / sizeof(LL_CommandArray[0]);
 
     for (int i = 0; i< ArrayRows; ++i)
      {
        if (LL_CommandArray[i].CommandValue == Status.Command)
        {
-           Status.Scommand = LL_CommandArray[i].CommandName;
-        break;
+           Block.Scommand = LL_CommandArray[i].CommandName;
+           break;
        }
      }
+//
+// Find the status message in the table - a good return has the default message
+//
+    if (Status.ReturnCode == true)
+    {
+        Block.Smessage = "** TRUE - NO MESSSAGE PROVIDED **";
+        return Block;
+    }
 
-     return true;
- }
-
-/*
-*   Returns the status block
-*/
+    Block.Smessage = "NOT SET";
+    ArrayRows = sizeof(LL_StatusArray) / sizeof(LL_StatusArray[0]);
 
-StatusBlock_t LLMgr::GetStatus()
-{
-    return Status;
+    for (int i = 0; i < ArrayRows; ++i)
+     {
+         if (LL_StatusArray[i].StatusValue == Status.StatusValue)
+           {
+               Block.Smessage = LL_StatusArray[i].StatusName;
+               break;
+           }
+     }
 
+    return Block;
 }
 //
 //      GetDirectToken() will load the current element address, random number (generated at element malloc()) and insert the
@@ -1047,7 +3372,13 @@ StatusBlock_t LLMgr::GetStatus()
 //
 DirectToken_t LLMgr::GetDirectToken()
 {
+    DirectToken_t ReturnToken;                          // Return From GetDirectToken() - Used in SetDirectPointer() 
+
+    std::unique_lock<LLLock>  Hold = ListWriteLock();            // LL_OPTION_THREADSAFE - exclusive
+
     InitStatus(LL_FILELINE, LL_GETDIRECTTOKEN);
+    ReturnToken.Address = NULL;
+    ReturnToken.RNumber = 0;
     ReturnToken.Magic = 0;
 
 //
@@ -1059,8 +3390,34 @@ DirectToken_t LLMgr::GetDirectToken()
             return ReturnToken;
          }
  
-    ReturnToken.RNumber = ((ListPointers_t *) pListCurrent)->Random;    // Random Number from the  current element in the list
-    ReturnToken.Address = ((ListPointers_t *) pListCurrent)->Address;   // Stored direct address
+    if (pListUnroll != NULL)                                            // The node and the tag of the record
+    {
+        ReturnToken.RNumber = (time_t) pListUnroll->UnrollTag(&UnrollCursor);
+        ReturnToken.Address = UnrollCursor.pNode;
+        ReturnToken.Magic   = 1955;
+        return ReturnToken;
+    }
+
+    if (pListDense != NULL && DenseCurrent == LL_DENSE_NONE)            // Elements, but none is current
+    {
+        SetStatusFail(LL_FILELINE, LL_STATUS_LISTEND, LL_GETDIRECTTOKEN);
+        return ReturnToken;
+    }
+
+    if (pListDense != NULL)                                             // The index + 1 and the epoch with the element number
+    {
+        ReturnToken.RNumber = (time_t)(((uint64_t) ListEpoch << 32) | pListDense->DenseRandom(DenseCurrent));
+        ReturnToken.Address = (void *)((uintptr_t) DenseCurrent + 1);
+        ReturnToken.Magic   = 1955;
+        return ReturnToken;
+    }
+
+    uint64_t  Random = (uint64_t)((ListPointers_t *) pListCurrent)->Random;   // Epoch and handle slot of the current element
+    uint32_t  Slot   = (uint32_t) Random;
+
+    ReturnToken.RNumber = (time_t)((Random & 0xFFFFFFFF00000000ULL)             // The epoch and the slot generation
+                                   | HandleOf((uint32_t)(Random >> 32))->HandleGeneration(Slot));
+    ReturnToken.Address = (void *)((uintptr_t) Slot + 1);                        // Slot + 1 so a NULL token never matches
     ReturnToken.Magic = 1955;                                           // Validation so we prevent a memory crash on the SetDirectPointer
     
     return ReturnToken;                // Return the address of the token
@@ -1071,8 +3428,9 @@ DirectToken_t LLMgr::GetDirectToken()
 *       A GetDirectToken() shouuld have been done to get a valid token.
 *       Magic is check to be sure there was GetDirectToken() then the address and random number are
 *         checked before setting the pointer.
-*   NOTE! If a valid token was obtained and then the element was deleted, this condition 
-*           cannot be detected. You will have a memory reference crash.
+*   On a classic list the epoch picks the handle table and the slot must still have the generation
+*         in the token.  Only the table is read, so a token for a deleted element - or any made up
+*         token - fails with LL_STATUS_INVALIDADDRESS and no element memory is touched.
 *------------------------------------------------------------------------------------------------------
 */
 bool  LLMgr::SetDirectPointer(DirectToken_t token) 
@@ -1082,6 +3440,8 @@ bool  LLMgr::SetDirectPointer(DirectToken_t token)
   * Indicate the last command to be executed for dubugging
   *----------------------------------------------------------------
  */
+    std::unique_lock<LLLock>  Hold = ListWriteLock();            // LL_OPTION_THREADSAFE - exclusive
+
     InitStatus(LL_FILELINE, LL_SETDIRECTPOINTER);
 
 // Now validate the token came from a get operation
@@ -1092,10 +3452,38 @@ bool  LLMgr::SetDirectPointer(DirectToken_t token)
         return false;
       }
 
-      void *pPassedElement = nullptr;                // Need a pointer to the element
-      pPassedElement = token.Address;                // Get the address in the passsed in TOKEN
-       
-     if (token.Address == ((ListPointers_t *) pPassedElement)->Address && token.RNumber == ((ListPointers_t*)pPassedElement)->Random)
+    if (pListUnroll != NULL)
+      {
+        if (EpochValid((uint32_t)(token.RNumber >> 32)) == false
+            || pListUnroll->UnrollLocate(token.Address, (uint64_t) token.RNumber, &UnrollCursor) == false)
+          {
+            SetStatusFail(LL_FILELINE, LL_STATUS_INVALIDADDRESS, LL_SETDIRECTPOINTER);
+            return false;
+          }
+        UnrollPoint();
+        return true;
+      }
+
+    if (pListDense != NULL)                         // Nothing is read unless the index is in the arrays
+      {
+        uintptr_t  Index = (uintptr_t) token.Address - 1;
+
+        if (EpochValid((uint32_t)(token.RNumber >> 32)) == false || Index >= LL_DENSE_NONE
+            || pListDense->DenseValid((uint32_t) Index, (uint32_t) token.RNumber) == false)
+          {
+            SetStatusFail(LL_FILELINE, LL_STATUS_INVALIDADDRESS, LL_SETDIRECTPOINTER);
+            return false;
+          }
+        DenseCurrent = (uint32_t) Index;
+        DensePoint();
+        return true;
+      }
+
+      void     *pPassedElement = nullptr;           // Need a pointer to the element
+      LLHandle *pHandle = HandleOf((uint32_t)(token.RNumber >> 32));    // NULL from before the last ListDeleteAll()
+
+     if (pHandle != NULL && token.Address != NULL
+         && (pPassedElement = pHandle->HandleLookup((uintptr_t) token.Address - 1, (uint32_t) token.RNumber, this)) != NULL)
         {                                                       
          pUserCurrentElement = (char*)pPassedElement + sizeof(ListPointers_t);
          pListCurrent = pPassedElement;         // Pointer set to element in the TOKEN
@@ -1110,3 +3498,356 @@ return true;
 }
 
  
+
+/*
+ *--------------------------------------------------------------------
+ *  Wire tokens.  The low 32 bits are the handle slot (classic) or the
+ *    index (dense) + 1, the high 32 bits the slot generation or the
+ *    element number xor a mix of the epoch.  The mix spreads the epoch
+ *    over every check bit so a token from before a ListDeleteAll() or
+ *    from another list fails the compare.  There is no epoch field, a
+ *    classic token is tried against this list's table first and then
+ *    the tables that came in with splices.
+ *--------------------------------------------------------------------
+*/
+
+static inline uint32_t EpochMix(uint32_t Epoch)
+{
+    return Epoch * 0x9E3779B1u;                     // Golden ratio multiply - every epoch bit reaches the high bits
+}
+
+/*
+ *  WireRecord - the user data area of the element a token names or NULL.
+ *    Only the handle table or the dense arrays are read.  A 0 token has
+ *    slot 0xFFFFFFFF... after the - 1 and is out of range of any table.
+ */
+void *LLMgr::WireRecord(uint64_t Token)
+{
+    uintptr_t  Slot  = (uintptr_t)(uint32_t) Token - 1;
+    uint32_t   Check = (uint32_t)(Token >> 32);
+    void      *pElement;
+
+    if (pListDense != NULL)
+    {
+        return (Slot < LL_DENSE_NONE && pListDense->DenseValid((uint32_t) Slot, Check ^ EpochMix(ListEpoch)))
+               ? pListDense->DenseRecord((uint32_t) Slot) : NULL;
+    }
+
+    pElement = pListHandle->HandleLookup(Slot, Check ^ EpochMix(pListHandle->Epoch), this);
+    for (size_t i = 0; pElement == NULL && i < ListAdoptedHandles.size(); ++i)
+    {
+        pElement = ListAdoptedHandles[i]->HandleLookup(Slot, Check ^ EpochMix(ListAdoptedHandles[i]->Epoch), this);
+    }
+    return (pElement != NULL) ? (char *) pElement + sizeof(ListPointers_t) : NULL;
+}
+
+/*
+ *  GetWireToken - 64 bit token for the current element, 0 on failure.
+ *    Unrolled records are found by node address, which does not fit, so
+ *    an unrolled list fails with LL_STATUS_NOINDEX.
+ */
+uint64_t LLMgr::GetWireToken(void)
+{
+    std::unique_lock<LLLock>  Hold = ListWriteLock();            // LL_OPTION_THREADSAFE - exclusive
+
+    InitStatus(LL_FILELINE, LL_GETWIRETOKEN);
+
+    if (ListRegistered == false)
+    {
+        SetStatusFail(LL_FILELINE, LL_STATUS_NOTREGISTERED, LL_GETWIRETOKEN);
+        return 0;
+    }
+
+    if (pListUnroll != NULL)
+    {
+        SetStatusFail(LL_FILELINE, LL_STATUS_NOINDEX, LL_GETWIRETOKEN);
+        return 0;
+    }
+
+    if (ListElementCount == 0)
+    {
+        SetStatusFail(LL_FILELINE, LL_STATUS_LISTEMPTY, LL_GETWIRETOKEN);
+        return 0;
+    }
+
+    if (pListDense != NULL && DenseCurrent == LL_DENSE_NONE)
+    {
+        SetStatusFail(LL_FILELINE, LL_STATUS_LISTEND, LL_GETWIRETOKEN);
+        return 0;
+    }
+
+    if (pListDense != NULL)
+    {
+        return ((uint64_t)(pListDense->DenseRandom(DenseCurrent) ^ EpochMix(ListEpoch)) << 32)
+               | ((uint64_t) DenseCurrent + 1);
+    }
+
+    uint64_t  Random  = (uint64_t)((ListPointers_t *) pListCurrent)->Random;   // Epoch and handle slot of the current element
+    uint32_t  Slot    = (uint32_t) Random;
+    uint32_t  Epoch   = (uint32_t)(Random >> 32);
+
+    return ((uint64_t)(HandleOf(Epoch)->HandleGeneration(Slot) ^ EpochMix(Epoch)) << 32) | ((uint64_t) Slot + 1);
+}
+
+/*
+ *  SetWirePointer - make the element of a wire token current.  A stale
+ *    or made up token fails with LL_STATUS_INVALIDADDRESS and the current
+ *    element does not move.
+ */
+bool LLMgr::SetWirePointer(uint64_t Token)
+{
+    void     *pRecord;
+
+    std::unique_lock<LLLock>  Hold = ListWriteLock();            // LL_OPTION_THREADSAFE - exclusive
+
+    InitStatus(LL_FILELINE, LL_SETWIREPOINTER);
+
+    if (ListRegistered == false)
+    {
+        SetStatusFail(LL_FILELINE, LL_STATUS_NOTREGISTERED, LL_SETWIREPOINTER);
+        return false;
+    }
+
+    if (pListUnroll != NULL)
+    {
+        SetStatusFail(LL_FILELINE, LL_STATUS_NOINDEX, LL_SETWIREPOINTER);
+        return false;
+    }
+
+    if ((pRecord = WireRecord(Token)) == NULL)
+    {
+        SetStatusFail(LL_FILELINE, LL_STATUS_INVALIDADDRESS, LL_SETWIREPOINTER);
+        return false;
+    }
+
+    if (pListDense != NULL)
+    {
+        DenseCurrent = (uint32_t) Token - 1;
+        DensePoint();
+        return true;
+    }
+
+    pUserCurrentElement = pRecord;
+    pListCurrent        = (char *) pRecord - sizeof(ListPointers_t);
+    return true;
+}
+
+/*
+ *  ResolveTokens - pOut[i] is the user data area of the element of
+ *    pTokens[i], NULL for a token that fails.  Returns how many resolved
+ *    or -1 if the call itself fails.  The current element does not move
+ *    and a thread-safe list is only locked shared.
+ *
+ *    The first pass starts the cache misses on the handle slots of every
+ *    token, the second checks them and starts the misses on the elements,
+ *    so a batch of tokens into a big list waits on memory about twice
+ *    instead of twice a token.  Bad tokens are not counted with a branch.
+ */
+long LLMgr::ResolveTokens(const uint64_t *pTokens, long Count, void **pOut)
+{
+    std::shared_lock<LLLock>  Hold = ListReadLock();           // LL_OPTION_THREADSAFE - shared
+    long      Resolved = 0;
+
+    ReadInit(LL_FILELINE, LL_RESOLVETOKENS);
+
+    if (ListRegistered == false)
+    {
+        ReadFail(LL_FILELINE, LL_STATUS_NOTREGISTERED, LL_RESOLVETOKENS);
+        return -1;
+    }
+
+    if (pListUnroll != NULL)
+    {
+        ReadFail(LL_FILELINE, LL_STATUS_NOINDEX, LL_RESOLVETOKENS);
+        return -1;
+    }
+
+    if (Count < 0 || (Count > 0 && (pTokens == NULL || pOut == NULL)))
+    {
+        ReadFail(LL_FILELINE, LL_STATUS_INVALIDPARM, LL_RESOLVETOKENS);
+        return -1;
+    }
+
+    if (pListHandle != NULL)
+    {
+        for (long i = 0; i < Count; ++i)
+        {
+            pListHandle->HandlePrefetch((uintptr_t)(uint32_t) pTokens[i] - 1);
+        }
+    }
+
+    for (long i = 0; i < Count; ++i)
+    {
+        pOut[i] = WireRecord(pTokens[i]);
+        LL_PREFETCH(pOut[i]);
+        Resolved += (pOut[i] != NULL);
+    }
+    return Resolved;
+}
+
+/*
+ *  EncodeToken / DecodeToken - a token as 8 bytes, most significant
+ *    first, whatever the byte order of the machine.
+ */
+void LLMgr::EncodeToken(uint64_t Token, unsigned char *pWire)
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        pWire[i] = (unsigned char)(Token >> (56 - 8 * i));
+    }
+}
+
+uint64_t LLMgr::DecodeToken(const unsigned char *pWire)
+{
+    uint64_t  Token = 0;
+
+    for (int i = 0; i < 8; ++i)
+    {
+        Token = (Token << 8) | pWire[i];
+    }
+    return Token;
+}
+
+/*
+ *--------------------------------------------------------------------
+ *  ListPost - producer add for LL_OPTION_MPSC.  Any number of threads
+ *    call it at once.  The record is copied into the inbox with one
+ *    exchange on the tail, no lock is taken and nothing else in the
+ *    list is read or written, the status block included.  false if the
+ *    list has no inbox or the node could not be allocated.
+ *--------------------------------------------------------------------
+*/
+bool LLMgr::ListPost(const void *pRecord)
+{
+    return pListQueue != NULL && pRecord != NULL && pListQueue->QueuePush(pRecord);
+}
+
+/*
+ *--------------------------------------------------------------------
+ *  ListTake - the consumer copies the oldest inbox record to pRecord
+ *    (ListUserElementLength bytes) and the node is freed.  It does not
+ *    wait: LL_STATUS_LISTEMPTY when nothing is ready, which includes a
+ *    record a producer is part way through posting.  On a thread-safe
+ *    list it takes the list lock, so more than one thread can take.
+ *--------------------------------------------------------------------
+*/
+bool LLMgr::ListTake(void *pRecord)
+{
+    std::unique_lock<LLLock>  Hold = ListWriteLock();            // LL_OPTION_THREADSAFE - one consumer at a time
+
+    InitStatus(LL_FILELINE, LL_TAKE);
+
+    if (ListRegistered == false)
+    {
+        SetStatusFail(LL_FILELINE, LL_STATUS_NOTREGISTERED, LL_TAKE);
+        return false;
+    }
+
+    if (pListQueue == NULL || pRecord == NULL)
+    {
+        SetStatusFail(LL_FILELINE, (pListQueue == NULL) ? LL_STATUS_NOINDEX : LL_STATUS_INVALIDPARM, LL_TAKE);
+        return false;
+    }
+
+    if (pListQueue->QueuePop(pRecord) == false)
+    {
+        SetStatusFail(LL_FILELINE, LL_STATUS_LISTEMPTY, LL_TAKE);
+        return false;
+    }
+    return true;
+}
+
+/*
+ *--------------------------------------------------------------------
+ *  ParallelChunks - cut the list into chunks for the pool, cheapest
+ *    source first.  A classic list whose handle table is its own and
+ *    holds only its own elements, or a dense list, is cut into ranges
+ *    of slots or indexes with no walk at all.  Otherwise the chunks are
+ *    runs in list order: the position index finds each start and an
+ *    unrolled list walks its nodes.  The task count comes back - the
+ *    chunk count, or a task a pool thread when the list is left for
+ *    ParallelClaim().  Called with the list lock held.
+ *--------------------------------------------------------------------
+*/
+long LLMgr::ParallelChunks(std::vector<ListChunk_t> &Chunks, LLPool &Pool)
+{
+    ListChunk_t     Chunk;
+    UnrollCursor_t  Node;
+    uint32_t        Used;
+    bool            More;
+
+    Chunk.Start = end();
+    Chunk.Count = 0;
+    Chunk.First = 0;
+    Chunk.End   = 0;
+
+    if (pListDense != NULL
+        || (pListHandle != NULL && pListHandle->RefCount == 1 && ListAdoptedHandles.empty() == true))
+    {
+        Used = (pListDense != NULL) ? pListDense->DenseUsed() : pListHandle->HandleUsed();
+
+        for (uint32_t i = 0; i < Used; i += LL_PARALLEL_CHUNK)
+        {
+            Chunk.First = i;
+            Chunk.End   = (Used - i > LL_PARALLEL_CHUNK) ? i + LL_PARALLEL_CHUNK : Used;
+            Chunks.push_back(Chunk);
+        }
+        return (long) Chunks.size();
+    }
+
+    if (pListRank != NULL)
+    {
+        size_t  Count = pListRank->RankCount();
+
+        for (size_t i = 0; i < Count; i += LL_PARALLEL_CHUNK)
+        {
+            Chunk.Start.pElement = (char *) pListRank->RankAt(i) - RankOffset;
+            Chunk.Count          = (long) ((Count - i > LL_PARALLEL_CHUNK) ? LL_PARALLEL_CHUNK : Count - i);
+            Chunks.push_back(Chunk);
+        }
+        return (long) Chunks.size();
+    }
+
+    if (pListUnroll != NULL)
+    {
+        More = pListUnroll->UnrollFirst(&Node);
+        while (More == true)
+        {
+            Chunk.Start.Unroll = Node;
+            Chunk.Count        = 0;
+            do
+            {
+                Chunk.Count += Node.pNode->Count;
+                More         = pListUnroll->UnrollNextNode(&Node);
+            } while (More == true && Chunk.Count < LL_PARALLEL_CHUNK);
+            Chunks.push_back(Chunk);
+        }
+        return (long) Chunks.size();
+    }
+
+    return (ListElementCount > 0) ? Pool.PoolThreads() : 0;
+}
+
+/*
+ *--------------------------------------------------------------------
+ *  ParallelClaim - the next LL_PARALLEL_CHUNK records off a cursor the
+ *    pool threads share.  Only the link walk is under the mutex, the
+ *    thread then goes over the run it took on its own.
+ *--------------------------------------------------------------------
+*/
+bool LLMgr::ParallelClaim(LLCursor *pAt, std::mutex *pClaim, ListChunk_t *pRun)
+{
+    std::lock_guard<std::mutex>  Hold(*pClaim);
+
+    if (pAt->pElement == NULL)
+    {
+        return false;
+    }
+
+    pRun->Start = *pAt;
+    for (pRun->Count = 0; pRun->Count < LL_PARALLEL_CHUNK && pAt->pElement != NULL; ++pRun->Count)
+    {
+        pAt->pElement = ((ListPointers_t *) pAt->pElement)->pFwd;
+    }
+    return true;
+}
@@ -14,6 +14,43 @@
  * 03/24/1996    EGC        Added direct memory addressing.
  * 08/09/2025    GMG        Split command and status table  clean up definitions for 64 bit addresses, 
  *                           elminated commands and updated direct addressing
+ * 10/17/2026    GMG        Elements are carved from a per list slab (LLSlab.h) instead of malloc(),
+ *                           added ListReserve()
+ * 10/17/2026    GMG        ListDeleteAll() releases the slab in one step, the list epoch in the
+ *                           element Random number rejects tokens from before the delete
+ * 10/17/2026    GMG        Status is kept as codes (StatusCode_t) and the StatusBlock_t strings
+ *                           are built by GetStatus()
+ * 10/17/2026    GMG        Status, list name and total element length are per list, no more file globals
+ * 10/17/2026    GMG        Added ListAddEndBatch()
+ * 10/17/2026    GMG        Added ListSpliceCurrent(), ListSpliceToBottom() and ListSpliceAll() to move
+ *                           elements between lists without copying them
+ * 10/17/2026    GMG        Added ListSort() - stable merge sort that relinks the elements
+ * 10/17/2026    GMG        Optional hash index on a key (LLHash.h) declared at registration, added ListFind()
+ * 10/17/2026    GMG        Optional ordered index (LLTree.h) with ListOrderIndex(), ListSeek() and ListSeekNext()
+ * 10/17/2026    GMG        Registration options, LL_OPTION_POSITION keeps a position index (LLRank.h) for
+ *                           ListPointIndex() and ListCurrentIndex()
+ * 10/17/2026    GMG        LL_OPTION_UNROLLED packs the records of a list into page sized nodes (LLUnroll.h)
+ * 10/17/2026    GMG        LL_OPTION_DENSE keeps the links apart from the records in a dense array (LLDense.h)
+ * 10/17/2026    GMG        Include guard so LLList.h and the users of LLMgr can both include it
+ * 10/17/2026    GMG        LLCursor - walks a list apart from the current element, begin()/end() for
+ *                           range-for and <algorithm>, added ListPointCursor()
+ * 10/17/2026    GMG        Classic tokens are a slot and generation in a handle table (LLHandle.h) and
+ *                           are checked without reading the element
+ * 10/17/2026    GMG        64 bit wire tokens - GetWireToken(), SetWirePointer(), ResolveTokens(),
+ *                           EncodeToken() and DecodeToken()
+ * 10/17/2026    GMG        Element validation numbers come from a per list generator instead of rand()
+ * 10/17/2026    GMG        LL_OPTION_THREADSAFE - reader/writer list lock (LLLock.h), ListReadLock(),
+ *                           ListWriteLock() and ListFindCursor()
+ * 10/17/2026    GMG        LL_OPTION_MPSC - lock-free inbox (LLQueue.h), ListPost() and ListTake()
+ * 10/17/2026    GMG        LL_OPTION_RECLAIM - deleted elements are freed by epoch (LLReclaim.h) so
+ *                           cursors walk forward without the lock, ListReadSection()
+ * 10/17/2026    GMG        HashBytes() is public for the shard choice of LLShard.h
+ * 10/17/2026    GMG        ParallelForEach() and ParallelReduce() - chunks of the list run on a
+ *                           work-stealing pool (LLPool.h)
+ * 10/17/2026    GMG        Persistent lists - ListRegister() with a file path maps a dense list from
+ *                           a file (LLPersist.h) that opens again as it was, added ListSync()
+ * 10/17/2026    GMG        LL_OPTION_SHARED - a persistent list in POSIX shared memory that several
+ *                           processes use at once, under a robust process-shared mutex
  *
  * PURPOSE
  *    This file contains the header files required for the Linked list manager class
@@ -22,10 +59,31 @@
  *.
  *----------------------------------------------------------------------
 */
+#ifndef LLMGR_H
+#define LLMGR_H
 
 #define  LL_FILELINE  __FILE__, __LINE__        // C++ preprocessor lines and file name
 #include <cstdint>
 #include <string.h>
+#include <vector>
+#include <iterator>
+#include <utility>
+#include <mutex>
+#include "LLSlab.h"
+#include "LLHash.h"
+#include "LLTree.h"
+#include "LLRank.h"
+#include "LLUnroll.h"
+#include "LLDense.h"
+#include "LLHandle.h"
+#include "LLLock.h"
+#include "LLQueue.h"
+#include "LLReclaim.h"
+#include "LLPool.h"
+#include "LLPersist.h"
+
+#define  LL_PARALLEL_CHUNK      4096            // Records, slots or indexes in a chunk of a parallel walk
+#define  LL_PARALLEL_AHEAD      8               // Slots a chunk walk prefetches ahead
 /* 
  *----------------------------------------------------------------------
  * Defines the typedef for the status message array used for the
@@ -62,6 +120,20 @@ typedef struct {
     std::string  Scommand;            // String version of command
     std::string  Slistname;           // Name of the linked list   
 }  StatusBlock_t;   
+/*
+ *----------------------------------------------------------------------
+ * Defines the typedef for the status kept on every method call.
+ *      Only numbers and the __FILE__ pointer are stored.  GetStatus()
+ *      turns this into the StatusBlock_t strings when it is asked for.
+ *--------------------------------------------------------------------
+*/
+typedef struct {
+    bool        ReturnCode;           // Return either True of false
+    long        Command ;             // Enumerated command number
+    long        StatusValue;          // Enumerated status when ReturnCode is false
+    long        LineNo  ;             // Line in source file the item was detected
+    const char *pFileName;            // __FILE__ where the item was detected - not stripped
+}  StatusCode_t;
 /**-----------------------------------------------------------------------------------------------
  * Defines the typedef for the linked list forward, backward and direct access pointers
  * Magic is a number to assure we get the entry should the memory address not be the same.
@@ -77,7 +149,7 @@ typedef struct {
     void *pFwd;                           /// Forward memory pointer
     void *pBwd;                           /// Backward memory pointer
     void *Address;                        /// Memory address of this Linked list element on creation 
-    time_t  Random;                       ///  Random number generated when area was malloc()ed
+    time_t  Random;                       ///  List epoch in the high 32 bits, handle slot in the low 32 while in a list
 }  ListPointers_t;
 
 //
@@ -86,13 +158,23 @@ typedef struct {
 //      set to the address passed back. Then the magic,address and random number are checked before setting the pointer
 //      The Magic number is used to verify a valid GetDirectToken() was called.  
 // 
-//   !! NOTE!! - A valid GetDirectToken() stored off and then a delete of that element will cause a memory crash. 
+//   On a classic list Address is the handle slot + 1 and RNumber the list epoch and the slot generation.  The
+//      token is checked in the handle table (LLHandle.h) before any element is read, so a token kept after its
+//      element was deleted, or spliced to another list, fails with LL_STATUS_INVALIDADDRESS.  The slot records
+//      the list the element is in - a spliced element's token works on the list it went to, not the one it left.
 //
 typedef struct {
-    void    *Address;         /// Address of element returned on GetDirectToken()
+    void    *Address;         /// Element address, handle slot or index - depends on the layout
     time_t    RNumber;        /// Used to validate we got to the right element
     int       Magic;          ///  GetDirectToken() will set this to - my birth year
 } DirectToken_t;
+
+//
+// The wire token is the same check packed in 64 bits for message headers.  The low 32 bits are the handle slot
+//      (classic) or element index (dense) + 1, the high 32 bits the slot generation or element number mixed
+//      with the list epoch.  0 is never a valid token.  EncodeToken() and DecodeToken() move it to and from
+//      8 bytes in network order.  Unrolled records move between nodes and have no wire token.
+//
 /*
  *------------------------------------------------------------------------------------
  * Defines the linked list methods messages for creating and updating list elements
@@ -113,6 +195,26 @@ enum  LL
       LL_pTOP,
 	  LL_REGISTER,
       LL_DEREGISTER,
+      LL_RESERVE,
+      LL_ADDENDBATCH,
+      LL_SPLICECURRENT,
+      LL_SPLICEBOTTOM,
+      LL_SPLICEALL,
+      LL_SORT,
+      LL_FIND,
+      LL_ORDERINDEX,
+      LL_SEEK,
+      LL_SEEKNEXT,
+      LL_POINTINDEX,
+      LL_CURRENTINDEX,
+      LL_POINTCURSOR,
+      LL_GETWIRETOKEN,
+      LL_SETWIREPOINTER,
+      LL_RESOLVETOKENS,
+      LL_FINDCURSOR,
+      LL_TAKE,
+      LL_PARALLEL,
+      LL_SYNC,
 };
   /*
 The enum start at 0 so they can be used as an index into the message array
@@ -128,11 +230,201 @@ enum  LL_STATUS {
 	  LL_STATUS_NOTREGISTERED,
 	  LL_STATUS_INVALIDADDRESS,
 	  LL_STATUS_INVALIDMAGICTOKEN,
+      LL_STATUS_INVALIDTARGET,
+      LL_STATUS_INVALIDPARM,
+      LL_STATUS_NOINDEX,
+      LL_STATUS_NOTFOUND,
+      LL_STATUS_BADFILE,
 };
 
+/*
+ *----------------------------------------------------------------------
+ * Options for ListRegister(), or them together.  A list only pays for
+ *      what it asks for.
+ *
+ *   LL_OPTION_POSITION - keep the position of every element for
+ *      ListPointIndex() and ListCurrentIndex().  Each element grows by
+ *      a RankNode_t and every add and delete updates the index in
+ *      O(log n).  Elements only splice between lists with the same
+ *      setting.
+ *
+ *   LL_OPTION_UNROLLED - pack the records in list order into page
+ *      sized nodes (see LLUnroll.h) for fast walks, with an 8 byte tag
+ *      a record in place of the ListPointers_t.  The navigation, add,
+ *      delete and token methods work as before.  A record is copied in
+ *      from pUserAddBuffer on an add, and can move to another node when
+ *      a node is split or merged - a token taken before the move is
+ *      turned down with LL_STATUS_INVALIDADDRESS.  Key, ordered and
+ *      position indexes, splices and ListSort() need the classic
+ *      layout and fail on an unrolled list.
+ *
+ *   LL_OPTION_DENSE - keep the links of the list as two 32 bit indexes
+ *      an element in one array, apart from the records (see LLDense.h).
+ *      A walk only reads the links and the record it stops on, and an
+ *      element costs 12 bytes instead of a ListPointers_t.  A record
+ *      is copied in from pUserAddBuffer on an add and keeps its address
+ *      until it is deleted.  The token Address holds the element index
+ *      and the token works like a classic one.  The indexes, splices
+ *      and ListSort() fail on a dense list as on an unrolled one.
+ *
+ *   LL_OPTION_THREADSAFE - the list has a reader/writer lock (LLLock.h)
+ *      and goes with any layout.  Every method that moves the current
+ *      element or changes the list takes it exclusive, a splice takes
+ *      both lists.  ResolveTokens(), ListFindCursor() and GetStatus()
+ *      take it shared and run alongside each other.  Cursor walks hold
+ *      ListReadLock() while they go, so any number of threads walk at
+ *      once.  The current element is shared by every thread - a thread
+ *      that needs it for more than one call, say ListPointCursor() then
+ *      ListDelete(), holds ListWriteLock() across them.  The shared
+ *      readers leave the status block alone, their return value is the
+ *      status.  ListRegister() and ListDeregister() are not locked and
+ *      must run while no other thread uses the list.
+ *
+ *   LL_OPTION_MPSC - the list gets a lock-free inbox (LLQueue.h) for
+ *      many threads feeding one.  Any thread can ListPost() a record,
+ *      it is copied into the inbox without a lock or a wait on another
+ *      thread.  ListPost() is the producer ListAddEnd() - the add
+ *      buffer is one per list and cannot be filled by several threads.
+ *      It does not touch the status block and returns false if the list
+ *      has no inbox or memory ran out.  One consumer thread takes the
+ *      records oldest first with ListTake(), which never blocks and
+ *      fails with LL_STATUS_LISTEMPTY when nothing is ready.  The rest
+ *      of the list is the consumer's.  ListDeleteAll() also drops the
+ *      records not taken and ListDeregister() needs the inbox empty,
+ *      both only once the producers have stopped.
+ *
+ *   LL_OPTION_RECLAIM - cursors walk the list forward with no lock
+ *      while a writer adds and deletes.  The writers are kept to one at
+ *      a time by the list lock as with LL_OPTION_THREADSAFE.  A reader
+ *      holds ListReadSection() instead of ListReadLock() while it walks
+ *      with ++ or PointNext(); ListDelete() unlinks at once and the
+ *      element is freed (LLReclaim.h) only once every section that
+ *      could be on it has ended, so the records a reader has reached
+ *      stay readable to the end of its section.  Backward steps and
+ *      the list calls that take the lock are not for use inside a
+ *      section - a ListDeleteAll() waits for the sections to end.
+ *      Classic layout only, ListSort() and the splices fail on it.
+ *
+ *   Only one of LL_OPTION_POSITION, LL_OPTION_UNROLLED and
+ *      LL_OPTION_DENSE can be asked for.
+ *--------------------------------------------------------------------
+*/
+enum  LL_OPTION {
+      LL_OPTION_NONE     = 0x0000,
+      LL_OPTION_POSITION = 0x0001,
+      LL_OPTION_UNROLLED = 0x0002,
+      LL_OPTION_DENSE    = 0x0004,
+      LL_OPTION_THREADSAFE = 0x0008,
+      LL_OPTION_MPSC     = 0x0010,
+      LL_OPTION_RECLAIM  = 0x0020,
+      LL_OPTION_SHARED   = 0x0040,
+};
+
+/*
+ *----------------------------------------------------------------------
+ * Persistent lists.  ListRegister() with a file path and a capacity
+ *      keeps a dense list (LL_OPTION_DENSE) in that file, mapped into
+ *      memory (see LLPersist.h).  The links are element indexes, so
+ *      the list means the same wherever the file is mapped.  A file
+ *      that is not there is made for the capacity, rounded up to 1024
+ *      elements, and does not grow - an add past it fails with
+ *      LL_STATUS_ALLOCFAIL.  A file that is there is opened as it was
+ *      left, with its own capacity, and the tokens taken before still
+ *      point to their records.  It has no current element until a
+ *      ListPoint call or a token sets one - ListDelete() and the token
+ *      gets fail with LL_STATUS_LISTEND before.  LL_OPTION_THREADSAFE
+ *      and LL_OPTION_SHARED go with it.
+ *
+ *   Adds, deletes and ListDeleteAll() are logged so a process that
+ *      dies leaves the list as it was before or after the operation it
+ *      was in.  ListSync() writes the file to the disk and marks it
+ *      clean.  A file opened without the mark has its links checked,
+ *      and one that fails the check, is not a list file or is open in
+ *      another process fails the registration with LL_STATUS_BADFILE -
+ *      the caller rebuilds it.  A record changed through
+ *      pUserCurrentElement is not logged.
+ *
+ *   ListDeregister() closes the file - synced and marked clean - with
+ *      the records left in it, and so does the destructor.  Delete the
+ *      file to get rid of the list.
+ *
+ *   LL_OPTION_SHARED - the path is the name of a POSIX shared memory
+ *      object ("/name", see shm_open()) instead of a file, and any
+ *      number of processes register it at once, each with its own
+ *      LLMgr.  A registered list can also be handed down by fork().
+ *      The first process makes the segment, the rest attach to it.
+ *      Direct and wire tokens are good in every process.  The list is
+ *      thread-safe, and the lock (LLLock.h) also takes a robust mutex
+ *      in the segment, so calls from all the processes go one at a
+ *      time - ListReadLock() is exclusive here.  A process that dies
+ *      holding the mutex has its operation rolled back by the next
+ *      process to take it.  The current element is each process's
+ *      own, and another process can delete it between two calls - hold
+ *      ListWriteLock() across calls that need it to stay, as with
+ *      threads.  A deleted current element is let go on the next call,
+ *      which leaves none current (LL_STATUS_LISTEND as after a reopen),
+ *      even when another process has already added a new record in the
+ *      same place - its validation number tells them apart.  ElementCount is caught up each time the lock is taken.
+ *      The mutex is not recursive across LLMgr objects - a thread that
+ *      holds the lock of one list on a segment must not call another
+ *      list on the same segment.  ListDeregister() only unmaps it,
+ *      shm_unlink() gets rid of it.
+ *--------------------------------------------------------------------
+*/
+
+/*
+ *----------------------------------------------------------------------
+ * Compare function for ListSort().  Called with the user data areas of
+ *      two elements, returns < 0, 0 or > 0 the same as qsort().
+ *--------------------------------------------------------------------
+*/
+typedef int (*ListCompare_t)(const void *, const void *);
+
+/*
+ *----------------------------------------------------------------------
+ * Hash function for a key index registered with callbacks.  Called with
+ *      a user data area, the same hash must come back for every record
+ *      the ListCompare_t says is equal.
+ *--------------------------------------------------------------------
+*/
+typedef uint64_t (*ListHash_t)(const void *);
+
+/*
+ *----------------------------------------------------------------------
+ * Parallel walks.  ParallelForEach() calls fn(record) on every record
+ *      and ParallelReduce() returns combine(init, map(record) ...) over
+ *      every record, record being the user data area.  The list is cut
+ *      into chunks of about LL_PARALLEL_CHUNK and the chunks are run by
+ *      a work-stealing pool (LLPool.h), the calling thread with them.
+ *      The shared pool has a thread for each hardware thread, another
+ *      pool can be passed.
+ *
+ *   The chunks come without a walk where the list already has a table
+ *      of its elements: the handle slots of a classic list that holds
+ *      no spliced in elements and has none spliced out, or the indexes
+ *      of a dense list.  Those chunks go in storage order, not list
+ *      order.  A position index gives the start of every chunk in
+ *      O(log n) and an unrolled list is cut by walking its nodes.  A
+ *      classic list with a splice behind it and no position index has
+ *      nothing to cut it by - each pool thread takes the next run off
+ *      one shared cursor and reads the run again while it is still in
+ *      cache, so the walk of the links stays the serial part.
+ *
+ *   fn, map and combine run on several threads at once and in no set
+ *      order, so combine has to be associative and commutative and fn
+ *      can only change its own record.  The list must not change while
+ *      the call runs - on a thread-safe list it holds ListReadLock(),
+ *      so fn must not call the methods of the list that take the lock
+ *      exclusive.
+ *--------------------------------------------------------------------
+*/
+class  LLCursor;
+typedef struct ListChunk_s  ListChunk_t;
 
 class  LLMgr
 {
+  friend class LLCursor;
+
   protected:
 
 	void        *pListCurrent;                                      /// Current element in the list with pointers
@@ -140,8 +432,42 @@ class  LLMgr
     void        *pListBottom;                                       /// Last list element
     void        *pClassBuffer;                                      /// Used to allocate storage on an add request
     long        ListElementCount;                                   /// Number of items in the list
-   /long        ListUserElementLength;                              /// User requested length at registration
+    long        ListUserElementLength;                              /// User requested length at registration
     bool        ListRegistered;                                     /// Indicate list is registered
+    LLSlab      *pListSlab;                                         /// Element storage - every element is the same size
+    uint32_t    ListEpoch;                                          /// New one from ListDeleteAll() to retire every old token
+    uint64_t    ListRandomState;                                    /// Per list generator for ElementRandom() - no lock, no shared seed
+    std::vector<LLSlab *>  ListAdoptedSlabs;                        /// Slabs of elements spliced in from other lists
+    std::vector<LLHandle *> ListAdoptedHandles;                     /// Handle tables (epochs) of elements spliced in from other lists
+    LLHandle    *pListHandle;                                       /// Token slots of a classic list - NULL when unrolled or dense
+    HandleOwner_t *pListOwner;                                      /// Owner record the slots of this list's elements point to
+    std::vector<HandleOwner_t *> ListAdoptedOwners;                 /// Owner records of lists spliced in whole, now naming this one
+    size_t      ListTotalElementLength;                             /// Internal length of user area with pointer header
+    LLHash      *pListHash;                                         /// Key index for ListFind() - NULL when the list has none
+    long        HashKeyOffset;                                      /// Key bytes in the user data area
+    long        HashKeyLength;                                      ///   0 when the callbacks below are used
+    ListHash_t  HashFunction;                                       /// User hash and compare for a callback index
+    ListCompare_t HashCompare;
+    LLTree      *pListTree;                                         /// Ordered index for ListSeek() - NULL when the list has none
+    long        TreeKeyOffset;                                      /// Ordered key position in the user data area
+    TreeCursor_t TreeCursor;                                        /// Where the last ListSeek() / ListSeekNext() left off
+    void        *pTreeElement;                                      ///   and the element it was on
+    bool        TreeAhead;                                          /// pTreeElement was deleted - the cursor is on the one after
+    LLRank      *pListRank;                                         /// Position index - NULL without LL_OPTION_POSITION
+    size_t      RankOffset;                                         /// RankNode_t position in the element, after the user data area
+    LLUnroll    *pListUnroll;                                       /// Record storage - NULL without LL_OPTION_UNROLLED
+    UnrollCursor_t UnrollCursor;                                    /// Current record of an unrolled list
+    LLDense     *pListDense;                                        /// Links and records - NULL without LL_OPTION_DENSE
+    uint32_t    DenseCurrent;                                       /// Current element index of a dense list
+    uint32_t    DenseCurrentRandom;                                 /// Its validation number when it was made current
+    long        ListProcess;                                        /// Shared - process the generator was seeded in
+    LLPersist   *pListStore;                                        /// Mapped file of a persistent list - NULL in memory
+    LLQueue     *pListQueue;                                        /// LL_OPTION_MPSC inbox - NULL without it
+    LLReclaim   *pListReclaim;                                      /// LL_OPTION_RECLAIM deferred frees - NULL without it
+    LLLock      ListLock;                                           /// Lock storage, only used through pListLock
+    LLLock      *pListLock;                                         /// LL_OPTION_THREADSAFE lock - NULL when the list is not shared
+    StatusCode_t Status;                                            /// Reports what happened in the last method call
+    std::string StatusListName;                                     /// List name reported in the status block
 
 
 
@@ -152,6 +478,37 @@ class  LLMgr
 //                      Sourcw File Name, Line Number,  enumerated method 
      bool  SetStatusFail(const char arr[], long, long, long);       /// Set the status block to failure with reasons
 //                      Sourcw File Name, Line Number,  enumerated status, enumerated method  
+     time_t ElementRandom(void);                                    /// Validation number for a new element
+     bool  SpliceCheck(LLMgr &, long);                              /// Validate a splice target
+     bool  SpliceMove(LLMgr &, void *, void *, long);               /// Move a run of elements to the end of the target
+     void  SpliceAdopt(LLSlab *, LLHandle *);                       /// Hold a slab and a handle table from a splice
+     bool  EpochValid(uint32_t);                                    /// Token epoch belongs to this list or was spliced in
+     LLHandle *HandleOf(uint32_t);                                  /// Handle table of an epoch, NULL if not this list's
+     bool  HandleAdd(void *);                                       /// Slot for a classic element going in the list
+     void  HandleRemove(void *);                                    /// Free the slot of a classic element going out
+     void  HandleDropAll(void);                                     /// Let go of the handle tables and owner records spliced in
+     void  HandleGive(void *, LLMgr &);                             /// Point the slot of an element at the target's owner record
+     void  HandleReset(LLHandle *);                                 /// Empty handle table for a new epoch
+     void *WireRecord(uint64_t);                                    /// User data area of a wire token, NULL if it fails
+     void *FindElement(const void *);                               /// Element with a key in the key index or NULL
+     void  ReadInit(const char arr[], long, long);                  /// Status for a shared lock reader - none when thread-safe
+     void  ReadFail(const char arr[], long, long, long);
+     void  SpliceLock(LLMgr &, std::unique_lock<LLLock> &, std::unique_lock<LLLock> &);  /// Both lists exclusive in address order
+     uint64_t KeyHash(const void *);                                /// Hash of a key as passed to ListFind()
+     const void *ElementKey(void *);                                /// Key of an element in the ListFind() form
+     bool  IndexAdd(void *);                                        /// Put a new element in the indexes
+     void  IndexRemove(void *);                                     /// Take an element out of the indexes
+     bool  HasIndex(void) { return pListHash != NULL || pListTree != NULL; }
+     RankNode_t *ElementRank(void *pElement) { return (RankNode_t *)((char *) pElement + RankOffset); }
+     bool  UnrollAdd(UnrollCursor_t, bool, long);                   /// Add pUserAddBuffer to an unrolled list
+     void  UnrollPoint(void);                                       /// Current pointers from UnrollCursor
+     bool  DenseAdd(uint32_t, bool, const void *, long);            /// Add a record to a dense list
+     void  DensePoint(void);                                        /// Current pointers from DenseCurrent
+     static void ShareHook(void *, bool);                           /// LL_OPTION_SHARED - the process mutex was just taken
+     long  ParallelChunks(std::vector<ListChunk_t> &, LLPool &);    /// Cut the list up for the pool - the task count
+     bool  ParallelClaim(LLCursor *, std::mutex *, ListChunk_t *);  /// Next run off a shared cursor, false at the end
+     template <class Fn> void ChunkEach(const ListChunk_t &, Fn &); /// Call fn on every record of a chunk
+     template <class Fn> void ParallelTasks(LLPool &, std::vector<ListChunk_t> &, long, Fn &);   /// fn(task, chunk) for every chunk
 
    public:
       long          ElementCount;                                    /// Number of elements in the list
@@ -165,14 +522,453 @@ class  LLMgr
       bool          ListAddEnd(void);                                /// Adding to end of the list
       bool          ListAddBefore(void);                             /// Add Before the current element
       bool          ListAddAfter(void);                              /// Add After the current element
-      bool          ListRegister(long int, std::string );            /// Registration - User buffer size and list name
-      bool          ListDeregister(void);                            /// Deregistration - Must be empty
+      bool          ListAddEndBatch(const void *, long);             /// Add n contiguous user records to the end of the list
+      bool          ListSpliceCurrent(LLMgr &);                      /// Move the current element to the end of another list
+      bool          ListSpliceToBottom(LLMgr &);                     /// Move current through bottom to the end of another list
+      bool          ListSpliceAll(LLMgr &);                          /// Move every element to the end of another list
+      bool          ListSort(ListCompare_t);                         /// Stable sort of the list with a user compare function
+      bool          ListRegister(long int, std::string, int = LL_OPTION_NONE); /// Registration - User buffer size, list name and options
+      bool          ListRegister(long int, std::string, long, long, int = LL_OPTION_NONE); /// Registration with a key index - key offset and length
+      bool          ListRegister(long int, std::string, ListHash_t, ListCompare_t, int = LL_OPTION_NONE); /// Registration with a callback key index
+      bool          ListRegister(long int, std::string, std::string, long, int = LL_OPTION_NONE); /// Persistent - file path and capacity
+      bool          ListSync(void);                                  /// Persistent list to the disk and marked clean
+      bool          ListFind(const void *);                          /// Point to an element with the key - needs a key index
+      bool          ListOrderIndex(long, long, ListCompare_t);       /// Add an ordered index - key offset, length and compare
+      bool          ListSeek(const void *);                          /// Point to the first element with a key >= the key
+      bool          ListSeekNext(void);                              /// Point to the element after the current one in key order
+      bool          ListPointIndex(long);                            /// Point to the element at a position, 0 is the top
+      long          ListCurrentIndex(void);                          /// Position of the current element, -1 on failure
+      bool          ListDeregister(void);                            /// Deregistration - Must be empty, a persistent list is closed
       bool          ListDelete(void);                                /// Delete current entry in the list
       bool          ListDeleteAll(void);                             /// Delete all elements in the list - used to deregister
+      bool          ListReserve(long);                               /// Pre-fill storage so n adds need no allocation
       StatusBlock_t  GetStatus(void);                                /// Returns the status block with all information on last operation
       DirectToken_t GetDirectToken();                                /// Returns a token for direct pointing can be used in messages
       bool          SetDirectPointer(DirectToken_t);                 /// Uses the token to point directly without searching the list
+      bool          ListPointCursor(const LLCursor &);               /// Make the element of a cursor the current element
+      uint64_t      GetWireToken(void);                              /// 64 bit token for the current element, 0 on failure
+      bool          SetWirePointer(uint64_t);                        /// Point to the element of a 64 bit token
+      long          ResolveTokens(const uint64_t *, long, void **);  /// User data areas for n tokens, NULL for a bad one
+      std::shared_lock<LLLock> ListReadLock(void)                    /// Shared hold for cursor walks - no lock without LL_OPTION_THREADSAFE
+                    { return (pListLock != NULL) ? std::shared_lock<LLLock>(*pListLock) : std::shared_lock<LLLock>(); }
+      std::unique_lock<LLLock> ListWriteLock(void)                   /// Exclusive hold across a run of calls
+                    { return (pListLock != NULL) ? std::unique_lock<LLLock>(*pListLock) : std::unique_lock<LLLock>(); }
+      LLCursor      ListFindCursor(const void *);                    /// Cursor on an element with the key, end() if none
+      LLReadSection ListReadSection(void)                            /// Lock-free forward walks - nothing without LL_OPTION_RECLAIM
+                    { return LLReadSection(pListReclaim); }
+      bool          ListPost(const void *);                          /// Any thread - lock-free add of a record to the inbox
+      bool          ListTake(void *);                                /// Consumer - oldest inbox record into a buffer, never blocks
+      template <class Fn> bool ParallelForEach(Fn, LLPool * = NULL); /// fn(record) on every record from the pool threads
+      template <class T, class Map, class Combine>
+                    T ParallelReduce(T, Map, Combine, LLPool * = NULL); /// combine(init, map(record) ...) over every record
+      static void   EncodeToken(uint64_t, unsigned char *);          /// Token to 8 bytes in network order
+      static uint64_t HashBytes(const void *, size_t);               /// Hash of a key the key index uses - LLShard picks shards with it
+      static uint64_t DecodeToken(const unsigned char *);            /// 8 bytes in network order to a token
+      LLCursor      begin(void);                                     /// Cursor on the top element
+      LLCursor      end(void);                                       /// Cursor past the bottom element
                     LLMgr();                                         /// Constructor no parameters
                     ~LLMgr();                                        /// Destructor no parameters
 
 };
+
+/*
+ *----------------------------------------------------------------------
+ * Cursor over a list, apart from the current element of the list.  A
+ *      cursor only reads the list - it does not move pListCurrent or
+ *      touch the status block - so any number of cursors can walk a
+ *      list at once, from more than one thread as long as nothing
+ *      changes the list while they do.
+ *
+ *   PointTop() and the rest work like the list methods: false at the
+ *      end and the cursor stays where it is.  The ++ and -- operators
+ *      are the bidirectional iterator for range-for and <algorithm>.
+ *      ++ on the bottom element goes past the end and -- on the end
+ *      goes to the bottom element.  *Cursor is the user data area.
+ *
+ *   A cursor is a position like pUserCurrentElement.  Deleting its
+ *      element leaves it on freed storage, and on an unrolled list
+ *      any add or delete can slide the records under it.
+ *      ListPointCursor() makes its element the current element, to
+ *      delete it or take a token.
+ *--------------------------------------------------------------------
+*/
+class  LLCursor
+{
+  friend class LLMgr;
+
+  protected:
+    LLMgr          *pList;
+    void           *pElement;                   /// Classic element - NULL past the end
+    UnrollCursor_t  Unroll;                     /// Unrolled record - pNode NULL past the end
+    uint32_t        Index;                      /// Dense element - LL_DENSE_NONE past the end
+
+    void            SetEnd(void) { pElement = NULL; Unroll.pNode = NULL; Unroll.Pos = 0; Index = LL_DENSE_NONE; }
+
+  public:
+    typedef std::bidirectional_iterator_tag  iterator_category;
+    typedef void                            *value_type;
+    typedef ptrdiff_t                        difference_type;
+    typedef void                           **pointer;
+    typedef void                            *reference;
+
+    bool            PointTop(void);
+    bool            PointBottom(void);
+    bool            PointNext(void);
+    bool            PointLast(void);
+    bool            PointCurrent(void);                                 /// Go to the current element of the list
+    void           *Element(void) const;                                /// User data area, NULL past the end
+
+    void           *operator*() const { return Element(); }
+    LLCursor       &operator++();
+    LLCursor       &operator--();
+    LLCursor        operator++(int) { LLCursor Was = *this; ++*this; return Was; }
+    LLCursor        operator--(int) { LLCursor Was = *this; --*this; return Was; }
+    bool            operator==(const LLCursor &Other) const
+                    { return pElement == Other.pElement && Unroll.pNode == Other.Unroll.pNode
+                          && Unroll.Pos == Other.Unroll.Pos && Index == Other.Index && pList == Other.pList; }
+    bool            operator!=(const LLCursor &Other) const { return !(*this == Other); }
+
+                    LLCursor() : pList(NULL) { SetEnd(); }
+    explicit        LLCursor(LLMgr &List) : pList(&List) { SetEnd(); PointTop(); }      /// Starts on the top element
+};
+
+/*
+ *----------------------------------------------------------------------
+ * The cursor steps are inline so a walk costs what the layout costs.
+ *--------------------------------------------------------------------
+*/
+inline bool LLCursor::PointTop(void)
+{
+    if (pList->pListUnroll != NULL)
+    {
+        return pList->pListUnroll->UnrollFirst(&Unroll);
+    }
+    if (pList->pListDense != NULL)
+    {
+        return (Index = pList->pListDense->DenseFirst()) != LL_DENSE_NONE;
+    }
+    return (pElement = LL_LINKLOAD(pList->pListTop)) != NULL;
+}
+
+inline bool LLCursor::PointBottom(void)
+{
+    if (pList->pListUnroll != NULL)
+    {
+        return pList->pListUnroll->UnrollLast(&Unroll);
+    }
+    if (pList->pListDense != NULL)
+    {
+        return (Index = pList->pListDense->DenseLast()) != LL_DENSE_NONE;
+    }
+    return (pElement = pList->pListBottom) != NULL;
+}
+
+inline bool LLCursor::PointNext(void)
+{
+    if (pList->pListUnroll != NULL)
+    {
+        return Unroll.pNode != NULL && pList->pListUnroll->UnrollNext(&Unroll);
+    }
+    if (pList->pListDense != NULL)
+    {
+        if (Index == LL_DENSE_NONE || pList->pListDense->DenseNext(Index) == LL_DENSE_NONE)
+        {
+            return false;
+        }
+        Index = pList->pListDense->DenseNext(Index);
+        return true;
+    }
+    void  *pNext;
+
+    if (pElement == NULL || (pNext = LL_LINKLOAD(((ListPointers_t *) pElement)->pFwd)) == NULL)
+    {
+        return false;
+    }
+    pElement = pNext;
+    return true;
+}
+
+inline bool LLCursor::PointLast(void)
+{
+    if (pList->pListUnroll != NULL)
+    {
+        return Unroll.pNode != NULL && pList->pListUnroll->UnrollPrev(&Unroll);
+    }
+    if (pList->pListDense != NULL)
+    {
+        if (Index == LL_DENSE_NONE || pList->pListDense->DensePrev(Index) == LL_DENSE_NONE)
+        {
+            return false;
+        }
+        Index = pList->pListDense->DensePrev(Index);
+        return true;
+    }
+    if (pElement == NULL || ((ListPointers_t *) pElement)->pBwd == NULL)
+    {
+        return false;
+    }
+    pElement = ((ListPointers_t *) pElement)->pBwd;
+    return true;
+}
+
+inline bool LLCursor::PointCurrent(void)
+{
+    SetEnd();
+    if (pList->pListCurrent == NULL)
+    {
+        return false;
+    }
+    if (pList->pListUnroll != NULL)
+    {
+        Unroll = pList->UnrollCursor;
+    }
+    else if (pList->pListDense != NULL)
+    {
+        Index = pList->DenseCurrent;
+    }
+    else
+    {
+        pElement = pList->pListCurrent;
+    }
+    return true;
+}
+
+inline void *LLCursor::Element(void) const
+{
+    if (pList == NULL)
+    {
+        return NULL;
+    }
+    if (pList->pListUnroll != NULL)
+    {
+        return (Unroll.pNode != NULL) ? pList->pListUnroll->UnrollRecord((UnrollCursor_t *) &Unroll) : NULL;
+    }
+    if (pList->pListDense != NULL)
+    {
+        return (Index != LL_DENSE_NONE) ? pList->pListDense->DenseRecord(Index) : NULL;
+    }
+    return (pElement != NULL) ? (char *) pElement + sizeof(ListPointers_t) : NULL;
+}
+
+inline LLCursor &LLCursor::operator++()
+{
+    if (pList->pListUnroll != NULL)
+    {
+        if (pList->pListUnroll->UnrollNext(&Unroll) == false)
+        {
+            SetEnd();
+        }
+    }
+    else if (pList->pListDense != NULL)
+    {
+        Index = pList->pListDense->DenseNext(Index);
+    }
+    else
+    {
+        pElement = LL_LINKLOAD(((ListPointers_t *) pElement)->pFwd);
+    }
+    return *this;
+}
+
+inline LLCursor &LLCursor::operator--()
+{
+    if (Element() == NULL)
+    {
+        PointBottom();
+    }
+    else if (pList->pListUnroll != NULL)
+    {
+        if (pList->pListUnroll->UnrollPrev(&Unroll) == false)
+        {
+            SetEnd();
+        }
+    }
+    else if (pList->pListDense != NULL)
+    {
+        Index = pList->pListDense->DensePrev(Index);
+    }
+    else
+    {
+        pElement = ((ListPointers_t *) pElement)->pBwd;
+    }
+    return *this;
+}
+
+inline LLCursor LLMgr::begin(void)
+{
+    return LLCursor(*this);
+}
+
+inline LLCursor LLMgr::end(void)
+{
+    LLCursor  End;
+
+    End.pList = this;
+    return End;
+}
+
+/*
+ *----------------------------------------------------------------------
+ * One chunk of a parallel walk - Count records in list order from Start,
+ *      or when Count is 0 the handle slots (classic) or element indexes
+ *      (dense) First to End - 1, the free ones skipped.
+ *--------------------------------------------------------------------
+*/
+struct ListChunk_s {
+    LLCursor    Start;
+    long        Count;
+    uint32_t    First;
+    uint32_t    End;
+};
+
+template <class Fn> inline void LLMgr::ChunkEach(const ListChunk_t &Chunk, Fn &Each)
+{
+    if (Chunk.Count > 0)
+    {
+        LLCursor  At = Chunk.Start;
+
+        for (long i = 0; i < Chunk.Count; ++i, ++At)
+        {
+            Each(*At);
+        }
+    }
+    else if (pListDense != NULL)
+    {
+        for (uint32_t i = Chunk.First; i < Chunk.End; ++i)
+        {
+            if (pListDense->DenseLive(i) == true)
+            {
+                Each(pListDense->DenseRecord(i));
+            }
+        }
+    }
+    else
+    {
+        for (uint32_t i = Chunk.First; i < Chunk.End; ++i)
+        {
+            void  *pElement = pListHandle->HandleElement(i);
+
+            if (i + LL_PARALLEL_AHEAD < Chunk.End)
+            {
+                LL_PREFETCH(pListHandle->HandleElement(i + LL_PARALLEL_AHEAD));  // The slots are in order, the elements are not
+            }
+            if (pElement != NULL)
+            {
+                Each((char *) pElement + sizeof(ListPointers_t));
+            }
+        }
+    }
+}
+
+/*
+ *----------------------------------------------------------------------
+ * Run the tasks of a parallel walk.  With chunks a task is a chunk, with
+ *      none (ParallelChunks() found no way to cut the list) a task is a
+ *      pool thread taking runs off the shared cursor until the end.
+ *--------------------------------------------------------------------
+*/
+template <class Fn> void LLMgr::ParallelTasks(LLPool &Pool, std::vector<ListChunk_t> &Chunks, long Tasks, Fn &OnChunk)
+{
+    if (Chunks.empty() == false)
+    {
+        Pool.PoolRun(Tasks, [&](long n) { OnChunk(n, Chunks[n]); });
+        return;
+    }
+
+    std::mutex  Claim;
+    LLCursor    At = begin();
+
+    Pool.PoolRun(Tasks, [&](long n)
+    {
+        ListChunk_t  Run;
+
+        while (ParallelClaim(&At, &Claim, &Run) == true)
+        {
+            OnChunk(n, Run);
+        }
+    });
+}
+
+template <class Fn> bool LLMgr::ParallelForEach(Fn Each, LLPool *pPool)
+{
+    std::vector<ListChunk_t>  Chunks;
+    LLPool                   &Pool = (pPool != NULL) ? *pPool : LLPool::PoolDefault();
+    long                      Tasks;
+
+    std::shared_lock<LLLock>  Hold = ListReadLock();              // LL_OPTION_THREADSAFE - shared
+
+    ReadInit(  LL_FILELINE, LL_PARALLEL );
+
+    if (ListRegistered != true)
+    {
+        ReadFail(  LL_FILELINE, LL_STATUS_NOTREGISTERED, LL_PARALLEL  );
+        return  false;
+    }
+
+    auto  OnChunk = [&](long, const ListChunk_t &Chunk) { ChunkEach(Chunk, Each); };
+
+    Tasks = ParallelChunks(Chunks, Pool);
+    ParallelTasks(Pool, Chunks, Tasks, OnChunk);
+    return  true;
+}
+
+/*
+ *----------------------------------------------------------------------
+ * A task starts from the map of its first record, so init is combined
+ *      in once whatever the task count, and the task results are
+ *      combined in task order.  init comes back on an empty list or a
+ *      failure.
+ *--------------------------------------------------------------------
+*/
+template <class T, class Map, class Combine> T LLMgr::ParallelReduce(T Init, Map MapFn, Combine CombineFn, LLPool *pPool)
+{
+    std::vector<ListChunk_t>          Chunks;
+    std::vector<std::pair<T, bool>>   Partial;                    // Task result and whether the task had a record
+    LLPool                           &Pool = (pPool != NULL) ? *pPool : LLPool::PoolDefault();
+    long                              Tasks;
+
+    std::shared_lock<LLLock>  Hold = ListReadLock();              // LL_OPTION_THREADSAFE - shared
+
+    ReadInit(  LL_FILELINE, LL_PARALLEL );
+
+    if (ListRegistered != true)
+    {
+        ReadFail(  LL_FILELINE, LL_STATUS_NOTREGISTERED, LL_PARALLEL  );
+        return  Init;
+    }
+
+    auto  OnChunk = [&](long n, const ListChunk_t &Chunk)
+    {
+        std::pair<T, bool>  Sum = Partial[n];                     // Kept on the stack so tasks do not share a line
+        auto                Each = [&](void *pRecord)
+        {
+            if (Sum.second == true)
+            {
+                Sum.first = CombineFn(Sum.first, MapFn(pRecord));
+            }
+            else
+            {
+                Sum.first  = MapFn(pRecord);
+                Sum.second = true;
+            }
+        };
+
+        ChunkEach(Chunk, Each);
+        Partial[n] = Sum;
+    };
+
+    Tasks = ParallelChunks(Chunks, Pool);
+    Partial.assign(Tasks, std::make_pair(Init, false));
+    ParallelTasks(Pool, Chunks, Tasks, OnChunk);
+
+    for (std::pair<T, bool> &Sum : Partial)
+    {
+        if (Sum.second == true)
+        {
+            Init = CombineFn(Init, Sum.first);
+        }
+    }
+    return  Init;
+}
+
+#endif
@@ -0,0 +1,305 @@
+/**----------------------------------------------------------------
+ * File:LLPersist.cpp
+ *
+ * Author: Gregory Gannon
+ *
+ * PURPOSE
+ *
+ *  Mapped list file used by the Linked list manager for a persistent
+ *    dense list.  Opens or makes the file, rolls back an operation a
+ *    crash cut short and keeps the undo log the list changes go
+ *    through.  POSIX - open(), flock(), mmap() and msync().
+ *
+ * UPDATES:
+ *
+ * GMG   10-17-2026    Created for the lists that come back after a restart.
+ * GMG   10-17-2026    Shared memory segments.  shm_open() in place of open(), the first
+ *                      process makes the segment under flock() with the robust mutex in
+ *                      the header, and nothing is rolled back or synced on open and close.
+ *-------------------------------------------------------------
+*/
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <atomic>
+#include "LLPersist.h"
+
+/*
+*  The log only has to be in order against a crash of this process, and the
+*      stores of a process that dies are all in the page cache whatever order
+*      the CPU let them out in.  So the compiler is the only one that could
+*      reorder them and a signal fence, no instruction, holds it.
+*/
+#define  LL_PERSIST_ORDER()     std::atomic_signal_fence(std::memory_order_seq_cst)
+
+//--------------------------------------------------------------------
+// Constructor - nothing open
+//--------------------------------------------------------------------
+
+LLPersist::LLPersist()
+{
+    pHeader   = NULL;
+    MapLength = 0;
+    Fd        = -1;
+    WasClean  = false;
+    Shared    = false;
+}
+
+LLPersist::~LLPersist()
+{
+    PersistDrop();
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Open the list file at pPath, or make it if it is empty or
+ *    not there.  A new file is sized for Capacity elements, rounded up
+ *    to a dense chunk, and starts clean with the list empty.  The
+ *    arrays come from a sparse ftruncate() as zeros and the header is
+ *    written with Magic last, so a make cut short is never taken for a
+ *    list.  An existing file must have been made for RecordLength.  A
+ *    part done operation in its log is rolled back before it is used.
+ *
+ *    Shared opens the shared memory object pPath names instead.  The
+ *    flock() is held only while the segment is made or checked, so the
+ *    processes that open it at once wait for the one making it, then
+ *    all map it.
+ *------------------------------------------------------------------
+*/
+int LLPersist::PersistOpen(const char *pPath, size_t RecordLength, uint32_t Capacity, uint32_t Epoch, bool Share)
+{
+    struct stat  Info;
+    size_t       Stride = (RecordLength + 7) & ~(size_t) 7;
+    void        *pMap;
+    bool         Create;
+
+    if (pHeader != NULL || pPath == NULL || Stride == 0 || Capacity == 0 || Capacity > LL_PERSIST_MAXELEMENTS)
+    {
+        return LL_PERSIST_FAILED;
+    }
+
+    Shared = Share;
+    Fd     = (Shared == true) ? shm_open(pPath, O_RDWR | O_CREAT | O_CLOEXEC, 0600)
+                              : open(pPath, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (Fd < 0)
+    {
+        return LL_PERSIST_FAILED;
+    }
+    if (flock(Fd, (Shared == true) ? LOCK_EX : LOCK_EX | LOCK_NB) != 0      // A file open in another process fails
+     || fstat(Fd, &Info) != 0)
+    {
+        PersistDrop();
+        return LL_PERSIST_FAILED;
+    }
+
+    if ((Create = (Info.st_size == 0)) == true)
+    {
+        Capacity  = (Capacity + (1u << LL_DENSE_CHUNKBITS) - 1) & ~((1u << LL_DENSE_CHUNKBITS) - 1);
+        MapLength = LL_PERSIST_HEADER + (size_t) Capacity * (sizeof(DenseLink_t) + sizeof(uint32_t) + Stride);
+
+        if (ftruncate(Fd, (off_t) MapLength) != 0)
+        {
+            PersistDrop();
+            return LL_PERSIST_FAILED;
+        }
+    }
+    else if (Info.st_size < LL_PERSIST_HEADER)
+    {
+        PersistDrop();
+        return LL_PERSIST_DAMAGED;
+    }
+    else
+    {
+        MapLength = (size_t) Info.st_size;
+    }
+
+    if ((pMap = mmap(NULL, MapLength, PROT_READ | PROT_WRITE, MAP_SHARED, Fd, 0)) == MAP_FAILED)
+    {
+        PersistDrop();
+        return LL_PERSIST_FAILED;
+    }
+    pHeader = (PersistHeader_t *) pMap;
+
+    if (Create == true)
+    {
+        pHeader->Version        = LL_PERSIST_VERSION;
+        pHeader->RecordLength   = (uint32_t) RecordLength;
+        pHeader->Capacity       = Capacity;
+        pHeader->Epoch          = Epoch;
+        pHeader->LinkOffset     = LL_PERSIST_HEADER;
+        pHeader->RandomOffset   = pHeader->LinkOffset + (uint64_t) Capacity * sizeof(DenseLink_t);
+        pHeader->RecordOffset   = pHeader->RandomOffset + (uint64_t) Capacity * sizeof(uint32_t);
+        pHeader->FileLength     = MapLength;
+        pHeader->State.Used     = 0;
+        pHeader->State.FreeHead = LL_DENSE_NONE;
+        pHeader->State.Head     = LL_DENSE_NONE;
+        pHeader->State.Tail     = LL_DENSE_NONE;
+        pHeader->State.Count    = 0;
+        pHeader->Clean          = 1;
+        pHeader->UndoCount      = 0;
+        pHeader->Shared         = (Shared == true) ? 1 : 0;
+
+        if (Shared == true)
+        {
+            pthread_mutexattr_t  Attr;
+
+            pthread_mutexattr_init(&Attr);
+            pthread_mutexattr_setpshared(&Attr, PTHREAD_PROCESS_SHARED);
+            pthread_mutexattr_setrobust(&Attr, PTHREAD_MUTEX_ROBUST);  // A dead owner is reported, not waited on
+            pthread_mutex_init(&pHeader->Lock, &Attr);
+            pthread_mutexattr_destroy(&Attr);
+        }
+
+        if (msync(pHeader, LL_PERSIST_HEADER, MS_SYNC) != 0)            // Header on the disk before it is marked a list
+        {
+            PersistDrop();
+            return LL_PERSIST_FAILED;
+        }
+        pHeader->Magic = LL_PERSIST_MAGIC;
+        msync(pHeader, LL_PERSIST_HEADER, MS_SYNC);
+        WasClean = true;
+        if (Shared == true)
+        {
+            flock(Fd, LOCK_UN);
+        }
+        return LL_PERSIST_CREATED;
+    }
+
+    if (pHeader->Magic != LL_PERSIST_MAGIC || pHeader->Version != LL_PERSIST_VERSION)
+    {
+        PersistDrop();
+        return LL_PERSIST_DAMAGED;
+    }
+    if (pHeader->RecordLength != RecordLength || pHeader->Shared != ((Shared == true) ? 1u : 0u))
+    {
+        PersistDrop();
+        return LL_PERSIST_MISMATCH;
+    }
+
+    Capacity = pHeader->Capacity;                                       // The file's own, the one passed is for a new file
+    if (Capacity == 0 || Capacity > LL_PERSIST_MAXELEMENTS
+     || (Capacity & ((1u << LL_DENSE_CHUNKBITS) - 1)) != 0
+     || pHeader->LinkOffset   != LL_PERSIST_HEADER
+     || pHeader->RandomOffset != pHeader->LinkOffset + (uint64_t) Capacity * sizeof(DenseLink_t)
+     || pHeader->RecordOffset != pHeader->RandomOffset + (uint64_t) Capacity * sizeof(uint32_t)
+     || pHeader->FileLength   != pHeader->RecordOffset + (uint64_t) Capacity * Stride
+     || pHeader->FileLength   != MapLength
+     || pHeader->UndoCount > LL_PERSIST_UNDO)
+    {
+        PersistDrop();
+        return LL_PERSIST_DAMAGED;
+    }
+
+    if (Shared == true)                                                 // The log is the mutex owner's
+    {
+        WasClean = true;
+        flock(Fd, LOCK_UN);
+        return LL_PERSIST_REOPENED;
+    }
+
+    WasClean = (pHeader->Clean != 0);
+    Rollback();
+    return LL_PERSIST_REOPENED;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Put back the old values of a part done operation, last
+ *    logged first, then empty the log.  A crash in here leaves the log
+ *    as it was and the next open, or the next owner of the shared
+ *    mutex, does it again.
+ *------------------------------------------------------------------
+*/
+void LLPersist::Rollback(void)
+{
+    for (uint32_t n = pHeader->UndoCount; n > 0; --n)
+    {
+        PersistUndo_t  *pUndo = &pHeader->Undo[n - 1];
+
+        if (pUndo->Offset % sizeof(uint32_t) == 0 && pUndo->Offset < MapLength)
+        {
+            *(uint32_t *)((char *) pHeader + pUndo->Offset) = pUndo->Old;
+        }
+    }
+    LL_PERSIST_ORDER();
+    pHeader->UndoCount = 0;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Change one word of the list.  The file is marked not clean
+ *    first, then the entry is written, then the count that takes it in,
+ *    and only then the word.  A crash at any point leaves either a word
+ *    not changed or one the log can put back.
+ *------------------------------------------------------------------
+*/
+void LLPersist::PersistPut(uint32_t *pWord, uint32_t Value)
+{
+    uint32_t  n = pHeader->UndoCount;
+
+    if (pHeader->Clean != 0)
+    {
+        pHeader->Clean = 0;
+    }
+    pHeader->Undo[n].Offset = (uint64_t)((char *) pWord - (char *) pHeader);
+    pHeader->Undo[n].Old    = *pWord;
+    LL_PERSIST_ORDER();
+    pHeader->UndoCount = n + 1;
+    LL_PERSIST_ORDER();
+    *pWord = Value;
+}
+
+void LLPersist::PersistCommit(void)
+{
+    LL_PERSIST_ORDER();                                 // Every word of the operation before the end of it
+    pHeader->UndoCount = 0;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Write every dirty page, then mark the file clean and write
+ *    the header again.  Called between operations, so the log is empty.
+ *------------------------------------------------------------------
+*/
+bool LLPersist::PersistSync(void)
+{
+    if (pHeader == NULL || msync(pHeader, MapLength, MS_SYNC) != 0)
+    {
+        return false;
+    }
+    if (pHeader->Clean == 0)
+    {
+        pHeader->Clean = 1;
+        return msync(pHeader, LL_PERSIST_HEADER, MS_SYNC) == 0;
+    }
+    return true;
+}
+
+void LLPersist::PersistClose(void)
+{
+    if (pHeader != NULL && Shared == false)             // Other processes can be in a segment, it is left alone
+    {
+        PersistSync();
+    }
+    PersistDrop();
+}
+
+void LLPersist::PersistDrop(void)
+{
+    if (pHeader != NULL)
+    {
+        munmap(pHeader, MapLength);
+        pHeader = NULL;
+    }
+    if (Fd >= 0)
+    {
+        flock(Fd, LOCK_UN);
+        close(Fd);
+        Fd = -1;
+    }
+    MapLength = 0;
+}
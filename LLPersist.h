@@ -0,0 +1,150 @@
+/**--------------------------------------------------------------
+ * File: LLPersist.h
+ *
+ *  Author: Gregory Gannon
+ * Created: 10/17/2026
+ *---------------------------------------------------------------------
+ * HISTORY
+ *
+ *	 Date       Author      Change Description
+ *   ----		------		------------------
+ * 10/17/2026    GMG        Developed the mapped file for the persistent lists
+ * 10/17/2026    GMG        POSIX shared memory segments for lists shared between processes, with a
+ *                           robust process-shared mutex in the header
+ *
+ * PURPOSE
+ *    File storage used by the Linked list manager for a list registered
+ *    with a file path.  The list is a dense list (LLDense.h) whose link,
+ *    validation and record arrays are mapped from the file, so a link is
+ *    an element index - a fixed offset in the file - and never an
+ *    address.  Opening the file again maps the list back as it was, with
+ *    no rebuild and with the tokens taken before still good.
+ *
+ *    The file is a header page and the three arrays sized for Capacity
+ *    elements when it is made.  It does not grow, and a file opened
+ *    again keeps the capacity it was made with.
+ *
+ *    Crash consistency.  Every 32 bit word an add, delete or delete all
+ *    changes in the header or the links goes through PersistPut(), which
+ *    first writes the word's offset and old value to the undo log in the
+ *    header, then the new log count, then the word.  PersistCommit() at
+ *    the end of the operation sets the count back to 0.  The new record
+ *    is copied to a free element before the links change and needs no
+ *    log.  The stores are to a shared mapping, so a process that dies at
+ *    any point leaves them all in the page cache - opening the file rolls
+ *    back an operation with a log count that is not 0, and the list is
+ *    as it was before that operation or after it.
+ *
+ *    A machine that stops writes back an arbitrary subset of the dirty
+ *    pages.  PersistSync() writes every page and marks the file clean,
+ *    the first change after clears the mark.  A file opened without the
+ *    mark has its links checked (DenseCheck()) and is turned down if they
+ *    do not hold together, and the caller rebuilds.  A record changed in
+ *    place through pUserCurrentElement is written as it is, no log.
+ *
+ *    The file is locked while open so only one process has it.
+ *    PersistClose() leaves it synced and marked clean.  PersistDrop(),
+ *    and the destructor, let go of it as it is, the same as a crash.
+ *
+ *    Shared memory.  Opened with Shared the name is a POSIX shared
+ *    memory object (shm_open()) laid out the same, and any number of
+ *    processes map it at once.  The header then holds a process-shared
+ *    robust mutex (PersistMutex()) every change is made under.  A
+ *    process that dies holding it leaves its operation in the log, and
+ *    the next process to take the mutex is told the owner died and
+ *    rolls it back with PersistRecover() before it goes on.  Opening
+ *    never rolls back a segment, the operation in the log can belong
+ *    to a live process.  There is nothing to sync and no clean mark -
+ *    the segment lasts until shm_unlink() or a reboot.
+ *----------------------------------------------------------------------
+*/
+#ifndef LLPERSIST_H
+#define LLPERSIST_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <pthread.h>
+#include "LLDense.h"
+
+#define  LL_PERSIST_MAGIC       0x31535245504D4C4CULL   // "LLMPERS1" in the first 8 bytes
+#define  LL_PERSIST_VERSION     2
+#define  LL_PERSIST_HEADER      4096            // Header page, the arrays follow
+#define  LL_PERSIST_UNDO        16              // Words one operation changes at most
+#define  LL_PERSIST_MAXELEMENTS 0x40000000      // Capacity of a file at most
+
+enum  LL_PERSIST {
+      LL_PERSIST_FAILED   = 0,                  // Could not open, size or map the file
+      LL_PERSIST_MISMATCH,                      // A list file made for another record length, or not shared as asked
+      LL_PERSIST_DAMAGED,                       // Not a list file, or a create that never finished
+      LL_PERSIST_CREATED,                       // New empty list
+      LL_PERSIST_REOPENED,                      // The list as it was left
+};
+
+/*
+ *----------------------------------------------------------------------
+ * One undo log entry - a word about to change and its value before
+ *--------------------------------------------------------------------
+*/
+typedef struct {
+    uint64_t    Offset;                         /// Byte offset of the word in the file
+    uint32_t    Old;
+    uint32_t    Unused;
+}  PersistUndo_t;
+
+/*
+ *----------------------------------------------------------------------
+ * Front of the file.  Magic is written last when a file is made.
+ *--------------------------------------------------------------------
+*/
+typedef struct {
+    uint64_t      Magic;
+    uint32_t      Version;
+    uint32_t      RecordLength;                 /// User bytes in a record
+    uint32_t      Capacity;                     /// Elements the file holds - a multiple of the dense chunk
+    uint32_t      Epoch;                        /// List epoch of the tokens
+    uint64_t      LinkOffset;                   /// DenseLink_t array
+    uint64_t      RandomOffset;                 /// Validation numbers
+    uint64_t      RecordOffset;                 /// Records, RecordStride apart
+    uint64_t      FileLength;
+    DenseState_t  State;                        /// Ends, count and free list of the dense list
+    uint32_t      Clean;                        /// 1 after PersistSync(), 0 from the next change
+    uint32_t      UndoCount;                    /// Log entries of an operation not committed
+    PersistUndo_t Undo[LL_PERSIST_UNDO];
+    uint32_t      Shared;                       /// 1 for a shared memory segment
+    pthread_mutex_t Lock;                       /// Shared - robust and process-shared, held for every change
+}  PersistHeader_t;
+
+static_assert(sizeof(PersistHeader_t) <= LL_PERSIST_HEADER, "The header must fit its page");
+
+class  LLPersist
+{
+  protected:
+
+    PersistHeader_t  *pHeader;                  /// Start of the mapping
+    size_t            MapLength;
+    int               Fd;
+    bool              WasClean;                 /// The file was marked clean when it was opened
+    bool              Shared;                   /// Shared memory segment, mapped by other processes too
+
+    void          Rollback(void);               /// Undo an operation a crash left part done
+
+  public:
+    int           PersistOpen(const char *, size_t, uint32_t, uint32_t, bool = false);  /// Path or shared name, record length,
+                                                                          ///   capacity and epoch of a new one, shared
+    void          PersistClose(void);                               /// Sync, mark clean, unmap and unlock
+    void          PersistDrop(void);                                /// Unmap and unlock, nothing written
+    bool          PersistSync(void);                                /// Every page to the disk, then the clean mark
+    bool          PersistWasClean(void) { return WasClean; }
+    void          PersistPut(uint32_t *, uint32_t);                 /// Log the old value, then store
+    void          PersistCommit(void);                              /// End of an operation
+    void          PersistRecover(void) { Rollback(); }              /// Shared - the mutex owner died, undo its operation
+    pthread_mutex_t *PersistMutex(void) { return Shared ? &pHeader->Lock : NULL; }   /// Shared lock, NULL for a file
+    PersistHeader_t *PersistHeader(void) { return pHeader; }
+    char         *PersistBase(void) { return (char *) pHeader; }
+                  LLPersist();
+                  ~LLPersist();
+                  LLPersist(const LLPersist &) = delete;
+                  LLPersist &operator=(const LLPersist &) = delete;
+};
+
+#endif
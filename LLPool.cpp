@@ -0,0 +1,223 @@
+/**----------------------------------------------------------------
+ * File:LLPool.cpp
+ *
+ * Author: Gregory Gannon
+ *
+ * PURPOSE
+ *
+ *  Work-stealing thread pool used by the Linked list manager for the
+ *    parallel walks.
+ *
+ * UPDATES:
+ *
+ * GMG   10-17-2026    Created for ParallelForEach() and ParallelReduce().
+ *-------------------------------------------------------------
+*/
+
+#include "LLPool.h"
+
+static thread_local LLPool  *pRunning = NULL;  // Pool whose run this thread is working on
+
+//--------------------------------------------------------------------
+// Constructor - start the workers, they sleep until the first run
+//--------------------------------------------------------------------
+
+LLPool::LLPool(int Threads)
+{
+    pWork      = NULL;
+    Generation = 0;
+    Busy       = 0;
+    Stopping   = false;
+    Left.store(0, std::memory_order_relaxed);
+
+    if (Threads < 0)
+    {
+        Threads = (int) std::thread::hardware_concurrency() - 1;
+    }
+    if (Threads < 0)
+    {
+        Threads = 0;
+    }
+
+    for (int i = 0; i <= Threads; ++i)
+    {
+        Queues.push_back(new PoolQueue_t);
+    }
+    for (int i = 0; i < Threads; ++i)
+    {
+        Workers.push_back(std::thread(&LLPool::WorkerMain, this, i));
+    }
+}
+
+LLPool::~LLPool()
+{
+    {
+        std::lock_guard<std::mutex>  Hold(WakeLock);
+
+        Stopping = true;
+    }
+    Wake.notify_all();
+    for (std::thread &Worker : Workers)
+    {
+        Worker.join();
+    }
+    for (PoolQueue_t *pQueue : Queues)
+    {
+        delete pQueue;
+    }
+}
+
+LLPool &LLPool::PoolDefault(void)
+{
+    static LLPool  Shared;
+
+    return Shared;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: A worker sleeps until the generation moves, drains the
+ *    queues and goes back to sleep.  A worker slow to wake can find a
+ *    run already over - the queues are empty and it sleeps again.
+ *------------------------------------------------------------------
+*/
+void LLPool::WorkerMain(int Self)
+{
+    unsigned long  Seen = 0;
+
+    pRunning = this;
+    for (;;)
+    {
+        std::unique_lock<std::mutex>  Hold(WakeLock);
+
+        Wake.wait(Hold, [&] { return Stopping == true || Generation != Seen; });
+        if (Stopping == true)
+        {
+            return;
+        }
+        Seen = Generation;
+        ++Busy;
+        Hold.unlock();
+
+        Drain(Self);
+
+        Hold.lock();
+        if (--Busy == 0)
+        {
+            Done.notify_all();
+        }
+    }
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Next chunk for a thread.  Its own queue first, from the
+ *    front, then the other queues from the back starting with the
+ *    next one along, so the thieves spread over the victims.
+ *------------------------------------------------------------------
+*/
+bool LLPool::Take(int Self, long *pChunk)
+{
+    int  Count = (int) Queues.size();
+
+    for (int i = 0; i < Count; ++i)
+    {
+        PoolQueue_t                  *pQueue = Queues[(Self + i) % Count];
+        std::lock_guard<std::mutex>   Hold(pQueue->Lock);
+
+        if (pQueue->Chunks.empty() == false)
+        {
+            if (i == 0)
+            {
+                *pChunk = pQueue->Chunks.front();
+                pQueue->Chunks.pop_front();
+            }
+            else
+            {
+                *pChunk = pQueue->Chunks.back();
+                pQueue->Chunks.pop_back();
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void LLPool::Drain(int Self)
+{
+    long  Chunk;
+
+    while (Take(Self, &Chunk) == true)
+    {
+        (*pWork)(Chunk);
+        if (Left.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            std::lock_guard<std::mutex>  Hold(WakeLock);
+
+            Done.notify_all();
+        }
+    }
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Run Work on every chunk and come back when they are all
+ *    done.  The function is set before the queues are filled, and a
+ *    worker reads it only after taking a chunk under a queue lock, so
+ *    it always sees this run's.  The call waits for the busy workers as
+ *    well as the chunks so none is still in Drain() when the next run
+ *    fills the queues.
+ *------------------------------------------------------------------
+*/
+void LLPool::PoolRun(long Chunks, const std::function<void(long)> &Work)
+{
+    int  Count = (int) Queues.size();
+
+    if (Chunks <= 0)
+    {
+        return;
+    }
+    if (Count == 1 || Chunks == 1 || pRunning == this)          // Nothing to share or already inside a run of this pool
+    {
+        for (long i = 0; i < Chunks; ++i)
+        {
+            Work(i);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex>  Running(RunLock);
+
+    {
+        std::lock_guard<std::mutex>  Hold(WakeLock);
+
+        pWork = &Work;
+        Left.store(Chunks, std::memory_order_relaxed);
+    }
+    for (int q = 0; q < Count; ++q)                             // Contiguous blocks - queue q gets chunks q * n / Count on
+    {
+        std::lock_guard<std::mutex>  Hold(Queues[q]->Lock);
+
+        for (long i = (long)((q * Chunks) / Count); i < (long)(((q + 1) * Chunks) / Count); ++i)
+        {
+            Queues[q]->Chunks.push_back(i);
+        }
+    }
+    {
+        std::lock_guard<std::mutex>  Hold(WakeLock);
+
+        ++Generation;
+    }
+    Wake.notify_all();
+
+    LLPool  *pWas = pRunning;                                   // A chunk of another pool's run can start this one
+
+    pRunning = this;
+    Drain(Count - 1);
+    pRunning = pWas;
+
+    std::unique_lock<std::mutex>  Hold(WakeLock);
+
+    Done.wait(Hold, [&] { return Left.load(std::memory_order_acquire) == 0 && Busy == 0; });
+    pWork = NULL;
+}
@@ -0,0 +1,83 @@
+/**--------------------------------------------------------------
+ * File: LLPool.h
+ *
+ *  Author: Gregory Gannon
+ * Created: 10/17/2026
+ *---------------------------------------------------------------------
+ * HISTORY
+ *
+ *	 Date       Author      Change Description
+ *   ----		------		------------------
+ * 10/17/2026    GMG        Developed the work-stealing pool for ParallelForEach() and ParallelReduce()
+ *
+ * PURPOSE
+ *    Thread pool used by the Linked list manager to run the chunks of a
+ *    parallel walk.  PoolRun() deals the chunk numbers out in blocks, a
+ *    block a queue, one queue for each worker and one for the calling
+ *    thread, which works too.  A thread takes chunks from the front of its
+ *    own queue and when that is empty steals from the back of the
+ *    others, so a thread that drew slow chunks is helped by the rest and
+ *    the run ends when the last chunk does.  An owner goes through its
+ *    block in order and a thief takes from the far end, so neighbouring
+ *    chunks stay on one thread.
+ *
+ *    The workers are started once and sleep between runs.  One run goes
+ *    at a time, a second calling thread waits for the first to end.  A
+ *    chunk that starts a run of its own - a parallel walk inside the
+ *    function of another - has it run on its own thread, so nesting
+ *    never waits on the pool.  The chunk function must not throw.
+ *----------------------------------------------------------------------
+*/
+#ifndef LLPOOL_H
+#define LLPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ *----------------------------------------------------------------------
+ * Chunk numbers waiting for one thread.  The owner works from the front
+ *      and thieves from the back.  A cache line each.
+ *--------------------------------------------------------------------
+*/
+typedef struct {
+    alignas(64) std::mutex  Lock;
+    std::deque<long>        Chunks;
+}  PoolQueue_t;
+
+class  LLPool
+{
+  protected:
+
+    std::vector<std::thread>     Workers;
+    std::vector<PoolQueue_t *>   Queues;        /// One a worker and the last for the calling thread
+    std::mutex                   RunLock;       /// One run at a time
+    std::mutex                   WakeLock;      /// Guards the fields down to Stopping
+    std::condition_variable      Wake;          /// Workers wait here for a run
+    std::condition_variable      Done;          /// The calling thread waits here for the workers
+    const std::function<void(long)> *pWork;     /// Chunk function of the run
+    unsigned long                Generation;    /// Goes up every run
+    int                          Busy;          /// Workers inside a run
+    bool                         Stopping;
+    std::atomic<long>            Left;          /// Chunks of the run not finished
+
+    void          WorkerMain(int);
+    bool          Take(int, long *);            /// Own queue, else steal - false when every queue is empty
+    void          Drain(int);                   /// Run chunks until there are none to take
+
+  public:
+    int           PoolThreads(void) { return (int) Workers.size() + 1; }   /// Threads in a run with the caller
+    void          PoolRun(long, const std::function<void(long)> &);        /// Call the function on chunks 0 to n - 1, back when all are done
+    static LLPool &PoolDefault(void);           /// Shared pool - a thread for each hardware thread
+                  LLPool(int = -1);             /// Worker threads, -1 for one less than the hardware threads
+                  ~LLPool();
+                  LLPool(const LLPool &) = delete;
+                  LLPool &operator=(const LLPool &) = delete;
+};
+
+#endif
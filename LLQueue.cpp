@@ -0,0 +1,146 @@
+/**----------------------------------------------------------------
+ * File:LLQueue.cpp
+ *
+ * Author: Gregory Gannon
+ *
+ * PURPOSE
+ *
+ *  Multi producer, single consumer inbox used by the Linked list
+ *    manager for lists registered with LL_OPTION_MPSC.
+ *
+ * UPDATES:
+ *
+ * GMG   10-17-2026    Created for the lock-free producer adds.
+ *-------------------------------------------------------------
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <new>
+#include "LLQueue.h"
+
+//--------------------------------------------------------------------
+// Constructor - the stub is the only node, head and tail point to it
+//--------------------------------------------------------------------
+
+LLQueue::LLQueue()
+{
+    Stub.pNext.store(NULL, std::memory_order_relaxed);
+    pHead        = &Stub;
+    RecordLength = 0;
+    Tail.store(&Stub, std::memory_order_relaxed);
+}
+
+LLQueue::~LLQueue()
+{
+    QueueClear();
+}
+
+bool LLQueue::QueueInit(size_t Length)
+{
+    RecordLength = Length;
+    return RecordLength > 0;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Producer side.  The exchange orders the producers, the
+ *    store to the old tail makes the node reachable from the head.
+ *------------------------------------------------------------------
+*/
+void LLQueue::Link(QueueNode_t *pNode)
+{
+    QueueNode_t  *pPrev;
+
+    pNode->pNext.store(NULL, std::memory_order_relaxed);
+    pPrev = Tail.exchange(pNode, std::memory_order_acq_rel);
+    pPrev->pNext.store(pNode, std::memory_order_release);
+}
+
+bool LLQueue::QueuePush(const void *pRecord)
+{
+    QueueNode_t  *pNode;
+
+    if ((pNode = (QueueNode_t *) malloc(sizeof(QueueNode_t) + RecordLength)) == NULL)
+    {
+        return false;
+    }
+    new (&pNode->pNext) std::atomic<QueueNode_t *>();
+    memcpy((char *)(pNode + 1), pRecord, RecordLength);
+    Link(pNode);
+    return true;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Consumer side.  The node handed back is unlinked and its
+ *    record is complete.  The stub is stepped over, and put back at
+ *    the tail when the last real node is taken so that node can go.
+ *    NULL when nothing is posted or a producer is between its exchange
+ *    and its link.
+ *------------------------------------------------------------------
+*/
+QueueNode_t *LLQueue::Next(void)
+{
+    QueueNode_t  *pFirst = pHead;
+    QueueNode_t  *pNext  = pFirst->pNext.load(std::memory_order_acquire);
+
+    if (pFirst == &Stub)
+    {
+        if (pNext == NULL)
+        {
+            return NULL;                        // Nothing posted
+        }
+        pHead  = pNext;
+        pFirst = pNext;
+        pNext  = pNext->pNext.load(std::memory_order_acquire);
+    }
+
+    if (pNext != NULL)
+    {
+        pHead = pNext;
+        return pFirst;
+    }
+
+    if (pFirst != Tail.load(std::memory_order_acquire))
+    {
+        return NULL;                            // A producer has the tail and has not linked it yet
+    }
+
+    Link(&Stub);                                // pFirst is the last node - the stub goes behind it
+    if ((pNext = pFirst->pNext.load(std::memory_order_acquire)) != NULL)
+    {
+        pHead = pNext;
+        return pFirst;
+    }
+    return NULL;                                // A producer got in before the stub, next time
+}
+
+bool LLQueue::QueuePop(void *pRecord)
+{
+    QueueNode_t  *pNode;
+
+    if ((pNode = Next()) == NULL)
+    {
+        return false;
+    }
+    memcpy(pRecord, (char *)(pNode + 1), RecordLength);
+    free(pNode);
+    return true;
+}
+
+bool LLQueue::QueueEmpty(void)                  // A real node at the head is a record not taken yet
+{
+    return pHead == &Stub && Stub.pNext.load(std::memory_order_acquire) == NULL
+           && Tail.load(std::memory_order_acquire) == &Stub;
+}
+
+void LLQueue::QueueClear(void)
+{
+    QueueNode_t  *pNode;
+
+    while ((pNode = Next()) != NULL)
+    {
+        free(pNode);
+    }
+}
@@ -0,0 +1,67 @@
+/**--------------------------------------------------------------
+ * File: LLQueue.h
+ *
+ *  Author: Gregory Gannon
+ * Created: 10/17/2026
+ *---------------------------------------------------------------------
+ * HISTORY
+ *
+ *	 Date       Author      Change Description
+ *   ----		------		------------------
+ * 10/17/2026    GMG        Developed the MPSC inbox for LL_OPTION_MPSC
+ *
+ * PURPOSE
+ *    Lock-free inbox used by the Linked list manager for a list that many
+ *    threads feed and one thread drains.  It is the intrusive queue of
+ *    Dmitry Vyukov: a node is a next pointer with the record after it, a
+ *    producer swaps itself in as the tail with one exchange and links the
+ *    old tail to it, and the consumer follows next pointers from the head.
+ *    No producer waits on another or on the consumer.
+ *
+ *    A producer that has swapped the tail but not yet linked it hides the
+ *    nodes behind it for that moment, so QueuePop() can say empty while
+ *    a record is on its way.  It never blocks - the record is there on a
+ *    later call.
+ *
+ *    Nodes come from malloc() in the producer and go back with free() in
+ *    the consumer, the slab of the list is not safe across threads.
+ *----------------------------------------------------------------------
+*/
+#ifndef LLQUEUE_H
+#define LLQUEUE_H
+
+#include <stddef.h>
+#include <atomic>
+
+/*
+ *----------------------------------------------------------------------
+ * Front of every node, the record follows
+ *--------------------------------------------------------------------
+*/
+typedef struct QueueNode_s {
+    std::atomic<struct QueueNode_s *> pNext;    /// Node posted after this one, NULL at the tail
+}  QueueNode_t;
+
+class  LLQueue
+{
+  protected:
+
+    QueueNode_t               *pHead;          /// Consumer only - oldest node, may be the stub
+    size_t                     RecordLength;
+    QueueNode_t                Stub;            /// Keeps the queue from ever being empty of nodes
+    alignas(64) std::atomic<QueueNode_t *> Tail;        /// Producers only - on its own cache line
+
+    void          Link(QueueNode_t *);          /// Producer side of a push
+    QueueNode_t  *Next(void);                   /// Consumer side of a pop, NULL if nothing is ready
+
+  public:
+    bool          QueueInit(size_t);            /// Record length
+    bool          QueuePush(const void *);      /// Any thread - copy a record in, false if malloc() fails
+    bool          QueuePop(void *);             /// Consumer - copy the oldest record out, false if none is ready
+    bool          QueueEmpty(void);             /// Consumer - nothing posted and not taken
+    void          QueueClear(void);             /// Consumer - free every record, no producer may be posting
+                  LLQueue();
+                  ~LLQueue();
+};
+
+#endif
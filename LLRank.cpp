@@ -0,0 +1,288 @@
+/**----------------------------------------------------------------
+ * File:LLRank.cpp
+ *
+ * Author: Gregory Gannon
+ *
+ * PURPOSE
+ *
+ *  Position index used by the Linked list manager for ListPointIndex().
+ *    A treap in list order where every node carries the size of its
+ *    subtree.  The random priorities keep the depth around 2 log n on
+ *    any add pattern, appends included, without any rebalancing rules.
+ *
+ * UPDATES:
+ *
+ * GMG   10-17-2026    Created for the list position index.
+ *-------------------------------------------------------------
+*/
+
+#include "LLRank.h"
+
+//--------------------------------------------------------------------
+// Constructor - an empty tree
+//--------------------------------------------------------------------
+
+LLRank::LLRank()
+{
+    pRoot = NULL;
+    Seed  = 0x2545F4914F6CDD1DULL;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Lift pNode over its parent.  The list order does not
+ *    change, only the shape.  The parent takes the subtree pNode gives
+ *    up on the side facing it, and pNode gets the parent's old size.
+ *------------------------------------------------------------------
+*/
+void LLRank::Rotate(RankNode_t *pNode)
+{
+    RankNode_t  *pParent = pNode->pParent;
+    RankNode_t  *pGrand  = pParent->pParent;
+
+    if (pParent->pLeft == pNode)
+    {
+        pParent->pLeft = pNode->pRight;
+        if (pNode->pRight != NULL)
+        {
+            pNode->pRight->pParent = pParent;
+        }
+        pNode->pRight = pParent;
+    }
+    else
+    {
+        pParent->pRight = pNode->pLeft;
+        if (pNode->pLeft != NULL)
+        {
+            pNode->pLeft->pParent = pParent;
+        }
+        pNode->pLeft = pParent;
+    }
+
+    pParent->pParent = pNode;
+    pNode->pParent   = pGrand;
+
+    if (pGrand == NULL)
+    {
+        pRoot = pNode;
+    }
+    else if (pGrand->pLeft == pParent)
+    {
+        pGrand->pLeft = pNode;
+    }
+    else
+    {
+        pGrand->pRight = pNode;
+    }
+
+    pNode->Size   = pParent->Size;
+    pParent->Size = 1 + SizeOf(pParent->pLeft) + SizeOf(pParent->pRight);
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Hang pNew as a leaf on the empty Left or right side of
+ *    pParent (NULL for an empty tree), count it on the way up and lift
+ *    it while its priority is above its parent's.
+ *------------------------------------------------------------------
+*/
+void LLRank::Link(RankNode_t *pParent, RankNode_t *pNew, bool Left)
+{
+    Seed ^= Seed << 13;                             // xorshift64
+    Seed ^= Seed >> 7;
+    Seed ^= Seed << 17;
+
+    pNew->pLeft    = NULL;
+    pNew->pRight   = NULL;
+    pNew->pParent  = pParent;
+    pNew->Size     = 1;
+    pNew->Priority = Seed;
+
+    if (pParent == NULL)
+    {
+        pRoot = pNew;
+        return;
+    }
+
+    if (Left == true)
+    {
+        pParent->pLeft = pNew;
+    }
+    else
+    {
+        pParent->pRight = pNew;
+    }
+
+    for (RankNode_t *pUp = pParent; pUp != NULL; pUp = pUp->pParent)
+    {
+        ++pUp->Size;
+    }
+
+    while (pNew->pParent != NULL && pNew->Priority > pNew->pParent->Priority)
+    {
+        Rotate(pNew);
+    }
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Put pNew straight after pPrev in list order.  That is the
+ *    right of pPrev when it is free, else the far left of its right
+ *    subtree.  RankInsertBefore() is the mirror image.
+ *------------------------------------------------------------------
+*/
+void LLRank::RankInsertAfter(RankNode_t *pPrev, RankNode_t *pNew)
+{
+    RankNode_t  *pNode;
+
+    if (pRoot == NULL)
+    {
+        Link(NULL, pNew, true);
+        return;
+    }
+
+    if (pPrev == NULL)                              // First - far left of the tree
+    {
+        for (pNode = pRoot; pNode->pLeft != NULL; pNode = pNode->pLeft)
+        {
+        }
+        Link(pNode, pNew, true);
+    }
+    else if (pPrev->pRight == NULL)
+    {
+        Link(pPrev, pNew, false);
+    }
+    else
+    {
+        for (pNode = pPrev->pRight; pNode->pLeft != NULL; pNode = pNode->pLeft)
+        {
+        }
+        Link(pNode, pNew, true);
+    }
+}
+
+void LLRank::RankInsertBefore(RankNode_t *pNext, RankNode_t *pNew)
+{
+    RankNode_t  *pNode;
+
+    if (pRoot == NULL)
+    {
+        Link(NULL, pNew, true);
+        return;
+    }
+
+    if (pNext == NULL)                              // Last - far right of the tree
+    {
+        for (pNode = pRoot; pNode->pRight != NULL; pNode = pNode->pRight)
+        {
+        }
+        Link(pNode, pNew, false);
+    }
+    else if (pNext->pLeft == NULL)
+    {
+        Link(pNext, pNew, true);
+    }
+    else
+    {
+        for (pNode = pNext->pLeft; pNode->pRight != NULL; pNode = pNode->pRight)
+        {
+        }
+        Link(pNode, pNew, false);
+    }
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Take pNode out.  It is rotated down under its higher
+ *    priority child until it has one child or none, then its child
+ *    takes its place and the nodes above it count one less.
+ *------------------------------------------------------------------
+*/
+void LLRank::RankErase(RankNode_t *pNode)
+{
+    RankNode_t  *pChild;
+    RankNode_t  *pParent;
+
+    while (pNode->pLeft != NULL && pNode->pRight != NULL)
+    {
+        Rotate(pNode->pLeft->Priority > pNode->pRight->Priority ? pNode->pLeft : pNode->pRight);
+    }
+
+    pChild  = (pNode->pLeft != NULL) ? pNode->pLeft : pNode->pRight;
+    pParent = pNode->pParent;
+
+    if (pChild != NULL)
+    {
+        pChild->pParent = pParent;
+    }
+
+    if (pParent == NULL)
+    {
+        pRoot = pChild;
+    }
+    else if (pParent->pLeft == pNode)
+    {
+        pParent->pLeft = pChild;
+    }
+    else
+    {
+        pParent->pRight = pChild;
+    }
+
+    for (; pParent != NULL; pParent = pParent->pParent)
+    {
+        --pParent->Size;
+    }
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Node at Position, 0 is the top of the list.  Steps left or
+ *    right by the size of the left subtree.
+ *------------------------------------------------------------------
+*/
+RankNode_t *LLRank::RankAt(size_t Position)
+{
+    RankNode_t  *pNode = pRoot;
+
+    while (pNode != NULL)
+    {
+        size_t  Left = SizeOf(pNode->pLeft);
+
+        if (Position < Left)
+        {
+            pNode = pNode->pLeft;
+        }
+        else if (Position == Left)
+        {
+            return pNode;
+        }
+        else
+        {
+            Position -= Left + 1;
+            pNode     = pNode->pRight;
+        }
+    }
+    return NULL;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Position of pNode.  The nodes before it are its left
+ *    subtree plus, every time the walk up comes from a right child,
+ *    that parent and its left subtree.
+ *------------------------------------------------------------------
+*/
+size_t LLRank::RankOf(RankNode_t *pNode)
+{
+    size_t  Position = SizeOf(pNode->pLeft);
+
+    for (; pNode->pParent != NULL; pNode = pNode->pParent)
+    {
+        if (pNode->pParent->pRight == pNode)
+        {
+            Position += SizeOf(pNode->pParent->pLeft) + 1;
+        }
+    }
+    return Position;
+}
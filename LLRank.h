@@ -0,0 +1,66 @@
+/**--------------------------------------------------------------
+ * File: LLRank.h
+ *
+ *  Author: Gregory Gannon
+ * Created: 10/17/2026
+ *---------------------------------------------------------------------
+ * HISTORY
+ *
+ *	 Date       Author      Change Description
+ *   ----		------		------------------
+ * 10/17/2026    GMG        Developed the position index for ListPointIndex()
+ *
+ * PURPOSE
+ *    Counted treap over the elements of a list in list order, used by
+ *    the Linked list manager to go to the element at a position and to
+ *    tell the position of an element in O(log n).  Each node counts the
+ *    nodes under it, nothing is keyed.  The place of a node is set by
+ *    the node it is put before or after.
+ *
+ *    The nodes are not allocated here.  The list keeps a RankNode_t in
+ *    every element behind the user data area, so an add or delete never
+ *    has to get memory for the index and can't fail.
+ *----------------------------------------------------------------------
+*/
+#ifndef LLRANK_H
+#define LLRANK_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ *----------------------------------------------------------------------
+ * One node - lives in the list element it stands for
+ *--------------------------------------------------------------------
+*/
+typedef struct RankNode_s {
+    struct RankNode_s *pLeft;                   /// Elements before this one in the subtree
+    struct RankNode_s *pRight;                  /// Elements after this one in the subtree
+    struct RankNode_s *pParent;                 /// NULL for the root
+    size_t             Size;                    /// Nodes in this subtree, this one included
+    uint64_t           Priority;                /// Heap order - a parent is never lower than its children
+}  RankNode_t;
+
+class  LLRank
+{
+  protected:
+
+    RankNode_t   *pRoot;
+    uint64_t      Seed;                         /// Priority generator state
+
+    void          Rotate(RankNode_t *);         /// Lift a node over its parent
+    void          Link(RankNode_t *, RankNode_t *, bool);
+    static size_t SizeOf(RankNode_t *pNode) { return pNode == NULL ? 0 : pNode->Size; }
+
+  public:
+    void          RankInsertAfter(RankNode_t *, RankNode_t *);    /// Put a node after another - NULL puts it first
+    void          RankInsertBefore(RankNode_t *, RankNode_t *);   /// Put a node before another - NULL puts it last
+    void          RankErase(RankNode_t *);                        /// Take a node out
+    RankNode_t   *RankAt(size_t);                                 /// Node at a position from 0 or NULL
+    size_t        RankOf(RankNode_t *);                           /// Position of a node from 0
+    size_t        RankCount(void) { return SizeOf(pRoot); }
+    void          RankClear(void) { pRoot = NULL; }               /// Forget every node - the nodes are not ours to free
+                  LLRank();
+};
+
+#endif
@@ -0,0 +1,146 @@
+/**----------------------------------------------------------------
+ * File:LLReclaim.cpp
+ *
+ * Author: Gregory Gannon
+ *
+ * PURPOSE
+ *
+ *  Epoch reclamation used by the Linked list manager for lists
+ *    registered with LL_OPTION_RECLAIM.
+ *
+ * UPDATES:
+ *
+ * GMG   10-17-2026    Created for the lock-free readers.
+ *-------------------------------------------------------------
+*/
+
+#include <stdlib.h>
+#include <thread>
+#include "LLReclaim.h"
+
+//--------------------------------------------------------------------
+// Constructor - every slot free, no element waiting
+//--------------------------------------------------------------------
+
+LLReclaim::LLReclaim()
+{
+    Epoch.store(1, std::memory_order_relaxed);
+    for (int i = 0; i < LL_RECLAIM_SLOTS; ++i)
+    {
+        Slots[i].Epoch.store(0, std::memory_order_relaxed);
+    }
+    pSlab     = NULL;
+    CollectAt = LL_RECLAIM_BATCH;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Reader side.  A free slot is claimed with the epoch read
+ *    just before, the fence after it makes the claim seen by a writer
+ *    before this thread reads a link.  A writer that scans the slots
+ *    and misses the claim has unlinked its element before the scan, so
+ *    the links this reader reads no longer lead to it.  Each thread
+ *    starts looking at its own slot, so there is no fight for slots
+ *    until more than LL_RECLAIM_SLOTS threads read at once.
+ *------------------------------------------------------------------
+*/
+int LLReclaim::ReclaimEnter(void)
+{
+    static std::atomic<unsigned>  NextHint(0);
+    static thread_local unsigned  Hint = NextHint.fetch_add(1, std::memory_order_relaxed) % LL_RECLAIM_SLOTS;
+
+    for (;;)
+    {
+        for (unsigned i = 0; i < LL_RECLAIM_SLOTS; ++i)
+        {
+            int       Slot = (int) ((Hint + i) % LL_RECLAIM_SLOTS);
+            uint64_t  Free = 0;
+
+            if (Slots[Slot].Epoch.load(std::memory_order_relaxed) == 0
+             && Slots[Slot].Epoch.compare_exchange_strong(Free, Epoch.load(std::memory_order_seq_cst),
+                                                          std::memory_order_seq_cst))
+            {
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                return Slot;
+            }
+        }
+        std::this_thread::yield();                  // Every slot busy - a reader leaves soon
+    }
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Writer side.  An element is tagged with the epoch it was
+ *    unlinked in.  The caller collects when true comes back.
+ *------------------------------------------------------------------
+*/
+bool LLReclaim::ReclaimRetire(void *pElement)
+{
+    Retired.push_back(std::make_pair(pElement, Epoch.load(std::memory_order_relaxed)));
+    return Retired.size() >= CollectAt;
+}
+
+uint64_t LLReclaim::Oldest(void)
+{
+    uint64_t  Low = Epoch.load(std::memory_order_seq_cst);
+    uint64_t  Seen;
+
+    for (int i = 0; i < LL_RECLAIM_SLOTS; ++i)
+    {
+        if ((Seen = Slots[i].Epoch.load(std::memory_order_acquire)) != 0 && Seen < Low)
+        {
+            Low = Seen;
+        }
+    }
+    return Low;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Move the epoch on so readers entering from here are newer
+ *    than every element waiting, then free the elements older than
+ *    the oldest reader.  With no reader in a section every element
+ *    goes.  The retire list is in epoch order, so a collection costs
+ *    the elements it frees and not the ones left waiting.
+ *------------------------------------------------------------------
+*/
+size_t LLReclaim::ReclaimCollect(void)
+{
+    uint64_t  Low;
+    size_t    Freed = 0;
+
+    Epoch.fetch_add(1, std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    Low = Oldest();
+
+    while (Retired.empty() == false && Retired.front().second < Low)     // Tags only go up - stop at the first kept
+    {
+        pSlab->SlabFree(Retired.front().first);
+        Retired.pop_front();
+        ++Freed;
+    }
+    CollectAt = Retired.size() + LL_RECLAIM_BATCH;     // A reader holding the rest back is not rescanned every delete
+    return Freed;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Wait until every reader that entered before the call has
+ *    left.  Used once the whole list is unlinked and its storage is
+ *    about to go.  The caller must not be in a section itself.
+ *------------------------------------------------------------------
+*/
+void LLReclaim::ReclaimWait(void)
+{
+    uint64_t  Now = Epoch.fetch_add(1, std::memory_order_seq_cst) + 1;
+    uint64_t  Seen;
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for (int i = 0; i < LL_RECLAIM_SLOTS; ++i)
+    {
+        while ((Seen = Slots[i].Epoch.load(std::memory_order_acquire)) != 0 && Seen < Now)
+        {
+            std::this_thread::yield();
+        }
+    }
+}
@@ -0,0 +1,134 @@
+/**--------------------------------------------------------------
+ * File: LLReclaim.h
+ *
+ *  Author: Gregory Gannon
+ * Created: 10/17/2026
+ *---------------------------------------------------------------------
+ * HISTORY
+ *
+ *	 Date       Author      Change Description
+ *   ----		------		------------------
+ * 10/17/2026    GMG        Developed the epoch reclamation for LL_OPTION_RECLAIM
+ *
+ * PURPOSE
+ *    Deferred free of deleted elements used by the Linked list manager so
+ *    reader threads can walk a list forward without the list lock while a
+ *    writer deletes.  ListDelete() unlinks an element at once but leaves
+ *    its forward pointer alone and hands it here instead of to the slab.
+ *
+ *    A reader walks inside a read section.  Entering takes a reader slot
+ *    and writes the global epoch in it, leaving writes 0.  A deleted
+ *    element is tagged with the epoch of the delete.  ReclaimCollect()
+ *    moves the epoch on and frees every element tagged before the oldest
+ *    epoch still in a slot - a reader that entered before the delete may
+ *    still be on it, one that entered after can not reach it.  A section
+ *    costs one compare and swap and one store and never waits on a
+ *    writer.  A reader that stays in its section holds back every
+ *    element deleted after it entered, so sections are kept short.
+ *
+ *    The slots are shared by every thread and taken by compare and swap,
+ *    so a thread can be in sections on several lists or nest them.  The
+ *    retire list is the writer's, the list lock keeps it to one thread.
+ *----------------------------------------------------------------------
+*/
+#ifndef LLRECLAIM_H
+#define LLRECLAIM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <deque>
+#include <utility>
+#include "LLSlab.h"
+
+#define  LL_RECLAIM_SLOTS       128             // Readers in a section at once, more wait for a slot
+#define  LL_RECLAIM_BATCH       64              // Deletes between collections
+
+#if defined(__GNUC__)
+#define  LL_LINKLOAD(p)         __atomic_load_n(&(p), __ATOMIC_ACQUIRE)     // Link a section reader follows
+#define  LL_LINKSTORE(p, v)     __atomic_store_n(&(p), (v), __ATOMIC_RELEASE) // Link the writer publishes
+#else
+#define  LL_LINKLOAD(p)         (p)
+#define  LL_LINKSTORE(p, v)     ((p) = (v))
+#endif
+
+/*
+ *----------------------------------------------------------------------
+ * One reader slot - 0 while free, else the epoch the reader entered in.
+ *      A cache line each so readers on different slots do not share one.
+ *--------------------------------------------------------------------
+*/
+typedef struct {
+    alignas(64) std::atomic<uint64_t>  Epoch;
+}  ReclaimSlot_t;
+
+class  LLReclaim
+{
+  protected:
+
+    std::atomic<uint64_t>  Epoch;               /// Global epoch - starts at 1, 0 marks a free slot
+    ReclaimSlot_t          Slots[LL_RECLAIM_SLOTS];
+    std::deque<std::pair<void *, uint64_t>> Retired;       /// Writer only - element and its delete epoch, oldest first
+    LLSlab                *pSlab;               /// Where a reclaimed element goes
+    size_t                 CollectAt;           /// Retire list length for the next collection
+
+    uint64_t      Oldest(void);                 /// Oldest epoch a reader is in, or the current one
+
+  public:
+    void          ReclaimInit(LLSlab *pTo) { pSlab = pTo; }
+    int           ReclaimEnter(void);           /// Reader - slot to give back to ReclaimLeave()
+    void          ReclaimLeave(int Slot) { Slots[Slot].Epoch.store(0, std::memory_order_release); }
+    bool          ReclaimRetire(void *);        /// Writer - an unlinked element, true when a collection is due
+    size_t        ReclaimCollect(void);         /// Writer - free what no reader can reach, returns the count freed
+    void          ReclaimWait(void);            /// Writer - wait out every reader that entered before the call
+    size_t        ReclaimPending(void) { return Retired.size(); }
+                  LLReclaim();
+                  LLReclaim(const LLReclaim &) = delete;
+                  LLReclaim &operator=(const LLReclaim &) = delete;
+};
+
+/*
+ *----------------------------------------------------------------------
+ * Read section as an object - entered on construction, left when it goes
+ *      out of scope.  One made without an LLReclaim does nothing.
+ *--------------------------------------------------------------------
+*/
+class  LLReadSection
+{
+  protected:
+
+    LLReclaim    *pReclaim;
+    int           Slot;
+
+  public:
+                  LLReadSection() : pReclaim(NULL), Slot(-1) {}
+    explicit      LLReadSection(LLReclaim *pFrom) : pReclaim(pFrom), Slot((pFrom != NULL) ? pFrom->ReclaimEnter() : -1) {}
+                  LLReadSection(LLReadSection &&Other) : pReclaim(Other.pReclaim), Slot(Other.Slot)
+                  {
+                      Other.pReclaim = NULL;
+                  }
+                  LLReadSection(const LLReadSection &) = delete;
+                  LLReadSection &operator=(const LLReadSection &) = delete;
+    LLReadSection &operator=(LLReadSection &&Other)
+                  {
+                      if (this != &Other)
+                      {
+                          Leave();
+                          pReclaim       = Other.pReclaim;
+                          Slot           = Other.Slot;
+                          Other.pReclaim = NULL;
+                      }
+                      return *this;
+                  }
+                  ~LLReadSection() { Leave(); }
+    void          Leave(void)                   /// Leave before the end of the scope
+                  {
+                      if (pReclaim != NULL)
+                      {
+                          pReclaim->ReclaimLeave(Slot);
+                          pReclaim = NULL;
+                      }
+                  }
+};
+
+#endif
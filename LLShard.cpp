@@ -0,0 +1,322 @@
+/**----------------------------------------------------------------
+ * File:LLShard.cpp
+ *
+ * Author: Gregory Gannon
+ *
+ * PURPOSE
+ *
+ *  Sharded container of Linked list manager lists.  Records are
+ *    spread over the shards by key hash or by the adding thread and
+ *    shard tokens carry the shard so lookups go straight to it.
+ *
+ * UPDATES:
+ *
+ * GMG   10-17-2026    Created for the multi core adds and lookups.
+ *-------------------------------------------------------------
+*/
+
+#include <string.h>
+#include <atomic>
+#include <new>
+#include "LLShard.h"
+
+//--------------------------------------------------------------------
+// Constructor - no shards until registration
+//--------------------------------------------------------------------
+
+LLShard::LLShard()
+{
+    ShardBy      = LL_SHARD_BYKEY;
+    RecordLength = 0;
+    KeyOffset    = 0;
+    KeyLength    = 0;
+}
+
+LLShard::~LLShard()
+{
+    ShardDeleteAll();
+    ShardDeregister();
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Register Count lists named Name.0, Name.1 ...  Every one
+ *    is thread-safe whatever Options asks for.  Nothing is kept if a
+ *    shard fails to register.
+ *------------------------------------------------------------------
+*/
+bool LLShard::Register(int Count, long Size, std::string Name, long Offset, long Length, int Options, int By)
+{
+    LLMgr  *pList;
+    bool    Registered;
+
+    if (Shards.empty() == false || Count < 1 || Count > LL_SHARD_MAX
+        || (Options & LL_OPTION_UNROLLED) != 0                          // Records named by node address - no room for the shard
+        || (By != LL_SHARD_BYKEY && By != LL_SHARD_BYTHREAD)
+        || (By == LL_SHARD_BYKEY && Length < 1))
+    {
+        return false;
+    }
+
+    for (int i = 0; i < Count; ++i)
+    {
+        if ((pList = new (std::nothrow) LLMgr()) == NULL)
+        {
+            ShardDeregister();
+            return false;
+        }
+        Shards.push_back(pList);
+
+        if (Length > 0)
+        {
+            Registered = pList->ListRegister(Size, Name + "." + std::to_string(i), Offset, Length, Options | LL_OPTION_THREADSAFE);
+        }
+        else
+        {
+            Registered = pList->ListRegister(Size, Name + "." + std::to_string(i), Options | LL_OPTION_THREADSAFE);
+        }
+        if (Registered == false)
+        {
+            ShardDeregister();
+            return false;
+        }
+    }
+
+    ShardBy      = By;
+    RecordLength = Size;
+    KeyOffset    = Offset;
+    KeyLength    = Length;
+    return true;
+}
+
+bool LLShard::ShardRegister(int Count, long Size, std::string Name, long Offset, long Length, int Options, int By)
+{
+    return Register(Count, Size, Name, Offset, Length, Options, By);
+}
+
+bool LLShard::ShardRegister(int Count, long Size, std::string Name, int Options)
+{
+    return Register(Count, Size, Name, 0, 0, Options, LL_SHARD_BYTHREAD);
+}
+
+bool LLShard::ShardDeleteAll(void)
+{
+    bool  Deleted = true;
+
+    for (LLMgr *pList : Shards)
+    {
+        Deleted = pList->ListDeleteAll() && Deleted;
+    }
+    return Deleted;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Deregister and free every shard.  Like ListDeregister()
+ *    the shards must be empty, nothing is freed if one is not.  A
+ *    shard that never registered (a failed ShardRegister()) is freed
+ *    as it is.
+ *------------------------------------------------------------------
+*/
+bool LLShard::ShardDeregister(void)
+{
+    if (ElementCount() != 0)
+    {
+        return false;
+    }
+
+    for (LLMgr *pList : Shards)
+    {
+        pList->ListDeregister();
+        delete pList;
+    }
+    Shards.clear();
+    return true;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Shard of a key.  The high 32 bits of the hash are scaled
+ *    to the shard count - the low bits pick the slot in the key index
+ *    of the shard, and taking the shard from them too would leave
+ *    every key in a shard with the same low bits.
+ *------------------------------------------------------------------
+*/
+int LLShard::ShardOf(const void *pKey)
+{
+    if (ShardBy != LL_SHARD_BYKEY || Shards.empty() == true || pKey == NULL)
+    {
+        return -1;
+    }
+    return (int)(((LLMgr::HashBytes(pKey, (size_t) KeyLength) >> 32) * Shards.size()) >> 32);
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Threads are numbered the first time they ask, so the
+ *    first Count threads get a shard each.
+ *------------------------------------------------------------------
+*/
+int LLShard::ShardHome(void)
+{
+    static std::atomic<unsigned>  NextThread(0);
+    static thread_local unsigned  ThreadNumber = NextThread.fetch_add(1, std::memory_order_relaxed);
+
+    return Shards.empty() ? -1 : (int)(ThreadNumber % Shards.size());
+}
+
+DirectToken_t LLShard::Token(int n, DirectToken_t Own)
+{
+    if (Own.Magic == 1955)
+    {
+        Own.Address = (void *)((uintptr_t) Own.Address | ((uintptr_t) n << LL_SHARD_SHIFT));
+    }
+    return Own;
+}
+
+int LLShard::ShardRoute(DirectToken_t *pToken)
+{
+    uintptr_t  n;
+
+    if (pToken == NULL || pToken->Magic != 1955
+        || (n = (uintptr_t) pToken->Address >> LL_SHARD_SHIFT) >= Shards.size())
+    {
+        return -1;
+    }
+    pToken->Address = (void *)((uintptr_t) pToken->Address & 0xFFFFFFFFu);
+    return (int) n;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Copy a record into the add buffer of its shard and add it
+ *    at the end, then take the token while the shard is still held.
+ *------------------------------------------------------------------
+*/
+DirectToken_t LLShard::ShardAdd(const void *pRecord)
+{
+    DirectToken_t  Own = { NULL, 0, 0 };
+    int            n;
+
+    if (pRecord == NULL)
+    {
+        return Own;
+    }
+    n = (ShardBy == LL_SHARD_BYKEY) ? ShardOf((const char *) pRecord + KeyOffset) : ShardHome();
+    if (n < 0)
+    {
+        return Own;
+    }
+
+    std::unique_lock<LLLock>  Hold = Shards[n]->ListWriteLock();
+
+    memcpy(Shards[n]->pUserAddBuffer, pRecord, RecordLength);
+    if (Shards[n]->ListAddEnd() == true)
+    {
+        Own = Shards[n]->GetDirectToken();
+    }
+    return Token(n, Own);
+}
+
+bool LLShard::ShardGet(DirectToken_t Shared, void *pRecord)
+{
+    int  n = ShardRoute(&Shared);
+
+    if (n < 0 || pRecord == NULL)
+    {
+        return false;
+    }
+
+    std::unique_lock<LLLock>  Hold = Shards[n]->ListWriteLock();
+
+    if (Shards[n]->SetDirectPointer(Shared) == false)
+    {
+        return false;
+    }
+    memcpy(pRecord, Shards[n]->pUserCurrentElement, RecordLength);
+    return true;
+}
+
+bool LLShard::ShardRemove(DirectToken_t Shared)
+{
+    int  n = ShardRoute(&Shared);
+
+    if (n < 0)
+    {
+        return false;
+    }
+
+    std::unique_lock<LLLock>  Hold = Shards[n]->ListWriteLock();
+
+    return Shards[n]->SetDirectPointer(Shared) == true && Shards[n]->ListDelete() == true;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Find a record by key.  Without a token wanted the shard is
+ *    only held shared, so finds in one shard run alongside each other.
+ *    The token is taken from the current element, which needs the
+ *    shard exclusive.
+ *------------------------------------------------------------------
+*/
+bool LLShard::ShardFind(const void *pKey, void *pRecord, DirectToken_t *pToken)
+{
+    int  First = 0;
+    int  Last  = (int) Shards.size() - 1;
+
+    if (pKey == NULL || pRecord == NULL || KeyLength == 0)
+    {
+        return false;
+    }
+    if (ShardBy == LL_SHARD_BYKEY)
+    {
+        First = Last = ShardOf(pKey);
+    }
+
+    for (int n = First; n <= Last; ++n)
+    {
+        if (pToken == NULL)
+        {
+            std::shared_lock<LLLock>  Hold  = Shards[n]->ListReadLock();
+            LLCursor                  Found = Shards[n]->ListFindCursor(pKey);
+
+            if (Found != Shards[n]->end())
+            {
+                memcpy(pRecord, *Found, RecordLength);
+                return true;
+            }
+        }
+        else
+        {
+            std::unique_lock<LLLock>  Hold = Shards[n]->ListWriteLock();
+
+            if (Shards[n]->ListFind(pKey) == true)
+            {
+                memcpy(pRecord, Shards[n]->pUserCurrentElement, RecordLength);
+                *pToken = Token(n, Shards[n]->GetDirectToken());
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Sum of the shard counts, each read under its shard lock.
+ *    The shards are not held together, so while other threads add and
+ *    delete the total is only as of some moment during the call.
+ *------------------------------------------------------------------
+*/
+long LLShard::ElementCount(void)
+{
+    long  Total = 0;
+
+    for (LLMgr *pList : Shards)
+    {
+        std::shared_lock<LLLock>  Hold = pList->ListReadLock();
+
+        Total += pList->ElementCount;
+    }
+    return Total;
+}
@@ -0,0 +1,92 @@
+/**--------------------------------------------------------------
+ * File: LLShard.h
+ *
+ *  Author: Gregory Gannon
+ * Created: 10/17/2026
+ *---------------------------------------------------------------------
+ * HISTORY
+ *
+ *	 Date       Author      Change Description
+ *   ----		------		------------------
+ * 10/17/2026    GMG        Developed the sharded list container
+ *
+ * PURPOSE
+ *    One logical list spread over Count independent LLMgr lists (shards)
+ *    so threads working on different shards never meet on a lock.  Every
+ *    shard is registered with LL_OPTION_THREADSAFE and has its own slab,
+ *    indexes, lock and add buffer.
+ *
+ *    A record goes to a shard one of two ways, chosen at registration:
+ *      LL_SHARD_BYKEY    - the high bits of the hash of its key, so a key
+ *                          is always in one shard and ShardFind() looks
+ *                          in that shard only.
+ *      LL_SHARD_BYTHREAD - the home shard of the adding thread, so the
+ *                          adds of a thread stay apart from the others.
+ *                          ShardFind() looks in every shard.
+ *
+ *    A shard token is a DirectToken_t from the shard with the shard
+ *    number in the high half of Address - the slot or index of a classic
+ *    or dense list is only 32 bits.  ShardGet() and ShardRemove() go
+ *    straight to the shard of a token and check it there like
+ *    SetDirectPointer().  ShardRoute() hands back the shard and its own
+ *    token for anything else.  Unrolled records are named by node
+ *    address and can not be sharded.
+ *
+ *    The LLShard calls fill, add, find and copy out under the shard lock,
+ *    so any thread can call them.  A caller working on Shard(n) directly
+ *    holds its ListWriteLock() across the run of calls.
+ *----------------------------------------------------------------------
+*/
+#ifndef LLSHARD_H
+#define LLSHARD_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "LLMgr.h"
+
+#define  LL_SHARD_MAX           256             // Shards in one container at most
+#define  LL_SHARD_SHIFT         32              // Shard number position in a shard token Address
+
+static_assert(sizeof(uintptr_t) >= 8, "A shard token needs a 64 bit Address");
+
+enum  LL_SHARDBY {
+      LL_SHARD_BYKEY     = 0,
+      LL_SHARD_BYTHREAD  = 1,
+};
+
+class  LLShard
+{
+  protected:
+
+    std::vector<LLMgr *>  Shards;               /// One list each - apart on the heap so their locks do not share a line
+    int           ShardBy;                      /// LL_SHARD_BYKEY or LL_SHARD_BYTHREAD
+    long          RecordLength;                 /// User data area of every shard
+    long          KeyOffset;                    /// Key in the user data area, KeyLength 0 when there is none
+    long          KeyLength;
+
+    bool          Register(int, long, std::string, long, long, int, int);
+    DirectToken_t Token(int, DirectToken_t);    /// Shard token from a shard's own token
+
+  public:
+    bool          ShardRegister(int, long, std::string, long, long, int = LL_OPTION_NONE, int = LL_SHARD_BYKEY); /// Count, size, name, key offset and length
+    bool          ShardRegister(int, long, std::string, int = LL_OPTION_NONE);     /// Count, size, name - by thread, no key
+    bool          ShardDeleteAll(void);                                           /// Empty every shard
+    bool          ShardDeregister(void);                                          /// Every shard must be empty
+    int           ShardOf(const void *);        /// Shard of a key, -1 when records do not go by key
+    int           ShardHome(void);              /// Home shard of the calling thread
+    int           ShardRoute(DirectToken_t *);  /// Shard of a shard token, the token becomes the shard's own - -1 if bad
+    DirectToken_t ShardAdd(const void *);       /// Copy a record in - its shard token, Magic 0 on failure
+    bool          ShardGet(DirectToken_t, void *);                               /// Copy out the record of a token
+    bool          ShardFind(const void *, void *, DirectToken_t * = NULL);       /// Copy out a record with the key and its token
+    bool          ShardRemove(DirectToken_t);   /// Delete the record of a token
+    long          ElementCount(void);           /// Records in every shard
+    int           ShardCount(void) { return (int) Shards.size(); }
+    LLMgr        &Shard(int n) { return *Shards[n]; }
+                  LLShard();
+                  ~LLShard();
+                  LLShard(const LLShard &) = delete;
+                  LLShard &operator=(const LLShard &) = delete;
+};
+
+#endif
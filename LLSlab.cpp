@@ -0,0 +1,197 @@
+/**----------------------------------------------------------------
+ * File:LLSlab.cpp
+ *
+ * Author: Gregory Gannon
+ *
+ * PURPOSE
+ *
+ *  Fixed size element allocator used by the Linked list manager.
+ *    The chunks are malloc()ed and the elements are carved from the
+ *    newest chunk as they are needed.  Deleted elements go on the free
+ *    list and are reused before anything new is carved.
+ *
+ * UPDATES:
+ *
+ * GMG   10-17-2026    Created for the per list slab allocation.
+ * GMG   10-17-2026    SlabAllocRun() carves a block of elements for the batch add.
+ * GMG   10-17-2026    RefCount starts at 1 for the owning list, splice targets add holds.
+ *-------------------------------------------------------------
+*/
+
+#include <stdlib.h>
+#include "LLSlab.h"
+
+//--------------------------------------------------------------------
+// Constructor - an empty slab with no element size set
+//--------------------------------------------------------------------
+
+LLSlab::LLSlab()
+{
+    pChunkList        = NULL;
+    pFreeList         = NULL;
+    pCarve            = NULL;
+    pCarveEnd         = NULL;
+    ElementStride     = 0;
+    NextChunkElements = 0;
+    ChunkCount        = 0;
+    FreeCount         = 0;
+    RefCount          = 1;
+}
+
+LLSlab::~LLSlab()
+{
+    SlabRelease();
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Set the size of the elements handed out by the slab.
+ *    The stride is rounded so every element starts on an
+ *    LL_SLAB_ALIGN boundary.  Any chunks held are released.
+ *------------------------------------------------------------------
+*/
+bool LLSlab::SlabInit(size_t ElementLength)
+{
+    if (ElementLength < sizeof(void *))
+    {
+        return false;
+    }
+
+    ElementStride = (ElementLength + LL_SLAB_ALIGN - 1) & ~(size_t)(LL_SLAB_ALIGN - 1);
+
+    SlabRelease();                                               // Drop old chunks and size the first new one
+    return true;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Allocate a new chunk with room for at least Elements.
+ *    What is left of the current chunk goes on the free list so
+ *    nothing is lost, then the new chunk becomes the carve area.
+ *    Chunk sizes double until they reach LL_SLAB_MAXCHUNK.
+ *------------------------------------------------------------------
+*/
+bool LLSlab::SlabGrow(size_t Elements)
+{
+    SlabChunk_t *pChunk;
+    size_t       Count;
+
+    Count = NextChunkElements;
+
+    if (Count < Elements)
+    {
+        Count = Elements;
+    }
+
+    if ((pChunk = (SlabChunk_t *) malloc(LL_SLAB_CHUNKHEADER + Count * ElementStride)) == NULL)
+    {
+        return false;
+    }
+
+    while (pCarve != pCarveEnd)                                  // Keep the tail of the old chunk
+    {
+        *(void **)pCarve = pFreeList;
+        pFreeList = pCarve;
+        pCarve   += ElementStride;
+    }
+
+    pChunk->pNext    = pChunkList;
+    pChunk->Elements = Count;
+    pChunkList       = pChunk;
+    pCarve           = (char *) pChunk + LL_SLAB_CHUNKHEADER;
+    pCarveEnd        = pCarve + Count * ElementStride;
+
+    FreeCount  += (long) Count;
+    ChunkCount += 1;
+
+    if (NextChunkElements * ElementStride < LL_SLAB_MAXCHUNK)
+    {
+        NextChunkElements *= 2;
+    }
+    return true;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Reserve will make sure Count elements can be handed out
+ *    without going back to the heap.  When they are not already
+ *    there a single chunk with room for all Count is allocated, so
+ *    a batch add that follows is carved from that one chunk.
+ *------------------------------------------------------------------
+*/
+bool LLSlab::SlabReserve(long Count)
+{
+    if (ElementStride == 0)
+    {
+        return false;
+    }
+
+    if (Count <= FreeCount)
+    {
+        return true;
+    }
+
+    return SlabGrow((size_t) Count);
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Carve Count elements that sit back to back in the same
+ *    chunk.  They are not taken from the free list.  When the current
+ *    chunk is too short a new one is sized to hold the whole run.
+ *    Returns the first element or NULL when the chunk can't be had.
+ *------------------------------------------------------------------
+*/
+void *LLSlab::SlabAllocRun(size_t Count)
+{
+    char *pRun;
+
+    if (ElementStride == 0 || Count == 0)
+    {
+        return NULL;
+    }
+
+    if ((size_t)(pCarveEnd - pCarve) < Count * ElementStride && SlabGrow(Count) == false)
+    {
+        return NULL;
+    }
+
+    pRun       = pCarve;
+    pCarve    += Count * ElementStride;
+    FreeCount -= (long) Count;
+
+    return pRun;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Free every chunk.  Any element handed out by the slab is
+ *    invalid once this is called.
+ *------------------------------------------------------------------
+*/
+void LLSlab::SlabRelease(void)
+{
+    SlabChunk_t *pChunk;
+
+    while ((pChunk = pChunkList) != NULL)
+    {
+        pChunkList = pChunk->pNext;
+        free(pChunk);
+    }
+
+    pFreeList  = NULL;
+    pCarve     = NULL;
+    pCarveEnd  = NULL;
+    ChunkCount = 0;
+    FreeCount  = 0;
+
+    if (ElementStride != 0)
+    {
+        NextChunkElements = LL_SLAB_CHUNKBYTES / ElementStride;
+
+        if (NextChunkElements < LL_SLAB_MINELEMENTS)
+        {
+            NextChunkElements = LL_SLAB_MINELEMENTS;
+        }
+    }
+}
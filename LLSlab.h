@@ -0,0 +1,111 @@
+/**--------------------------------------------------------------
+ * File: LLSlab.h
+ *
+ *  Author: Gregory Gannon
+ * Created: 10/17/2026
+ *---------------------------------------------------------------------
+ * HISTORY
+ *
+ *	 Date       Author      Change Description
+ *   ----		------		------------------
+ * 10/17/2026    GMG        Developed the slab allocator for the list elements
+ * 10/17/2026    GMG        Added SlabAllocRun() for batch adds
+ * 10/17/2026    GMG        Reference count so a slab outlives its list while other lists hold its elements
+ *
+ * PURPOSE
+ *    Every element in a registered list is the same size, so the Linked list
+ *    manager does not need the heap for each add and delete.  The slab carves
+ *    elements out of large chunks and keeps deleted elements on an intrusive
+ *    free list (the first pointer of the free element is the link) so they are
+ *    handed back out on the next add.  Chunks are only returned to the heap
+ *    when the slab is released.
+ *----------------------------------------------------------------------
+*/
+#ifndef LLSLAB_H
+#define LLSLAB_H
+
+#include <stddef.h>
+
+#define  LL_SLAB_ALIGN        16                // Element stride alignment - keeps the user area aligned like malloc()
+#define  LL_SLAB_CHUNKBYTES   65536             // First chunk size, later chunks double up to LL_SLAB_MAXCHUNK
+#define  LL_SLAB_MAXCHUNK     (2 * 1024 * 1024) // Largest chunk carved by the slab
+#define  LL_SLAB_MINELEMENTS  16                // A chunk always holds at least this many elements
+
+/*
+ *----------------------------------------------------------------------
+ * Header at the front of each chunk.  Padded so the first element
+ *      in the chunk starts on an LL_SLAB_ALIGN boundary.
+ *--------------------------------------------------------------------
+*/
+typedef struct SlabChunk_s {
+    struct SlabChunk_s *pNext;                  /// Next chunk owned by the slab
+    size_t              Elements;               /// Number of elements carved from this chunk
+}  SlabChunk_t;
+
+#define  LL_SLAB_CHUNKHEADER  ((sizeof(SlabChunk_t) + LL_SLAB_ALIGN - 1) & ~(size_t)(LL_SLAB_ALIGN - 1))
+
+class  LLSlab
+{
+  protected:
+
+    SlabChunk_t *pChunkList;                    /// All chunks allocated by this slab
+    void        *pFreeList;                     /// Intrusive list of returned elements
+    char        *pCarve;                        /// Next uncarved element in the newest chunk
+    char        *pCarveEnd;                     /// End of the newest chunk
+    size_t       ElementStride;                 /// Element length rounded up to LL_SLAB_ALIGN
+    size_t       NextChunkElements;             /// Elements to carve from the next chunk
+
+    bool         SlabGrow(size_t);              /// Get a new chunk with room for at least n elements
+
+  public:
+    long         ChunkCount;                    /// Chunks owned by the slab
+    long         FreeCount;                     /// Elements on the free list or still uncarved
+    long         RefCount;                      /// The owning list plus every list holding elements from this slab
+
+    bool         SlabInit(size_t);              /// Set the element length - slab must be empty
+    bool         SlabReserve(long);             /// Pre-fill so n elements can be handed out without a chunk allocation
+    void        *SlabAllocRun(size_t);          /// n elements back to back in one chunk - ElementStride apart
+    size_t       SlabStride(void) { return ElementStride; }
+    void         SlabHold(void)   { ++RefCount; }
+    bool         SlabDrop(void)   { return --RefCount == 0; }         /// True when the caller should delete the slab
+    void         SlabRelease(void);             /// Return every chunk to the heap
+                 LLSlab();
+                 ~LLSlab();
+
+/*
+ *----------------------------------------------------------------------
+ * The add and delete paths call these for every element so they are
+ *      kept inline.  SlabAlloc() returns NULL only when a new chunk
+ *      can not be allocated.
+ *--------------------------------------------------------------------
+*/
+    void *SlabAlloc(void)
+    {
+        void *pElement;
+
+        if ((pElement = pFreeList) != NULL)                  // Reuse a returned element first
+        {
+            pFreeList = *(void **)pElement;
+        }
+        else
+        {
+            if (pCarve == pCarveEnd && SlabGrow(1) == false)
+            {
+                return NULL;
+            }
+            pElement = pCarve;                               // Carve the next element from the chunk
+            pCarve  += ElementStride;
+        }
+        --FreeCount;
+        return pElement;
+    }
+
+    void SlabFree(void *pElement)
+    {
+        *(void **)pElement = pFreeList;                      // First pointer in the element links the free list
+        pFreeList = pElement;
+        ++FreeCount;
+    }
+};
+
+#endif
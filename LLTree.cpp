@@ -0,0 +1,500 @@
+/**----------------------------------------------------------------
+ * File:LLTree.cpp
+ *
+ * Author: Gregory Gannon
+ *
+ * PURPOSE
+ *
+ *  Ordered index used by the Linked list manager for ListSeek().  A
+ *    B+ tree with the keys copied in the nodes, the elements hang off
+ *    the leaves and the leaves are chained for the range scans.
+ *
+ * UPDATES:
+ *
+ * GMG   10-17-2026    Created for the list ordered index.
+ *-------------------------------------------------------------
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "LLTree.h"
+
+//--------------------------------------------------------------------
+// Constructor - TreeInit() sizes the nodes before the first insert
+//--------------------------------------------------------------------
+
+LLTree::LLTree()
+{
+    pRoot     = NULL;
+    KeyLength = 0;
+    EntrySize = 0;
+    LeafCap   = 0;
+    InnerCap  = 0;
+    Compare   = NULL;
+    pScratch  = NULL;
+    Changes   = 0;
+    Count     = 0;
+}
+
+LLTree::~LLTree()
+{
+    TreeClear();
+    free(pScratch);
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Set the key length and compare and work out how many
+ *    entries fit in a node.  Every node is the same size so a leaf
+ *    and an inner node come from the same allocation.
+ *------------------------------------------------------------------
+*/
+bool LLTree::TreeInit(size_t Length, TreeCompare_t KeyCompare)
+{
+    size_t  Header = sizeof(TreeNode_t);
+
+    if (pRoot != NULL || Length == 0)
+    {
+        return false;
+    }
+
+    KeyLength = Length;
+    EntrySize = ((Length + 7) & ~(size_t) 7) + sizeof(void *);
+    Compare   = KeyCompare;
+
+    LeafCap  = (int)((LL_TREE_NODEBYTES - Header) / EntrySize);
+    InnerCap = (int)((LL_TREE_NODEBYTES - Header - sizeof(void *)) / (EntrySize + sizeof(void *)));
+
+    if (LeafCap < LL_TREE_MINENTRIES)
+    {
+        LeafCap = LL_TREE_MINENTRIES;
+    }
+    if (InnerCap < LL_TREE_MINENTRIES)
+    {
+        InnerCap = LL_TREE_MINENTRIES;
+    }
+
+    free(pScratch);                                             // One more than a full node and a separator
+    pScratch = (char *) malloc((LeafCap + InnerCap + 3) * EntrySize + (InnerCap + 2) * sizeof(void *));
+
+    return pScratch != NULL;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Node layout helpers
+ *------------------------------------------------------------------
+*/
+char *LLTree::Entry(TreeNode_t *pNode, int i)
+{
+    return (char *) pNode + sizeof(TreeNode_t) + i * EntrySize;
+}
+
+TreeNode_t **LLTree::Child(TreeNode_t *pNode, int i)
+{
+    return (TreeNode_t **)((char *) pNode + sizeof(TreeNode_t) + InnerCap * EntrySize) + i;
+}
+
+static void *EntryElement(const char *pEntry, size_t EntrySize)
+{
+    return *(void **)(pEntry + EntrySize - sizeof(void *));
+}
+
+TreeNode_t *LLTree::NewNode(bool Leaf)
+{
+    size_t       LeafBytes  = LeafCap * EntrySize;
+    size_t       InnerBytes = InnerCap * EntrySize + (InnerCap + 1) * sizeof(void *);
+    TreeNode_t  *pNode;
+
+    if ((pNode = (TreeNode_t *) malloc(sizeof(TreeNode_t) + (LeafBytes > InnerBytes ? LeafBytes : InnerBytes))) != NULL)
+    {
+        pNode->pNext = NULL;
+        pNode->pPrev = NULL;
+        pNode->Leaf  = Leaf ? 1 : 0;
+        pNode->Count = 0;
+    }
+    return pNode;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Order of (pKey, pElement) against an entry.  Keys first,
+ *    then the element address.  A NULL element is below every entry
+ *    with the same key.
+ *------------------------------------------------------------------
+*/
+int LLTree::EntryCompare(const void *pKey, void *pElement, const char *pEntry)
+{
+    int     Result = (Compare != NULL) ? Compare(pKey, pEntry) : memcmp(pKey, pEntry, KeyLength);
+    void   *pOther;
+
+    if (Result != 0)
+    {
+        return Result;
+    }
+
+    pOther = EntryElement(pEntry, EntrySize);
+    return ((uintptr_t) pElement < (uintptr_t) pOther) ? -1 : ((uintptr_t) pElement > (uintptr_t) pOther) ? 1 : 0;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Binary search of a node.  Returns how many entries are
+ *    below (pKey, pElement), or with Upper how many are at or below it.
+ *    In an inner node the Upper count is the child to follow.
+ *------------------------------------------------------------------
+*/
+int LLTree::Position(TreeNode_t *pNode, const void *pKey, void *pElement, bool Upper)
+{
+    int  Low  = 0;
+    int  High = pNode->Count;
+    int  Mid;
+    int  Result;
+
+    while (Low < High)
+    {
+        Mid    = (Low + High) / 2;
+        Result = EntryCompare(pKey, pElement, Entry(pNode, Mid));
+
+        if (Result > 0 || (Upper == true && Result == 0))
+        {
+            Low = Mid + 1;
+        }
+        else
+        {
+            High = Mid;
+        }
+    }
+    return Low;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Add (pKey, pElement).  The nodes a split will need are
+ *    allocated before anything changes so a failure leaves the tree as
+ *    it was.  A full node is split in half through pScratch and the
+ *    first entry of the right half goes up as the separator.
+ *------------------------------------------------------------------
+*/
+bool LLTree::TreeInsert(const void *pKey, void *pElement)
+{
+    TreeNode_t  *Path[LL_TREE_MAXHEIGHT];
+    int          Slot[LL_TREE_MAXHEIGHT];
+    TreeNode_t  *Spare[LL_TREE_MAXHEIGHT + 1];
+    TreeNode_t  *pNode;
+    TreeNode_t  *pRight;
+    char        *pSeparator;
+    int          Height = 0;
+    int          Needed;
+    int          Pos;
+    int          Half;
+
+    if (pRoot == NULL && (pRoot = NewNode(true)) == NULL)
+    {
+        return false;
+    }
+
+    for (pNode = pRoot; pNode->Leaf == 0; pNode = *Child(pNode, Slot[Height++]))
+    {
+        Path[Height] = pNode;
+        Slot[Height] = Position(pNode, pKey, pElement, true);
+    }
+//
+//  Simple case - room in the leaf
+//
+    Pos = Position(pNode, pKey, pElement, false);
+
+    if (pNode->Count < LeafCap)
+    {
+        memmove(Entry(pNode, Pos + 1), Entry(pNode, Pos), (pNode->Count - Pos) * EntrySize);
+        memcpy(Entry(pNode, Pos), pKey, KeyLength);
+        *(void **)(Entry(pNode, Pos) + EntrySize - sizeof(void *)) = pElement;
+        ++pNode->Count;
+        ++Count;
+        ++Changes;
+        return true;
+    }
+//
+//  Splits - one node for the leaf, one for each full inner node above it and a new root if they all are
+//
+    Needed = 1;
+    while (Needed <= Height && Path[Height - Needed]->Count == InnerCap)
+    {
+        ++Needed;
+    }
+    if (Needed > Height)
+    {
+        ++Needed;
+    }
+
+    for (int i = 0; i < Needed; ++i)
+    {
+        if ((Spare[i] = NewNode(i == 0)) == NULL)
+        {
+            while (i-- > 0)
+            {
+                free(Spare[i]);
+            }
+            return false;
+        }
+    }
+    Needed = 0;
+//
+//  Leaf split - the full leaf plus the new entry laid out in pScratch then dealt to the two halves
+//
+    char *pAll = pScratch;
+
+    memcpy(pAll, Entry(pNode, 0), Pos * EntrySize);
+    memcpy(pAll + Pos * EntrySize, pKey, KeyLength);
+    *(void **)(pAll + (Pos + 1) * EntrySize - sizeof(void *)) = pElement;
+    memcpy(pAll + (Pos + 1) * EntrySize, Entry(pNode, Pos), (LeafCap - Pos) * EntrySize);
+
+    pRight = Spare[Needed++];
+    Half   = (LeafCap + 1) / 2;
+
+    memcpy(Entry(pNode, 0), pAll, Half * EntrySize);
+    memcpy(Entry(pRight, 0), pAll + Half * EntrySize, (LeafCap + 1 - Half) * EntrySize);
+    pNode->Count  = Half;
+    pRight->Count = LeafCap + 1 - Half;
+
+    pRight->pNext = pNode->pNext;
+    pRight->pPrev = pNode;
+    if (pNode->pNext != NULL)
+    {
+        pNode->pNext->pPrev = pRight;
+    }
+    pNode->pNext = pRight;
+
+    pSeparator = pScratch + (LeafCap + 1) * EntrySize;          // Kept apart from the inner node work area
+    memcpy(pSeparator, Entry(pRight, 0), EntrySize);
+//
+//  Carry the separator and the new right node up the path
+//
+    while (Height > 0)
+    {
+        TreeNode_t  *pParent = Path[--Height];
+        int          At      = Slot[Height];
+
+        if (pParent->Count < InnerCap)
+        {
+            memmove(Entry(pParent, At + 1), Entry(pParent, At), (pParent->Count - At) * EntrySize);
+            memcpy(Entry(pParent, At), pSeparator, EntrySize);
+            memmove(Child(pParent, At + 2), Child(pParent, At + 1), (pParent->Count - At) * sizeof(void *));
+            *Child(pParent, At + 1) = pRight;
+            ++pParent->Count;
+            pRight = NULL;
+            break;
+        }
+
+        char        *pSeps     = pSeparator + EntrySize;
+        TreeNode_t **pChildren = (TreeNode_t **)(pSeps + (InnerCap + 1) * EntrySize);
+        TreeNode_t  *pNewInner = Spare[Needed++];
+
+        memcpy(pSeps, Entry(pParent, 0), At * EntrySize);
+        memcpy(pSeps + At * EntrySize, pSeparator, EntrySize);
+        memcpy(pSeps + (At + 1) * EntrySize, Entry(pParent, At), (InnerCap - At) * EntrySize);
+        memcpy(pChildren, Child(pParent, 0), (At + 1) * sizeof(void *));
+        pChildren[At + 1] = pRight;
+        memcpy(pChildren + At + 2, Child(pParent, At + 1), (InnerCap - At) * sizeof(void *));
+
+        Half = (InnerCap + 1) / 2;                              // Separator Half goes up
+        memcpy(Entry(pParent, 0), pSeps, Half * EntrySize);
+        memcpy(Child(pParent, 0), pChildren, (Half + 1) * sizeof(void *));
+        pParent->Count = Half;
+
+        pNewInner->Count = InnerCap - Half;
+        memcpy(Entry(pNewInner, 0), pSeps + (Half + 1) * EntrySize, pNewInner->Count * EntrySize);
+        memcpy(Child(pNewInner, 0), pChildren + Half + 1, (pNewInner->Count + 1) * sizeof(void *));
+
+        memcpy(pSeparator, pSeps + Half * EntrySize, EntrySize);
+        pRight = pNewInner;
+    }
+//
+//  The root split - a new root over the two halves
+//
+    if (pRight != NULL)
+    {
+        TreeNode_t  *pNewRoot = Spare[Needed++];
+
+        pNewRoot->Count = 1;
+        memcpy(Entry(pNewRoot, 0), pSeparator, EntrySize);
+        *Child(pNewRoot, 0) = pRoot;
+        *Child(pNewRoot, 1) = pRight;
+        pRoot = pNewRoot;
+    }
+
+    ++Count;
+    ++Changes;
+    return true;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Take child At out of an inner node with one of the
+ *    separators next to it.  Path and Slot lead to the node, when it
+ *    is left with no children it goes as well.
+ *------------------------------------------------------------------
+*/
+void LLTree::RemoveChild(TreeNode_t **Path, int *Slot, int Height)
+{
+    while (Height > 0)
+    {
+        TreeNode_t  *pParent = Path[--Height];
+        int          At      = Slot[Height];
+        int          Sep     = (At > 0) ? At - 1 : 0;
+
+        if (pParent->Count > 0)
+        {
+            memmove(Entry(pParent, Sep), Entry(pParent, Sep + 1), (pParent->Count - Sep - 1) * EntrySize);
+            memmove(Child(pParent, At), Child(pParent, At + 1), (pParent->Count - At) * sizeof(void *));
+            --pParent->Count;
+            return;
+        }
+
+        if (pParent == pRoot)                                   // Its only child went - the tree is empty
+        {
+            free(pRoot);
+            pRoot = NULL;
+            return;
+        }
+        free(pParent);
+    }
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Remove (pKey, pElement).  An empty leaf is unchained and
+ *    taken out of its parent.  A root with one child is replaced by
+ *    the child.
+ *------------------------------------------------------------------
+*/
+bool LLTree::TreeErase(const void *pKey, void *pElement)
+{
+    TreeNode_t  *Path[LL_TREE_MAXHEIGHT];
+    int          Slot[LL_TREE_MAXHEIGHT];
+    TreeNode_t  *pNode;
+    int          Height = 0;
+    int          Pos;
+
+    if (pRoot == NULL)
+    {
+        return false;
+    }
+
+    for (pNode = pRoot; pNode->Leaf == 0; pNode = *Child(pNode, Slot[Height++]))
+    {
+        Path[Height] = pNode;
+        Slot[Height] = Position(pNode, pKey, pElement, true);
+    }
+
+    Pos = Position(pNode, pKey, pElement, false);
+
+    if (Pos == pNode->Count || EntryCompare(pKey, pElement, Entry(pNode, Pos)) != 0)
+    {
+        return false;
+    }
+
+    memmove(Entry(pNode, Pos), Entry(pNode, Pos + 1), (pNode->Count - Pos - 1) * EntrySize);
+    --pNode->Count;
+    --Count;
+    ++Changes;
+
+    if (pNode->Count == 0 && pNode != pRoot)
+    {
+        if (pNode->pPrev != NULL)
+        {
+            pNode->pPrev->pNext = pNode->pNext;
+        }
+        if (pNode->pNext != NULL)
+        {
+            pNode->pNext->pPrev = pNode->pPrev;
+        }
+        free(pNode);
+        RemoveChild(Path, Slot, Height);
+    }
+
+    while (pRoot != NULL && pRoot->Leaf == 0 && pRoot->Count == 0)
+    {
+        pNode = pRoot;
+        pRoot = *Child(pNode, 0);
+        free(pNode);
+    }
+    return true;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Position the cursor.  With a NULL pAfter it is on the
+ *    first entry with a key >= pKey, otherwise on the first entry after
+ *    (pKey, pAfter).  Returns the element or NULL at the end.
+ *------------------------------------------------------------------
+*/
+void *LLTree::TreeSeek(const void *pKey, void *pAfter, TreeCursor_t *pCursor)
+{
+    TreeNode_t  *pNode;
+
+    pCursor->pLeaf   = NULL;
+    pCursor->Changes = Changes;
+
+    if (pRoot == NULL)
+    {
+        return NULL;
+    }
+
+    for (pNode = pRoot; pNode->Leaf == 0; pNode = *Child(pNode, Position(pNode, pKey, pAfter, true)))
+    {
+    }
+
+    pCursor->pLeaf = pNode;
+    pCursor->Slot  = Position(pNode, pKey, pAfter, pAfter != NULL) - 1;    // TreeNext() steps on to it
+
+    return TreeNext(pCursor);
+}
+
+void *LLTree::TreeNext(TreeCursor_t *pCursor)
+{
+    if (pCursor->pLeaf == NULL || pCursor->Changes != Changes)
+    {
+        return NULL;
+    }
+
+    if (++pCursor->Slot >= pCursor->pLeaf->Count)
+    {
+        pCursor->pLeaf = pCursor->pLeaf->pNext;                 // Only the root leaf is ever empty
+        pCursor->Slot  = 0;
+
+        if (pCursor->pLeaf == NULL)
+        {
+            return NULL;
+        }
+    }
+    return EntryElement(Entry(pCursor->pLeaf, pCursor->Slot), EntrySize);
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Free every node
+ *------------------------------------------------------------------
+*/
+void LLTree::FreeNodes(TreeNode_t *pNode)
+{
+    if (pNode->Leaf == 0)
+    {
+        for (int i = 0; i <= pNode->Count; ++i)
+        {
+            FreeNodes(*Child(pNode, i));
+        }
+    }
+    free(pNode);
+}
+
+void LLTree::TreeClear(void)
+{
+    if (pRoot != NULL)
+    {
+        FreeNodes(pRoot);
+        pRoot = NULL;
+    }
+    Count = 0;
+    ++Changes;
+}
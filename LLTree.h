@@ -0,0 +1,100 @@
+/**--------------------------------------------------------------
+ * File: LLTree.h
+ *
+ *  Author: Gregory Gannon
+ * Created: 10/17/2026
+ *---------------------------------------------------------------------
+ * HISTORY
+ *
+ *	 Date       Author      Change Description
+ *   ----		------		------------------
+ * 10/17/2026    GMG        Developed the ordered index for ListSeek()
+ *
+ * PURPOSE
+ *    B+ tree of (key, element) entries used by the Linked list manager
+ *    to find elements in key order.  A copy of the key is kept in the
+ *    tree so a search compares keys packed next to each other in the
+ *    node and only touches the list element it ends up on.  Nodes are
+ *    about LL_TREE_NODEBYTES so a node is a few cache lines.
+ *
+ *    Entries with the same key are kept in element address order so
+ *    every entry is unique and a delete goes straight to its entry.
+ *    The leaves are chained both ways for range scans.
+ *
+ *    A delete only frees a node when it is empty.  Nodes are not merged
+ *    with their neighbours.
+ *----------------------------------------------------------------------
+*/
+#ifndef LLTREE_H
+#define LLTREE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define  LL_TREE_NODEBYTES    512               // Target node size - keys and pointers
+#define  LL_TREE_MINENTRIES   4                 // Nodes hold at least this many entries however long the key
+#define  LL_TREE_MAXHEIGHT    32                // Deeper than any tree that fits in memory
+
+typedef int (*TreeCompare_t)(const void *, const void *);
+
+/*
+ *----------------------------------------------------------------------
+ * Front of every node.  The entries follow - KeyLength bytes of key
+ *      rounded to 8 then the element pointer.  An inner node has
+ *      Count separator entries then Count + 1 child pointers.
+ *--------------------------------------------------------------------
+*/
+typedef struct TreeNode_s {
+    struct TreeNode_s *pNext;                   /// Leaf chain - next leaf
+    struct TreeNode_s *pPrev;                   /// Leaf chain - previous leaf
+    int                Leaf;                    /// 1 for a leaf
+    int                Count;                   /// Entries in a leaf, separators in an inner node
+}  TreeNode_t;
+
+/*
+ *----------------------------------------------------------------------
+ * Position of TreeSeek() / TreeNext().  Only good while Changes matches
+ *      the tree, any insert or erase moves entries around.
+ *--------------------------------------------------------------------
+*/
+typedef struct {
+    TreeNode_t    *pLeaf;
+    int            Slot;
+    unsigned long  Changes;
+}  TreeCursor_t;
+
+class  LLTree
+{
+  protected:
+
+    TreeNode_t   *pRoot;
+    size_t        KeyLength;                    /// Bytes of key copied in each entry
+    size_t        EntrySize;                    /// Key rounded to 8 plus the element pointer
+    int           LeafCap;                      /// Entries in a full leaf
+    int           InnerCap;                     /// Separators in a full inner node
+    TreeCompare_t Compare;                      /// Key compare - memcmp() when NULL
+    char         *pScratch;                     /// Room for an inner node plus one while it is split
+
+    char         *Entry(TreeNode_t *, int);
+    TreeNode_t  **Child(TreeNode_t *, int);
+    int           EntryCompare(const void *, void *, const char *);
+    int           Position(TreeNode_t *, const void *, void *, bool);
+    TreeNode_t   *NewNode(bool);
+    void          FreeNodes(TreeNode_t *);
+    void          RemoveChild(TreeNode_t **, int *, int);
+
+  public:
+    unsigned long Changes;                      /// Bumped by every insert, erase and clear
+    size_t        Count;                        /// Entries in the tree
+
+    bool          TreeInit(size_t, TreeCompare_t);                      /// Key length and compare, tree must be empty
+    bool          TreeInsert(const void *, void *);                     /// Add (key, element) - false when a node can't be had
+    bool          TreeErase(const void *, void *);                      /// Remove (key, element) - false when not there
+    void         *TreeSeek(const void *, void *, TreeCursor_t *);       /// First entry >= key, or > (key, element)
+    void         *TreeNext(TreeCursor_t *);                             /// Entry after the cursor or NULL
+    void          TreeClear(void);                                      /// Free every node
+                  LLTree();
+                  ~LLTree();
+};
+
+#endif
@@ -0,0 +1,507 @@
+/**----------------------------------------------------------------
+ * File:LLUnroll.cpp
+ *
+ * Author: Gregory Gannon
+ *
+ * PURPOSE
+ *
+ *  Unrolled storage used by the Linked list manager for lists registered
+ *    with LL_OPTION_UNROLLED.  Records live in list order in the slots of
+ *    page sized nodes.
+ *
+ * UPDATES:
+ *
+ * GMG   10-17-2026    Created for the unrolled storage mode.
+ *-------------------------------------------------------------
+*/
+
+#include <string.h>
+#include "LLUnroll.h"
+
+//--------------------------------------------------------------------
+// Constructor - no nodes until the first insert
+//--------------------------------------------------------------------
+
+LLUnroll::LLUnroll()
+{
+    pFirst       = NULL;
+    pLast        = NULL;
+    RecordLength = 0;
+    SlotStride   = 0;
+    SlotOffset   = 0;
+    Capacity     = 0;
+    Count        = 0;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Size the nodes for records of Length bytes.  As many slots
+ *    as fit in LL_UNROLL_NODEBYTES, but never fewer than
+ *    LL_UNROLL_MINRECORDS - big records make bigger nodes.
+ *------------------------------------------------------------------
+*/
+bool LLUnroll::UnrollInit(size_t Length)
+{
+    RecordLength = Length;
+    SlotStride   = sizeof(uint64_t) + ((Length + 7) & ~(size_t) 7);
+    SlotOffset   = (sizeof(UnrollNode_t) + 7) & ~(size_t) 7;
+    Capacity     = (int)((LL_UNROLL_NODEBYTES - SlotOffset) / SlotStride);
+
+    if (Capacity < LL_UNROLL_MINRECORDS)
+    {
+        Capacity = LL_UNROLL_MINRECORDS;
+    }
+    if (Capacity > LL_UNROLL_MAXRECORDS)
+    {
+        Capacity = LL_UNROLL_MAXRECORDS;
+    }
+
+    return NodeSlab.SlabInit(SlotOffset + Capacity * SlotStride);
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Get an empty node and link it between pPrev and pNext,
+ *    either can be NULL at the ends.  The slots are not cleared.
+ *------------------------------------------------------------------
+*/
+UnrollNode_t *LLUnroll::NewNode(UnrollNode_t *pPrev, UnrollNode_t *pNext)
+{
+    UnrollNode_t  *pNode;
+
+    if ((pNode = (UnrollNode_t *) NodeSlab.SlabAlloc()) == NULL)
+    {
+        return NULL;
+    }
+
+    memset(pNode->Ids, 0, sizeof(pNode->Ids));
+    pNode->Live   = LL_UNROLL_LIVE;
+    pNode->Count  = 0;
+    pNode->Start  = 0;
+    pNode->NextId = 0;
+    pNode->pPrev  = pPrev;
+    pNode->pNext  = pNext;
+
+    if (pPrev != NULL)
+    {
+        pPrev->pNext = pNode;
+    }
+    else
+    {
+        pFirst = pNode;
+    }
+
+    if (pNext != NULL)
+    {
+        pNext->pPrev = pNode;
+    }
+    else
+    {
+        pLast = pNode;
+    }
+    return pNode;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Unlink a node and give it back to the slab.  It is marked
+ *    dead first so a token for one of its records is turned down.
+ *------------------------------------------------------------------
+*/
+void LLUnroll::FreeNode(UnrollNode_t *pNode)
+{
+    if (pNode->pPrev != NULL)
+    {
+        pNode->pPrev->pNext = pNode->pNext;
+    }
+    else
+    {
+        pFirst = pNode->pNext;
+    }
+
+    if (pNode->pNext != NULL)
+    {
+        pNode->pNext->pPrev = pNode->pPrev;
+    }
+    else
+    {
+        pLast = pNode->pPrev;
+    }
+
+    pNode->Live = 0;
+    NodeSlab.SlabFree(pNode);
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Take an id no record of the node has and put it in the low
+ *    bits of Tag.  There are more ids than slots so one is always free,
+ *    and the search starts after the last id handed out.
+ *------------------------------------------------------------------
+*/
+uint64_t LLUnroll::NewId(UnrollNode_t *pNode, uint64_t Tag)
+{
+    uint32_t  Id = pNode->NextId;
+
+    while (((pNode->Ids[Id >> 6] >> (Id & 63)) & 1) != 0)
+    {
+        Id = (Id + 1) & LL_UNROLL_IDMASK;
+    }
+
+    pNode->Ids[Id >> 6] |= (uint64_t) 1 << (Id & 63);
+    pNode->NextId        = (Id + 1) & LL_UNROLL_IDMASK;
+
+    return (Tag & ~(uint64_t) LL_UNROLL_IDMASK) | Id;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Make room for Number records in front of the record at Pos
+ *    (Pos == Count is the end).  The shorter side of the run slides if
+ *    there is room on its side, otherwise the run is moved to the
+ *    middle of the node with the gap in it.  The node must have room.
+ *------------------------------------------------------------------
+*/
+void LLUnroll::OpenGap(UnrollNode_t *pNode, int Pos, int Number)
+{
+    int  Start   = pNode->Start;
+    int  Records = pNode->Count;
+    int  NewStart;
+
+    if (Pos < Records - Pos && Start >= Number)
+    {
+        memmove(SlotTag(pNode, Start - Number), SlotTag(pNode, Start), Pos * SlotStride);
+        pNode->Start = (uint16_t)(Start - Number);
+    }
+    else if (Pos >= Records - Pos && Start + Records + Number <= Capacity)
+    {
+        memmove(SlotTag(pNode, Start + Pos + Number), SlotTag(pNode, Start + Pos), (Records - Pos) * SlotStride);
+    }
+    else
+    {
+        NewStart = (Capacity - Records - Number) / 2;
+
+        if (NewStart <= Start)                          // Going down - the front part first
+        {
+            memmove(SlotTag(pNode, NewStart), SlotTag(pNode, Start), Pos * SlotStride);
+            memmove(SlotTag(pNode, NewStart + Pos + Number), SlotTag(pNode, Start + Pos), (Records - Pos) * SlotStride);
+        }
+        else                                            // Going up - the back part first
+        {
+            memmove(SlotTag(pNode, NewStart + Pos + Number), SlotTag(pNode, Start + Pos), (Records - Pos) * SlotStride);
+            memmove(SlotTag(pNode, NewStart), SlotTag(pNode, Start), Pos * SlotStride);
+        }
+        pNode->Start = (uint16_t) NewStart;
+    }
+    pNode->Count = (uint16_t)(Records + Number);
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Take the Number records at Pos out of the run.  Their ids
+ *    are freed and the shorter side of the run slides over them.
+ *------------------------------------------------------------------
+*/
+void LLUnroll::CloseGap(UnrollNode_t *pNode, int Pos, int Number)
+{
+    int  Start   = pNode->Start;
+    int  Records = pNode->Count;
+
+    for (int i = 0; i < Number; ++i)
+    {
+        uint32_t  Id = (uint32_t)(*SlotTag(pNode, Start + Pos + i) & LL_UNROLL_IDMASK);
+
+        pNode->Ids[Id >> 6] &= ~((uint64_t) 1 << (Id & 63));
+    }
+
+    if (Pos < Records - Pos - Number)
+    {
+        memmove(SlotTag(pNode, Start + Number), SlotTag(pNode, Start), Pos * SlotStride);
+        pNode->Start = (uint16_t)(Start + Number);
+    }
+    else
+    {
+        memmove(SlotTag(pNode, Start + Pos), SlotTag(pNode, Start + Pos + Number), (Records - Pos - Number) * SlotStride);
+    }
+    pNode->Count = (uint16_t)(Records - Number);
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Move the Number records at FromPos in pFrom to ToPos in
+ *    pTo.  pTo must have room.  The records get ids in pTo, so a token
+ *    taken before the move no longer matches.
+ *------------------------------------------------------------------
+*/
+void LLUnroll::MoveRecords(UnrollNode_t *pFrom, int FromPos, int Number, UnrollNode_t *pTo, int ToPos)
+{
+    OpenGap(pTo, ToPos, Number);
+
+    for (int i = 0; i < Number; ++i)
+    {
+        uint64_t  *pSource = SlotTag(pFrom, pFrom->Start + FromPos + i);
+        uint64_t  *pTarget = SlotTag(pTo, pTo->Start + ToPos + i);
+
+        memcpy(pTarget, pSource, SlotStride);
+        *pTarget = NewId(pTo, *pSource);
+    }
+
+    CloseGap(pFrom, FromPos, Number);
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Add a record after (or before) the cursor record, or as
+ *    the only record when the cursor node is NULL.  Tag is the record
+ *    validation number, its low 8 bits are replaced by the id.
+ *
+ *    A full node is split at the insert point.  When the next (or
+ *    previous) node has room at the near end nothing has to move,
+ *    otherwise the smaller side goes to a new node and the record
+ *    goes in at the end of that side.
+ *------------------------------------------------------------------
+*/
+bool LLUnroll::UnrollInsert(UnrollCursor_t *pAt, bool After, const void *pRecord, uint64_t Tag)
+{
+    UnrollNode_t  *pNode = pAt->pNode;
+    UnrollNode_t  *pNew;
+    uint64_t      *pSlot;
+    int            Pos   = pAt->Pos + (After == true ? 1 : 0);
+
+    if (pNode == NULL)
+    {
+        if ((pNode = NewNode(NULL, NULL)) == NULL)
+        {
+            return false;
+        }
+        Pos = 0;
+    }
+    else if (pNode->Count == Capacity)
+    {
+        if (Pos == Capacity && pNode->pNext != NULL && pNode->pNext->Count < Capacity)
+        {
+            pNode = pNode->pNext;                       // Front of the next node
+            Pos   = 0;
+        }
+        else if (Pos == 0 && pNode->pPrev != NULL && pNode->pPrev->Count < Capacity)
+        {
+            pNode = pNode->pPrev;                       // End of the previous node
+            Pos   = pNode->Count;
+        }
+        else if (Pos >= Capacity / 2)
+        {
+            if ((pNew = NewNode(pNode, pNode->pNext)) == NULL)
+            {
+                return false;
+            }
+            MoveRecords(pNode, Pos, pNode->Count - Pos, pNew, 0);
+            pNode = pNew;
+            Pos   = 0;
+        }
+        else
+        {
+            if ((pNew = NewNode(pNode->pPrev, pNode)) == NULL)
+            {
+                return false;
+            }
+            MoveRecords(pNode, 0, Pos, pNew, 0);
+            pNode = pNew;
+        }
+    }
+
+    OpenGap(pNode, Pos, 1);
+    pSlot  = SlotTag(pNode, pNode->Start + Pos);
+    *pSlot = NewId(pNode, Tag);
+    memcpy(pSlot + 1, pRecord, RecordLength);
+    ++Count;
+
+    pAt->pNode = pNode;
+    pAt->Pos   = Pos;
+    return true;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Take out the cursor record.  The cursor moves to the
+ *    record after it, or the one before it when it was the last.  A
+ *    node down to a quarter full is merged into a neighbour.
+ *------------------------------------------------------------------
+*/
+void LLUnroll::UnrollErase(UnrollCursor_t *pAt)
+{
+    UnrollNode_t  *pNode = pAt->pNode;
+    int            Pos   = pAt->Pos;
+
+    CloseGap(pNode, Pos, 1);
+    --Count;
+
+    if (pNode->Count == 0)
+    {
+        pAt->pNode = (pNode->pNext != NULL) ? pNode->pNext : pNode->pPrev;
+        pAt->Pos   = (pNode->pNext != NULL || pNode->pPrev == NULL) ? 0 : pNode->pPrev->Count - 1;
+        FreeNode(pNode);
+        return;
+    }
+
+    if (Pos == pNode->Count)                            // It was the last in the node
+    {
+        if (pNode->pNext != NULL)
+        {
+            pAt->pNode = pNode->pNext;
+            pAt->Pos   = 0;
+        }
+        else
+        {
+            pAt->Pos = Pos - 1;
+        }
+    }
+
+    if (pNode->Count <= Capacity / 4)
+    {
+        Merge(pNode, pAt);
+    }
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Move every record of pNode into the neighbour with fewer
+ *    records if they fit in three quarters of a node, then free pNode.
+ *    The cursor follows its record.
+ *------------------------------------------------------------------
+*/
+void LLUnroll::Merge(UnrollNode_t *pNode, UnrollCursor_t *pAt)
+{
+    UnrollNode_t  *pPrev = pNode->pPrev;
+    UnrollNode_t  *pNext = pNode->pNext;
+    int            Fit   = Capacity * 3 / 4;
+    int            Number = pNode->Count;
+
+    if (pPrev != NULL && pPrev->Count + Number > Fit)
+    {
+        pPrev = NULL;
+    }
+    if (pNext != NULL && pNext->Count + Number > Fit)
+    {
+        pNext = NULL;
+    }
+
+    if (pPrev != NULL && (pNext == NULL || pPrev->Count <= pNext->Count))
+    {
+        int  Base = pPrev->Count;
+
+        MoveRecords(pNode, 0, Number, pPrev, Base);
+        if (pAt->pNode == pNode)
+        {
+            pAt->pNode = pPrev;
+            pAt->Pos  += Base;
+        }
+    }
+    else if (pNext != NULL)
+    {
+        MoveRecords(pNode, 0, Number, pNext, 0);
+        if (pAt->pNode == pNode)
+        {
+            pAt->pNode = pNext;
+        }
+        else if (pAt->pNode == pNext)
+        {
+            pAt->Pos += Number;
+        }
+    }
+    else
+    {
+        return;
+    }
+    FreeNode(pNode);
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Cursor moves.  First and Last fail on an empty list, Next
+ *    and Prev at the ends, and leave the cursor where it was.  The
+ *    steps inside a node are in LLUnroll.h, these cross to a neighbour.
+ *------------------------------------------------------------------
+*/
+bool LLUnroll::UnrollFirst(UnrollCursor_t *pAt)
+{
+    pAt->pNode = pFirst;
+    pAt->Pos   = 0;
+    return pFirst != NULL;
+}
+
+bool LLUnroll::UnrollLast(UnrollCursor_t *pAt)
+{
+    pAt->pNode = pLast;
+    pAt->Pos   = (pLast != NULL) ? pLast->Count - 1 : 0;
+    return pLast != NULL;
+}
+
+bool LLUnroll::UnrollNextNode(UnrollCursor_t *pAt)
+{
+    if (pAt->pNode->pNext == NULL)
+    {
+        return false;
+    }
+    pAt->pNode = pAt->pNode->pNext;
+    pAt->Pos   = 0;
+    return true;
+}
+
+bool LLUnroll::UnrollPrevNode(UnrollCursor_t *pAt)
+{
+    if (pAt->pNode->pPrev == NULL)
+    {
+        return false;
+    }
+    pAt->pNode = pAt->pNode->pPrev;
+    pAt->Pos   = pAt->pNode->Count - 1;
+    return true;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Find the record for a token.  The node must be live and
+ *    hold a record with the tag.  Only the node is read, the id bit is
+ *    checked before the tags are scanned.
+ *------------------------------------------------------------------
+*/
+bool LLUnroll::UnrollLocate(void *pAddress, uint64_t Tag, UnrollCursor_t *pAt)
+{
+    UnrollNode_t  *pNode = (UnrollNode_t *) pAddress;
+    uint32_t       Id    = (uint32_t)(Tag & LL_UNROLL_IDMASK);
+
+    if (pNode == NULL || pNode->Live != LL_UNROLL_LIVE || ((pNode->Ids[Id >> 6] >> (Id & 63)) & 1) == 0)
+    {
+        return false;
+    }
+
+    for (int Pos = 0; Pos < pNode->Count; ++Pos)
+    {
+        if (*SlotTag(pNode, pNode->Start + Pos) == Tag)
+        {
+            pAt->pNode = pNode;
+            pAt->Pos   = Pos;
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ *--------------------------------------------------------------------
+ * Function: Have nodes ready for Records more records without a
+ *    chunk allocation, counting the nodes as full.
+ *------------------------------------------------------------------
+*/
+bool LLUnroll::UnrollReserve(size_t Records)
+{
+    return NodeSlab.SlabReserve((long)((Records + Capacity - 1) / Capacity + 1));
+}
+
+void LLUnroll::UnrollClear(void)
+{
+    NodeSlab.SlabRelease();
+    pFirst = NULL;
+    pLast  = NULL;
+    Count  = 0;
+}
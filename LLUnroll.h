@@ -0,0 +1,124 @@
+/**--------------------------------------------------------------
+ * File: LLUnroll.h
+ *
+ *  Author: Gregory Gannon
+ * Created: 10/17/2026
+ *---------------------------------------------------------------------
+ * HISTORY
+ *
+ *	 Date       Author      Change Description
+ *   ----		------		------------------
+ * 10/17/2026    GMG        Developed the unrolled storage for LL_OPTION_UNROLLED
+ *
+ * PURPOSE
+ *    Unrolled list storage used by the Linked list manager.  Records are
+ *    packed up to Capacity to a node of about LL_UNROLL_NODEBYTES, and
+ *    the nodes are chained both ways.  Inside a node the records sit in
+ *    list order, so a walk reads memory front to back and follows one
+ *    pointer a node instead of one an element.  A record costs an 8 byte
+ *    tag instead of a ListPointers_t.
+ *
+ *    The records of a node are a run of slots that starts at Start.  An
+ *    insert or delete inside a node slides the shorter side of the run
+ *    by one slot, so adds and deletes at either end of a node move
+ *    nothing.  A full node is split by moving the smaller side of the
+ *    insert point to a new node, and a node that gets down to a quarter
+ *    full is merged into a neighbour.
+ *
+ *    The tag of a record is its validation number with an id in the low
+ *    8 bits that no other record in the node has.  A token holds the
+ *    node address and the tag, and the tag is looked for in that node,
+ *    so a record can slide inside its node and keep its token.  A split
+ *    or merge gives a moved record a new node and a new id.  Nodes come
+ *    from a slab and a freed node is marked dead, so a token for a record
+ *    that was deleted or moved to another node is turned down.
+ *----------------------------------------------------------------------
+*/
+#ifndef LLUNROLL_H
+#define LLUNROLL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "LLSlab.h"
+
+#define  LL_UNROLL_NODEBYTES    4096            // Node budget - a page
+#define  LL_UNROLL_MINRECORDS   4               // Records in a node however big they are
+#define  LL_UNROLL_MAXRECORDS   255             // The id in a tag is 8 bits, one id is always free
+#define  LL_UNROLL_LIVE         0x4C4C4E44      // Node.Live while the node is in the list
+#define  LL_UNROLL_IDMASK       0xFF            // Id bits of a tag
+
+/*
+ *----------------------------------------------------------------------
+ * Front of every node, the slots follow.  A slot is an 8 byte tag and
+ *      the record.  Slots Start to Start + Count - 1 are the records in
+ *      list order.
+ *--------------------------------------------------------------------
+*/
+typedef struct UnrollNode_s {
+    struct UnrollNode_s *pNext;                 /// Next node - the slab free list uses this on a freed node
+    struct UnrollNode_s *pPrev;                 /// Previous node
+    uint32_t             Live;                  /// LL_UNROLL_LIVE in the list, 0 once freed
+    uint16_t             Count;                 /// Records in the node
+    uint16_t             Start;                 /// Slot of the first record
+    uint64_t             Ids[4];                /// Bit per id in use by a record of the node
+    uint32_t             NextId;                /// Where the search for a free id starts
+}  UnrollNode_t;
+
+/*
+ *----------------------------------------------------------------------
+ * A record in the list - the node and the place in the node.
+ *      pNode is NULL when the list is empty.
+ *--------------------------------------------------------------------
+*/
+typedef struct {
+    UnrollNode_t  *pNode;
+    int            Pos;
+}  UnrollCursor_t;
+
+class  LLUnroll
+{
+  protected:
+
+    LLSlab        NodeSlab;                     /// Every node is carved from here
+    UnrollNode_t *pFirst;
+    UnrollNode_t *pLast;
+    size_t        RecordLength;                 /// User bytes in a record
+    size_t        SlotStride;                   /// Tag plus the record rounded to 8
+    size_t        SlotOffset;                   /// Where slot 0 starts in a node
+    int           Capacity;                     /// Records in a full node
+
+    uint64_t     *SlotTag(UnrollNode_t *pNode, int Slot) { return (uint64_t *)((char *) pNode + SlotOffset + Slot * SlotStride); }
+    UnrollNode_t *NewNode(UnrollNode_t *, UnrollNode_t *);                /// Link a new empty node between two
+    void          FreeNode(UnrollNode_t *);
+    uint64_t      NewId(UnrollNode_t *, uint64_t);                        /// Tag with an id free in the node
+    void          OpenGap(UnrollNode_t *, int, int);
+    void          CloseGap(UnrollNode_t *, int, int);
+    void          MoveRecords(UnrollNode_t *, int, int, UnrollNode_t *, int);
+    void          Merge(UnrollNode_t *, UnrollCursor_t *);
+
+  public:
+    size_t        Count;                        /// Records in the list
+
+    bool          UnrollInit(size_t);                                     /// Record length - works out Capacity
+    int           UnrollCapacity(void) { return Capacity; }
+    bool          UnrollInsert(UnrollCursor_t *, bool, const void *, uint64_t); /// Add after or before a record - the cursor moves to it
+    void          UnrollErase(UnrollCursor_t *);                          /// Take a record out - the cursor moves on like ListDelete()
+    bool          UnrollFirst(UnrollCursor_t *);
+    bool          UnrollLast(UnrollCursor_t *);
+    bool          UnrollNextNode(UnrollCursor_t *);                       /// false at the end - the cursor does not move
+    bool          UnrollPrevNode(UnrollCursor_t *);
+    bool          UnrollNext(UnrollCursor_t *pAt)                         /// Steps inside a node stay inline
+                  { return (pAt->Pos + 1 < pAt->pNode->Count) ? (++pAt->Pos, true) : UnrollNextNode(pAt); }
+    bool          UnrollPrev(UnrollCursor_t *pAt)
+                  { return (pAt->Pos > 0) ? (--pAt->Pos, true) : UnrollPrevNode(pAt); }
+    void         *UnrollRecord(UnrollCursor_t *pAt)                       /// User data of the record
+                  { return SlotTag(pAt->pNode, pAt->pNode->Start + pAt->Pos) + 1; }
+    uint64_t      UnrollTag(UnrollCursor_t *pAt)                          /// Validation number for a token
+                  { return *SlotTag(pAt->pNode, pAt->pNode->Start + pAt->Pos); }
+    bool          UnrollLocate(void *, uint64_t, UnrollCursor_t *);       /// Cursor for a token's node and tag
+    bool          UnrollReserve(size_t);                                  /// Nodes for n more records
+    void          UnrollClear(void);                                      /// Every node back to the heap
+                  LLUnroll();
+};
+
+#endif